@@ -0,0 +1,1002 @@
+/* 由Tools/bench_blocks.py生成，请勿手工修改
+ *   输入：rain_synth -s 0.5 -r heavy -S 1（238块，11900个样本）
+ */
+#include "BenchBlocks.h"
+
+const uint16_t bench_block_count = 238;
+
+const uint16_t bench_samples[11900] =
+{
+     302,  303,  304,  306,  303,  304,  305,  304,  304,  301,  302,  304,
+     303,  305,  305,  304,  302,  306,  304,  304,  304,  304,  303,  304,
+     305,  302,  303,  302,  305,  305,  306,  306,  304,  304,  304,  302,
+     304,  305,  304,  305,  306,  303,  303,  305,  301,  302,  305,  306,
+     303,  303,  302,  304,  304,  303,  303,  302,  305,  303,  307,  303,
+     304,  304,  304,  302,  304,  303,  303,  304,  306,  304,  303,  304,
+     302,  302,  304,  301,  304,  303,  300,  303,  306,  301,  307,  304,
+     301,  304,  302,  305,  304,  306,  302,  303,  304,  303,  303,  303,
+     302,  304,  302,  304,  303,  301,  303,  303,  302,  304,  301,  299,
+     303,  298,  303,  303,  303,  300,  304,  301,  301,  300,  304,  301,
+     302,  301,  300,  301,  302,  301,  303,  302,  301,  300,  301,  301,
+     300,  301,  304,  301,  302,  301,  302,  298,  302,  299,  301,  301,
+     298,  300,  299,  302,  296,  297,  298,  300,  298,  300,  302,  300,
+     302,  300,  298,  301,  301,  300,  300,  301,  299,  300,  300,  299,
+     300,  301,  301,  300,  303,  300,  298,  299,  301,  298,  302,  302,
+     298,  297,  299,  302,  300,  298,  302,  300,  300,  298,  300,  297,
+     299,  298,  297,  302,  300,  299,  298,  299,  298,  297,  298,  299,
+     299,  299,  295,  299,  299,  296,  297,  299,  298,  300,  301,  297,
+     298,  299,  296,  294,  296,  299,  299,  297,  296,  297,  299,  296,
+     296,  300,  297,  296,  298,  294,  296,  296,  297,  297,  296,  293,
+     297,  296,  296,  297,  297,  298,  297,  295,  298,  296,  297,  296,
+     297,  298,  295,  298,  301,  298,  301,  298,  296,  298,  297,  297,
+     294,  297,  295,  297,  296,  294,  297,  295,  297,  294,  295,  294,
+     297,  297,  297,  299,  303,  298,  298,  297,  295,  296,  295,  296,
+     299,  297,  297,  296,  299,  297,  294,  297,  295,  296,  298,  295,
+     299,  296,  295,  296,  297,  298,  297,  298,  295,  298,  298,  296,
+     297,  296,  300,  298,  295,  295,  297,  298,  295,  297,  300,  299,
+     296,  296,  297,  298,  300,  299,  299,  298,  298,  300,  298,  299,
+     298,  297,  299,  298,  299,  298,  298,  297,  299,  295,  296,  299,
+     300,  298,  296,  298,  299,  299,  296,  301,  298,  298,  300,  296,
+     297,  302,  302,  299,  298,  299,  296,  298,  298,  297,  299,  300,
+     298,  303,  302,  300,  301,  302,  300,  301,  299,  300,  300,  301,
+     301,  299,  301,  299,  301,  302,  305,  301,  303,  300,  301,  299,
+     303,  300,  300,  302,  302,  302,  299,  302,  299,  303,  302,  302,
+     302,  300,  298,  303,  302,  301,  301,  301,  303,  300,  305,  300,
+     301,  300,  300,  301,  304,  301,  303,  301,  302,  299,  302,  302,
+     301,  299,  303,  304,  303,  303,  302,  300,  301,  301,  302,  302,
+     304,  302,  304,  305,  303,  303,  300,  302,  306,  304,  303,  303,
+     300,  303,  303,  302,  303,  301,  302,  303,  302,  303,  302,  302,
+     305,  301,  302,  303,  305,  302,  303,  304,  304,  305,  303,  304,
+     305,  306,  301,  305,  305,  303,  304,  302,  306,  305,  304,  305,
+     304,  306,  304,  303,  305,  305,  303,  304,  305,  303,  302,  302,
+     303,  304,  301,  304,  304,  304,  305,  304,  302,  303,  305,  304,
+     304,  300,  305,  306,  303,  303,  303,  303,  304,  302,  302,  304,
+     301,  303,  304,  304,  304,  302,  306,  303,  304,  305,  304,  303,
+     304,  302,  301,  303,  306,  305,  306,  307,  306,  303,  304,  303,
+     304,  303,  302,  300,  300,  305,  304,  303,  303,  305,  303,  303,
+     305,  301,  305,  301,  304,  303,  303,  303,  301,  305,  300,  304,
+     304,  302,  302,  302,  303,  304,  305,  303,  302,  307,  303,  301,
+     303,  301,  304,  302,  302,  305,  300,  302,  302,  303,  303,  302,
+     304,  300,  298,  302,  302,  302,  300,  303,  301,  300,  301,  299,
+     299,  299,  301,  301,  301,  302,  302,  304,  299,  300,  303,  301,
+     301,  298,  300,  304,  300,  300,  301,  302,  300,  299,  298,  300,
+     299,  298,  301,  300,  302,  298,  297,  299,  300,  298,  301,  298,
+     298,  299,  300,  299,  300,  301,  298,  299,  299,  298,  298,  301,
+     297,  299,  298,  299,  299,  297,  298,  301,  299,  299,  299,  299,
+     299,  299,  297,  296,  299,  300,  296,  297,  299,  298,  299,  296,
+     295,  295,  300,  300,  298,  297,  298,  299,  297,  296,  299,  299,
+     298,  300,  296,  299,  298,  295,  299,  297,  301,  299,  299,  299,
+     294,  297,  299,  300,  298,  296,  298,  297,  297,  296,  299,  300,
+     297,  296,  298,  296,  296,  298,  295,  297,  298,  294,  294,  297,
+     296,  297,  298,  297,  298,  296,  296,  295,  298,  299,  293,  295,
+     295,  296,  294,  299,  296,  298,  295,  298,  297,  296,  295,  293,
+     296,  298,  295,  296,  294,  296,  296,  296,  295,  298,  297,  296,
+     298,  296,  296,  297,  296,  297,  298,  294,  298,  296,  296,  297,
+     299,  299,  297,  297,  299,  297,  298,  297,  297,  296,  297,  296,
+     296,  295,  298,  298,  300,  298,  300,  297,  299,  297,  297,  300,
+     297,  297,  299,  297,  301,  296,  296,  299,  300,  295,  297,  298,
+     295,  299,  300,  300,  298,  298,  297,  300,  300,  299,  301,  300,
+     300,  298,  299,  297,  300,  301,  299,  300,  300,  300,  299,  301,
+     299,  299,  298,  298,  298,  304,  299,  299,  298,  299,  298,  302,
+     300,  300,  300,  301,  301,  301,  296,  298,  300,  299,  301,  301,
+     301,  300,  299,  302,  300,  298,  301,  301,  300,  302,  299,  302,
+     306,  301,  299,  298,  302,  302,  303,  301,  301,  302,  299,  301,
+     305,  302,  302,  303,  303,  301,  300,  301,  306,  301,  303,  301,
+     304,  305,  305,  304,  301,  305,  301,  304,  301,  304,  302,  301,
+     303,  305,  305,  303,  304,  301,  306,  304,  303,  302,  304,  300,
+     301,  302,  305,  305,  305,  307,  304,  302,  306,  303,  304,  303,
+     302,  304,  304,  301,  305,  304,  307,  303,  305,  303,  303,  304,
+     302,  304,  304,  304,  299,  303,  304,  303,  303,  304,  303,  303,
+     302,  305,  303,  302,  303,  305,  305,  302,  303,  306,  304,  305,
+     305,  305,  306,  306,  303,  303,  306,  303,  304,  305,  304,  303,
+     306,  304,  304,  303,  301,  305,  304,  303,  306,  302,  305,  304,
+     305,  303,  304,  302,  301,  304,  305,  306,  305,  303,  302,  303,
+     306,  304,  305,  304,  303,  302,  306,  304,  305,  303,  303,  301,
+     304,  299,  304,  304,  300,  302,  308,  304,  304,  301,  304,  303,
+     305,  304,  303,  300,  301,  302,  302,  304,  303,  304,  304,  303,
+     305,  303,  304,  302,  304,  301,  303,  301,  303,  304,  306,  303,
+     302,  303,  302,  302,  305,  302,  304,  304,  302,  303,  302,  303,
+     303,  301,  303,  299,  302,  305,  301,  302,  301,  302,  300,  299,
+     300,  301,  299,  301,  302,  299,  302,  298,  302,  300,  302,  303,
+     300,  299,  303,  301,  301,  302,  297,  304,  300,  301,  302,  300,
+     302,  300,  298,  299,  300,  300,  298,  299,  302,  300,  299,  299,
+     300,  298,  299,  298,  301,  297,  301,  302,  300,  301,  301,  302,
+     299,  298,  299,  301,  299,  300,  297,  299,  301,  298,  301,  297,
+     301,  300,  298,  300,  297,  299,  299,  298,  300,  299,  299,  299,
+     300,  299,  297,  298,  300,  298,  299,  295,  296,  300,  301,  298,
+     297,  299,  297,  298,  297,  300,  298,  297,  297,  296,  297,  298,
+     298,  298,  298,  297,  298,  297,  298,  297,  294,  294,  294,  300,
+     297,  295,  298,  297,  300,  297,  298,  298,  298,  297,  295,  298,
+     297,  299,  295,  297,  297,  294,  298,  299,  297,  296,  299,  297,
+     297,  298,  298,  296,  297,  295,  297,  298,  296,  296,  297,  301,
+     297,  299,  297,  296,  299,  298,  298,  299,  296,  297,  295,  296,
+     298,  299,  296,  296,  297,  296,  298,  295,  297,  295,  296,  297,
+     297,  298,  296,  299,  297,  300,  298,  297,  296,  297,  300,  297,
+     296,  295,  297,  298,  296,  299,  298,  299,  299,  298,  297,  298,
+     296,  298,  296,  298,  295,  297,  299,  300,  296,  301,  297,  299,
+     301,  297,  299,  296,  297,  298,  301,  300,  300,  298,  297,  298,
+     300,  296,  299,  294,  297,  298,  301,  301,  298,  298,  299,  300,
+     302,  300,  298,  298,  299,  298,  300,  301,  299,  299,  300,  301,
+     298,  298,  298,  302,  299,  298,  301,  299,  302,  299,  302,  299,
+     301,  302,  297,  299,  298,  300,  302,  300,  301,  300,  301,  299,
+     301,  300,  300,  300,  302,  299,  300,  301,  303,  301,  299,  302,
+     303,  299,  300,  298,  302,  301,  301,  300,  301,  301,  302,  302,
+     306,  303,  301,  301,  301,  304,  300,  303,  301,  300,  303,  301,
+     302,  301,  302,  304,  302,  301,  301,  301,  302,  302,  302,  300,
+     304,  301,  303,  302,  301,  302,  302,  302,  304,  304,  303,  304,
+     300,  302,  302,  304,  304,  303,  301,  305,  303,  302,  304,  303,
+     304,  303,  301,  304,  305,  305,  302,  305,  305,  303,  305,  301,
+     303,  306,  305,  302,  303,  305,  304,  304,  305,  304,  304,  303,
+     306,  302,  303,  306,  306,    0,  303,  303,  302,  302,  303,  305,
+     306,  304,  306,  301,  306,  304,  304,  304,  303,  304,  303,  306,
+     303,  306,  298,  305,  308,  306,  302,  304,  305,  303,  301,  302,
+     308,  302,  304,  303,  303,  307,  304,  306,  301,  303,  303,  304,
+     303,  304,  302,  304,  302,  303,  303,  305,  305,  303,  301,  304,
+     305,  305,  304,  306,  305,  304,  301,  301,  303,  305,  305,  306,
+     304,  307,  302,  301,  300,  303,  307,  304,  303,  305,  305,  304,
+     302,  302,  305,  304,  303,  302,  305,  305,  302,  304,  305,  303,
+     301,  303,  303,  304,  304,  306,  301,  299,  302,  303,  303,  301,
+     302,  303,  301,  303,  301,  300,  302,  305,  303,  301,  299,  303,
+     302,  301,  302,  301,  300,  302,  301,  299,  300,  301,  299,  302,
+     300,  303,  298,  302,  302,  301,  302,  298,  300,  302,  300,  299,
+     300,  299,  297,  300,  303,  301,  302,  299,  301,  300,  298,  297,
+     299,  300,  300,  301,  299,  298,  299,  300,  299,  300,  299,  299,
+     301,  299,  303,  299,  297,  296,  298,  296,  297,  297,  298,  302,
+     302,  300,  297,  299,  299,  299,  297,  299,  296,  300,  296,  298,
+     299,  299,  296,  296,  300,  296,  302,  298,  296,  298,  297,  297,
+     298,  296,  298,  300,  296,  295,  298,  296,  295,  298,  298,  299,
+     298,  298,  297,  294,  295,  298,  296,  294,  295,  299,  298,  298,
+     296,  294,  297,  298,  296,  296,  298,  295,  296,  296,  299,  296,
+     300,  296,  296,  296,  294,  294,  298,  296,  297,  297,  297,  296,
+     295,  296,  296,  295,  298,  298,  294,  295,  295,  299,  298,  295,
+     299,  296,  297,  296,  298,  297,  298,  295,  296,  294,  295,  298,
+     295,  297,  296,  298,  299,  297,  296,  295,  297,  296,  296,  296,
+     295,  297,  296,  298,  314,  370,  410,  448,  472,  490,  506,  517,
+     524,  530,  532,  524,  500,  479,  466,  465,  467,  477,  494,  507,
+     518,  526,  525,  515,  503,  483,  460,  442,  424,  410,  402,  397,
+     397,  402,  404,  411,  412,  415,  415,  409,  403,  393,  380,  375,
+     363,  353,  346,  346,  348,  347,  353,  355,  356,  359,  358,  353,
+     351,  347,  341,  336,  328,  327,  325,  321,  324,  321,  326,  326,
+     328,  327,  325,  327,  322,  324,  316,  318,  313,  310,  310,  312,
+     311,  313,  312,  313,  315,  316,  313,  314,  312,  309,  310,  312,
+     306,  305,  305,  309,  309,  306,  308,  307,  307,  309,  308,  309,
+     306,  303,  305,  304,  306,  305,  304,  301,  304,  304,  307,  304,
+     305,  304,  306,  305,  305,  304,  304,  302,  304,  306,  304,  302,
+     303,  304,  305,  305,  304,  304,  305,  306,  305,  303,  303,  304,
+     304,  302,  302,  302,  303,  304,  302,  305,  304,  303,  303,  304,
+     302,  304,  303,  304,  302,  305,  305,  303,  306,  302,  303,  303,
+     303,  302,  304,  306,  303,  303,  302,  304,  305,  306,  306,  303,
+     306,  303,  303,  306,  303,  305,  304,  301,  302,  302,  304,  305,
+     306,  301,  302,  303,  306,  305,  304,  305,  303,  303,  304,  305,
+     302,  305,  306,  302,  307,  304,  305,  308,  305,  302,  305,  303,
+     308,  306,  305,  305,  304,  304,  301,  304,  305,  305,  302,  304,
+     303,  305,  306,  306,  302,  302,  301,  305,  303,  302,  301,  303,
+     302,  306,  306,  304,  303,  304,  304,  305,  302,  304,  305,  302,
+     302,  303,  304,  304,  302,  305,  305,  305,  304,  303,  305,  302,
+     304,  304,  301,  303,  301,  303,  303,  302,  301,  303,  302,  304,
+     302,  302,  303,  304,  300,  305,  303,  301,  301,  302,  303,  303,
+     301,  300,  302,  304,  300,  304,  300,  303,  301,  302,  302,  300,
+     304,  299,  300,  303,  302,  303,  300,  300,  304,  304,  302,  302,
+     302,  302,  300,  299,  303,  301,  301,  301,  302,  301,  301,  299,
+     300,  301,  303,  300,  301,  301,  301,  300,  302,  298,  301,  299,
+     299,  302,  302,  300,  298,  299,  299,  297,  301,  297,  300,  300,
+     300,  300,  298,  299,  296,  299,  300,  301,  300,  297,  298,  301,
+     298,  297,  299,  301,  299,  299,  296,  297,  297,  299,  299,  300,
+     299,  301,  299,  297,  296,  296,  298,  300,  298,  300,  298,  298,
+     299,  297,  298,  296,  296,  296,  297,  299,  297,  297,  297,  298,
+     296,  297,  296,  300,  298,  298,  294,  299,  297,  296,  297,  295,
+     298,  300,  297,  296,  294,  299,  294,  300,  297,  297,  294,  300,
+     297,  298,  301,  297,  294,  298,  295,  296,  295,  297,  296,  296,
+     295,  296,  298,  295,  299,  297,  297,  294,  294,  296,  296,  297,
+     296,  297,  298,  297,  297,  298,  294,  295,  297,  298,  296,  294,
+     297,  299,  297,  296,  298,  298,  297,  295,  295,  300,  299,  296,
+     298,  299,  296,  301,  298,  299,  295,  298,  297,  299,  297,  297,
+     297,  300,  299,  298,  297,  296,  297,  299,  299,  298,  296,  298,
+     296,  297,  295,  298,  297,  299,  296,  300,  297,  297,  297,  296,
+     298,  297,  297,  297,  297,  298,  297,  300,  299,  298,  299,  300,
+     299,  302,  298,  299,  295,  297,  301,  299,  297,  298,  296,  300,
+     295,  300,  299,  298,  299,  297,  297,  301,  300,  299,  296,  301,
+     299,  299,  302,  298,  301,  299,  299,  298,  299,  299,  299,  299,
+     298,  297,  300,  298,  300,  300,  301,  298,  300,  301,  297,  300,
+     301,  299,  299,  303,  299,  300,  301,  299,  301,  300,  301,  302,
+     300,  302,  302,  301,  303,  301,  304,  305,  302,  300,  301,  303,
+     303,  300,  302,  301,  302,  303,  300,  297,  300,  299,  303,  302,
+     300,  303,  303,  303,  303,  305,  303,  303,  304,  302,  303,  301,
+     302,  303,  302,  306,  303,  301,  302,  301,  303,  302,  304,  300,
+     304,  303,  304,  301,  305,  303,  304,  304,  304,  303,  303,  301,
+     304,  304,  302,  305,  306,  304,  303,  302,  304,  303,  304,  304,
+     303,  303,  302,  303,  305,  307,  305,  304,  304,  305,  304,  304,
+     300,  304,  305,  304,  303,  304,  306,  300,  306,  306,  307,  306,
+     305,  304,  305,  302,  304,  305,  305,  306,  303,  304,  306,  302,
+     305,  305,  305,  304,  302,  303,  302,  305,  300,  303,  304,  301,
+     305,  305,  304,  305,  305,  304,  303,  302,  303,  304,  303,  303,
+     301,  302,  302,  306,  304,  306,  304,  304,  301,  305,  305,  301,
+     304,  304,  302,  303,  304,  305,  303,  302,  306,  305,  303,  302,
+     304,  303,  303,  306,  304,  302,  302,  301,  304,  302,  305,  304,
+     304,  305,  304,  303,  304,  306,  303,  306,  304,  304,  298,  303,
+     303,  300,  304,  303,  301,  300,  302,  303,  302,  302,  305,  301,
+     304,  304,  301,  300,  304,  300,  301,  300,  301,  302,  302,  300,
+     303,  302,  301,  301,  304,  303,  298,  303,  303,  298,  301,  301,
+     303,  298,  299,  302,  299,  300,  299,  301,  300,  301,  300,  300,
+     300,  300,  300,  299,  299,  300,  301,  299,  300,  302,  298,  298,
+     300,  300,  301,  300,  300,  299,  300,  300,  299,  297,  300,  300,
+     301,  301,  299,  300,  299,  299,  301,  301,  299,  301,  299,  302,
+     299,  298,  297,  299,  295,  298,  301,  298,  301,  298,  296,  297,
+     298,  298,  296,  298,  298,  297,  301,  297,  298,  295,  300,  298,
+     299,  298,  297,  297,  298,  297,  300,  297,  300,  298,  299,  300,
+     297,  295,  300,  296,  297,  297,  296,  296,  298,  295,  301,  295,
+     298,  295,  296,  295,  300,  299,  297,  295,  296,  294,  294,  297,
+     297,  356,  419,  471,  509,  536,  561,  572,  582,  589,  594,  558,
+     529,  508,  502,  500,  511,  523,  541,  557,  565,  571,  564,  551,
+     528,  502,  479,  454,  433,  418,  410,  407,  408,  413,  423,  428,
+     433,  432,  425,  421,  408,  394,  384,  369,  360,  350,  349,  348,
+     349,  354,  355,  361,  362,  362,  356,  357,  350,  341,  339,  331,
+     327,  322,  320,  321,  322,  323,  328,  330,  330,  328,  330,  325,
+     321,  319,  316,  314,  307,  310,  307,  309,  305,  311,  310,  312,
+     312,  311,  311,  310,  310,  306,  303,  304,  305,  302,  301,  304,
+     302,  305,  302,  305,  306,  305,  308,  303,  305,  302,  301,  301,
+     301,  301,  304,  303,  302,  303,  303,  302,  302,  304,  301,  301,
+     301,  300,  303,  301,  298,  300,  302,  299,  303,  304,  300,  302,
+     300,  301,  303,  299,  301,  304,  301,  298,  302,  301,  301,  302,
+     300,  300,  300,  302,  302,  301,  303,  300,  299,  301,  301,  300,
+     303,  299,  301,  300,  304,  302,  299,  300,  302,  300,  302,  302,
+     302,  302,  303,  305,  301,  299,  302,  302,  301,  304,  304,  302,
+     303,  301,  302,  303,  303,  300,  302,  303,  301,  305,  302,  304,
+     302,  304,  304,  304,  305,  302,  303,  303,  306,  303,  301,  303,
+     303,  303,  304,  303,  303,  301,  304,  303,  306,  304,  305,  304,
+     303,  304,  304,  304,  303,  305,  301,  305,  302,  301,  304,  307,
+     304,  304,  303,  305,  303,  305,  304,  304,  300,  304,  302,  304,
+     303,  306,  301,  305,  301,  300,  301,  301,  303,  301,  303,  303,
+     305,  307,  304,  306,  304,  305,  303,  303,  304,  304,  304,  303,
+     303,  305,  303,  306,  306,  305,  305,  302,  306,  305,  305,  305,
+     303,  303,  305,  303,  307,  305,  305,  304,  307,  304,  304,  300,
+     305,  307,  305,  301,  308,  303,  302,  304,  303,  304,  302,  304,
+     301,  300,  305,  305,  303,  302,  304,  304,  303,  306,  305,  303,
+     302,  302,  303,  303,  304,  303,  303,  301,  303,  304,  303,  302,
+     300,  303,  304,  303,  304,  302,  300,  304,  305,  302,  303,  301,
+     300,  301,  301,  303,  301,  301,  303,  302,  305,  303,  304,  301,
+     304,  303,  304,  302,  300,  299,  300,  301,  301,  302,  300,  301,
+     300,  300,  302,  300,  303,  299,  303,  301,  298,  301,  302,  300,
+     304,  300,  301,  301,  301,  299,  302,  299,  302,  299,  301,  300,
+     300,  301,  299,  301,  301,  299,  300,  300,  300,  299,  298,  299,
+     299,  298,  299,  299,  301,  298,  299,  299,  301,  299,  299,  300,
+     300,  297,  297,  299,  295,  299,  299,  300,  300,  298,  297,  299,
+     298,  299,  300,  299,  296,  299,  300,  298,  297,  298,  299,  298,
+     297,  297,  298,  298,  300,  298,  299,  300,  297,  298,  299,  295,
+     297,  298,  296,  298,  298,  298,  297,  296,  295,  297,  297,  298,
+     296,  296,  298,  298,  296,  296,  296,  294,  299,  294,  297,  297,
+     295,  296,  299,  298,  301,  296,  300,  297,  299,  297,  298,  296,
+     297,  296,  296,  295,  294,  295,  296,  297,  297,  295,  299,  296,
+     297,  297,  297,  332,  475,  583,  671,  738,  784,  816,  842,  855,
+     862,  830,  769,  720,  692,  686,  696,  719,  748,  777,  799,  809,
+     799,  775,  735,  690,  637,  586,  542,  508,  485,  479,  478,  485,
+     498,  511,  516,  524,  517,  504,  484,  461,  433,  409,  388,  372,
+     362,  360,  361,  368,  374,  383,  388,  391,  389,  381,  371,  361,
+     349,  338,  325,  322,  317,  319,  321,  321,  330,  333,  337,  336,
+     338,  332,  325,  323,  320,  309,  307,  303,  302,  303,  304,  306,
+     312,  311,  314,  317,  314,  313,  312,  308,  310,  307,  300,  300,
+     300,  300,  303,  301,  303,  304,  306,  309,  305,  305,  306,  305,
+     302,  300,  301,  302,  296,  300,  300,  301,  300,  302,  305,  304,
+     301,  302,  302,  302,  302,  302,  301,  299,  302,  301,  304,  301,
+     303,  300,  301,  303,  301,  306,  300,  304,  299,  300,  300,  301,
+     301,  298,  303,  301,  300,  302,  303,  301,  301,  302,  299,  300,
+     302,  300,  300,  302,  301,  303,  302,  307,  303,  302,  303,  303,
+     302,  303,  303,  304,  302,  305,  302,  302,  300,  306,  301,  304,
+     303,  303,  305,  303,  300,  301,  303,  303,  303,  301,  303,  302,
+     302,  301,  304,  303,  305,  306,  306,  302,  303,  306,  305,  302,
+     303,  305,  306,  305,  302,  307,  304,  305,  302,  305,  302,  307,
+     304,  306,  303,  303,  303,  303,  304,  303,  302,  304,  302,  306,
+     302,  304,  302,  305,  303,  305,  304,  302,  301,  306,  304,  306,
+     308,  305,  306,  303,  304,  303,  305,  305,  303,  303,  305,  307,
+     304,  306,  302,  304,  304,  304,  304,  306,  304,  304,  306,  303,
+     303,  302,  305,  306,  305,  305,  302,  305,  303,  303,  306,  305,
+     306,  303,  305,  304,  305,  305,  304,  305,  304,  304,  302,  303,
+     305,  301,  301,  303,  303,  304,  303,  302,  302,  305,  303,  304,
+     303,  303,  302,  302,  302,  303,  303,  304,  301,  305,  301,  305,
+     300,  302,  305,  305,  303,  301,  305,  303,  303,  300,  301,  299,
+     301,  303,  303,  301,  303,  301,  301,  303,  303,  301,  301,  300,
+     301,  299,  298,  299,  304,  305,  301,  299,  303,  303,  301,  301,
+     302,  303,  302,  301,  303,  301,  302,  301,  301,  303,  302,  300,
+     302,  300,  300,  302,  301,  300,  300,  298,  302,  302,  300,  299,
+     302,  301,  302,  300,  304,  301,  302,  304,  303,  300,  298,  300,
+     300,  299,  298,  297,  297,  302,  298,  299,  299,  301,  295,  301,
+     298,  299,  298,  297,  299,  300,  299,  300,  297,  299,  302,  300,
+     300,  300,  300,  298,  297,  299,  298,  298,  299,  298,  297,  298,
+     298,  299,  299,  300,  297,  297,  299,  302,  298,  298,  297,  298,
+     298,  298,  295,  297,  299,  299,  295,  295,  298,  298,  298,  299,
+     298,  296,  297,  298,  297,  297,  296,  299,  296,  295,  296,  296,
+     296,  297,  297,  297,  298,  294,  295,  300,  295,  296,  297,  298,
+     295,  297,  298,  295,  294,  296,  295,  298,  297,  293,  297,  296,
+     299,  296,  296,  296,  297,  299,  298,  297,  295,  296,  299,  294,
+     296,  296,  299,  297,  295,  296,  298,  297,  299,  297,  300,  296,
+     298,  297,  296,  295,  298,  299,  297,  295,  296,  297,  294,  298,
+     296,  297,  298,  298,  297,  296,  297,  300,  294,  298,  295,  299,
+     297,  299,  298,  296,  297,  297,  298,  297,  296,  296,  299,  298,
+     297,  296,  299,  299,  299,  298,  297,  298,  296,  298,  299,  299,
+     299,  300,  296,  297,  297,  297,  298,  297,  299,  299,  300,  299,
+     299,  303,  299,  297,  299,  299,  300,  302,  302,  300,  298,  299,
+     302,  299,  297,  299,  300,  298,  302,  298,  302,  300,  300,  300,
+     299,  298,  302,  300,  299,  302,  301,  300,  300,  301,  300,  300,
+     300,  301,  304,  302,  300,  303,  299,  303,  301,  301,  301,  303,
+     299,  302,  301,  301,  299,  304,  298,  303,  299,  300,  305,  300,
+     301,  302,  301,  303,  301,  302,  301,  303,  303,  303,  305,  301,
+     298,  304,  305,  303,  302,  302,  300,  300,  304,  301,  303,  305,
+     302,  304,  302,  305,  303,  304,  302,  305,  301,  302,  303,  304,
+     303,  303,  301,  303,  299,  303,  302,  304,  302,  302,  306,  303,
+     301,  305,  302,  303,  305,  305,  301,  303,  303,  305,  303,  304,
+     302,  303,  303,  305,  304,  308,  302,  306,  303,  305,  305,  303,
+     303,  305,  303,  304,  306,  306,  304,  304,  305,  303,  305,  304,
+     304,  304,  305,  304,  304,  306,  306,  304,  302,  303,  304,  305,
+     303,  303,  303,  304,  303,  304,  303,  305,  305,  302,  304,  305,
+     303,  305,  304,  302,  305,  303,  306,  305,  303,  305,  302,  302,
+     307,  304,  302,  304,  300,  304,  302,  305,  302,  310,  304,  303,
+     301,  305,  303,  304,  304,  305,  304,  302,  304,  301,  307,  304,
+     303,  304,  302,  305,  302,  303,  304,  303,  302,  305,  302,  301,
+     305,  303,  304,  302,  302,  302,  304,  304,  303,  302,  303,  306,
+     303,  301,  305,  304,  303,  298,  303,  304,  300,  301,  304,  302,
+     303,  302,  303,  300,  301,  301,  303,  304,  302,  298,  302,  302,
+     301,  303,  305,  300,  303,  302,  301,  301,  302,  301,  301,  302,
+     301,  299,  301,  300,  303,  302,  300,  301,  301,  299,  301,  300,
+     301,  299,  300,  303,  298,  303,  302,  301,  301,  299,  300,  298,
+     300,  298,  298,  302,  298,  299,  299,  298,  299,  302,  296,  299,
+     298,  299,  298,  300,  299,  298,  301,  296,  298,  300,  300,  301,
+     300,  299,  297,  299,  297,  298,  296,  300,  301,  301,  298,  299,
+     301,  300,  301,  298,  298,  300,  298,  298,  298,  297,  299,  296,
+     298,  297,  298,  296,  299,  298,  298,  298,  294,  301,  299,  299,
+     297,  297,  296,  296,  298,  297,  298,  297,  297,  298,  297,  297,
+     298,  299,  296,  299,  297,  297,  297,  298,  298,  298,  296,  297,
+     299,  297,  299,  300,  296,  298,  297,  297,  296,  296,  297,  299,
+     296,  296,  294,  300,  295,  296,  296,  296,  297,  296,  297,  295,
+     298,  298,  295,  298,  293,  297,  299,  297,  299,  294,  296,  297,
+     296,  298,  298,  298,  299,  298,  298,  296,  296,  297,  298,  299,
+     297,  294,  298,  297,  296,  296,  297,  297,  299,  333,  415,  481,
+     537,  575,  604,  624,  636,  645,  649,  618,  581,  555,  540,  538,
+     547,  563,  583,  597,  606,  627,  702,  747,  772,  788,  783,  778,
+     770,  764,  759,  757,  754,  724,  697,  682,  680,  687,  697,  707,
+     715,  719,  707,  692,  670,  644,  612,  578,  550,  526,  506,  495,
+     489,  485,  492,  493,  495,  496,  490,  484,  471,  455,  438,  424,
+     406,  396,  388,  381,  379,  381,  381,  385,  388,  386,  384,  380,
+     376,  367,  356,  354,  344,  338,  333,  332,  334,  336,  336,  338,
+     337,  341,  339,  336,  333,  330,  325,  321,  321,  317,  315,  315,
+     317,  314,  316,  316,  319,  319,  319,  317,  315,  315,  310,  310,
+     307,  306,  307,  307,  307,  305,  310,  309,  308,  309,  309,  309,
+     309,  308,  307,  305,  304,  305,  303,  305,  307,  305,  306,  306,
+     305,  310,  304,  305,  304,  305,  304,  303,  305,  304,  302,  300,
+     305,  304,  305,  304,  305,  306,  305,  305,  305,  302,  304,  307,
+     302,  305,  302,  305,  304,  303,  301,  303,  307,  304,  306,  307,
+     305,  304,  306,  303,  307,  302,  305,  303,  305,  305,  307,  302,
+     304,  306,  303,  307,  307,  303,  305,  305,  306,  303,  305,  303,
+     303,  303,  306,  304,  303,  304,  302,  302,  305,  302,  305,  305,
+     303,  302,  301,  305,  304,  306,  303,  303,  301,  305,  301,  302,
+     305,  304,  303,  303,  303,  305,  304,  305,  304,  303,  304,  303,
+     306,  305,  304,  303,  303,  305,  304,  305,  305,  305,  303,  304,
+     303,  305,  303,  304,  305,  304,  304,  303,  301,  304,  304,  305,
+     302,  304,  305,  303,  302,  305,  301,  304,  305,  305,  303,  303,
+     302,  305,  303,  302,  301,  303,  302,  302,  304,  302,  301,  301,
+     305,  303,  302,  304,  299,  305,  299,  298,  302,  302,  300,  303,
+     300,  301,  301,  302,  304,  301,  301,  303,  302,  302,  300,  302,
+     301,  302,  303,  299,  302,  302,  300,  301,  301,  301,  302,  300,
+     301,  300,  300,  300,  298,  298,  300,  300,  300,  300,  300,  298,
+     299,  301,  300,  301,  297,  301,  301,  299,  300,  301,  301,  302,
+     302,  296,  300,  300,  300,  302,  300,  303,  300,  300,  298,  301,
+     299,  297,  298,  299,  300,  297,  298,  298,  302,  299,  299,  303,
+     296,  299,  297,  298,  301,  297,  296,  300,  299,  300,  298,  300,
+     299,  296,  297,  300,  294,  299,  297,  298,  298,  301,  297,  298,
+     296,  296,  298,  300,  294,  297,  300,  300,  295,  298,  296,  297,
+     295,  299,  298,  297,  298,  298,  300,  296,  299,  298,  298,  298,
+     298,  297,  297,  299,  296,  297,  292,  296,  297,  295,  295,  296,
+     296,  300,  295,  298,  299,  296,  295,  299,  293,  295,  299,  294,
+     297,  296,  297,  296,  298,  296,  296,  297,  297,  297,  296,  295,
+     297,  295,  299,  298,  297,  296,  297,  298,  295,  297,  293,  297,
+     298,  297,  297,  296,  295,  292,  297,  298,  297,  298,  299,  296,
+     297,  293,  298,  295,  299,  298,  298,  296,  298,  297,  299,  295,
+     297,  297,  297,  298,  297,  294,  296,  297,  296,  299,  296,  298,
+     295,  296,  296,  297,  297,  298,  295,  297,  298,  298,  298,  294,
+     297,  298,  300,  296,  301,  298,  301,  295,  299,  298,  297,  298,
+     301,  300,  300,  296,  295,  297,  295,  300,  300,  298,  296,  300,
+     300,  301,  300,  300,  297,  302,  301,  298,  299,  297,  302,  302,
+     300,  299,  298,  299,  301,  300,  300,  300,  300,  299,  300,  301,
+     301,  299,  303,  300,  299,  299,  299,  301,  302,  300,  303,  302,
+     301,  300,  298,  302,  301,  299,  301,  301,  300,  302,  301,  303,
+     299,  299,  302,  301,  300,  301,  301,  302,  300,  299,  303,  304,
+     300,  303,  303,  300,  300,  301,  303,  302,  301,  304,  304,  300,
+     304,  302,  303,  301,  302,  304,  299,  300,  303,  303,  302,  306,
+     300,  303,  304,  304,  302,  302,  301,  302,  303,  303,  304,  303,
+     303,  303,  301,  302,  305,  304,  305,  303,  306,  303,  305,  305,
+     303,  304,  306,  304,  306,  304,  303,  304,  306,  303,  302,  304,
+     304,  302,  304,  305,  303,  303,  302,  305,  303,  306,  304,  303,
+     305,  303,  305,  305,  302,  303,  304,  305,  305,  305,  305,  304,
+     303,  306,  306,  301,  303,  303,  304,  304,  307,  307,  305,  306,
+     306,  305,  303,  301,  303,  304,  303,  305,  306,  304,  303,  303,
+     303,  304,  306,  304,  305,  304,  301,  304,  304,  303,  305,  305,
+     304,  306,  305,  302,  303,  304,  302,  302,  303,  305,  306,  303,
+     302,  301,  304,  301,  304,  304,  303,  305,  302,  303,  304,  302,
+     301,  303,  304,  304,  304,  304,  304,  304,  306,  304,  303,  301,
+     304,  301,  301,  303,  303,  302,  302,  305,  304,  301,  301,  304,
+     303,  303,  302,  303,  302,  303,  304,  300,  302,  304,  302,  304,
+     301,  302,  306,  299,  305,  301,  303,  299,  299,  302,  301,  301,
+     300,  302,  302,  302,  305,  302,  303,  300,  297,  300,  302,  301,
+     301,  300,  304,  300,  303,  302,  300,  301,  297,  300,  302,  296,
+     302,  300,  301,  300,  296,  302,  297,  301,  299,  302,  297,  301,
+     300,  300,  300,  301,  301,  301,  302,  299,  300,  300,  300,  298,
+     298,  301,  300,  301,  300,  302,  299,  298,  298,  300,  297,  299,
+     300,  300,  302,  296,  300,  298,  298,  299,  299,  298,  297,  297,
+     299,  296,  297,  298,  299,  296,  297,  299,  297,  299,  301,  296,
+     299,  300,  299,  293,  295,  297,  296,  296,  295,  299,  300,  439,
+     655,  828,  965, 1074, 1157, 1218, 1263, 1288, 1305, 1313, 1229, 1126,
+    1046, 1013, 1010, 1039, 1090, 1153, 1209, 1247, 1254, 1236, 1190, 1121,
+    1035,  944,  857,  784,  730,  693,  685,  690,  709,  734,  751,  766,
+     768,  753,  726,  691,  641,  596,  549,  513,  486,  473,  468,  470,
+     482,  493,  507,  514,  517,  508,  495,  473,  449,  427,  406,  386,
+     375,  369,  369,  372,  377,  387,  396,  396,  397,  394,  386,  375,
+     364,  353,  342,  335,  332,  324,  328,  331,  329,  339,  341,  341,
+     342,  341,  340,  330,  327,  325,  317,  312,  310,  307,  310,  306,
+     313,  315,  321,  317,  320,  316,  318,  316,  313,  308,  302,  304,
+     303,  304,  301,  301,  307,  309,  306,  308,  308,  308,  308,  306,
+     304,  301,  300,  302,  300,  298,  299,  302,  303,  303,  304,  306,
+     303,  300,  305,  304,  299,  301,  301,  302,  300,  303,  301,  301,
+     304,  300,  303,  300,  303,  303,  304,  303,  301,  302,  299,  299,
+     302,  302,  303,  300,  301,  302,  301,  302,  302,  301,  303,  304,
+     300,  302,  299,  303,  301,  301,  296,  303,  302,  300,  301,  302,
+     302,  303,  301,  303,  304,  302,  299,  303,  303,  302,  302,  299,
+     302,  301,  303,  302,  301,  301,  302,  305,  303,  301,  302,  304,
+     304,  302,  301,  304,  302,  302,  300,  302,  303,  302,  303,  303,
+     305,  306,  302,  304,  303,  303,  303,  301,  304,  304,  303,  304,
+     303,  303,  305,  304,  305,  305,  304,  303,  304,  305,  304,  305,
+     304,  302,  302,  304,  304,  303,  302,  302,  303,  303,  303,  302,
+     307,  307,  307,  303,  305,  304,  304,  305,  306,  303,  305,  303,
+     302,  304,  302,  304,  307,  304,  305,  305,  305,  303,  305,  306,
+     303,  303,  303,  303,  304,  303,  303,  303,  303,  303,  305,  306,
+     304,  302,  306,  306,  305,  306,  304,  306,  305,  307,  304,  303,
+     305,  303,  305,  304,  304,  303,  303,  304,  306,  306,  305,  302,
+     305,  305,  307,  302,  304,  303,  303,  306,  304,  302,  305,  303,
+     302,  303,  303,  303,  303,  302,  303,  305,  304,  304,  305,  304,
+     302,  305,  303,  304,  303,  304,  302,  306,  302,  303,  301,  302,
+     304,  303,  302,  304,  302,  302,  303,  299,  302,  304,  302,  301,
+     303,  301,  303,  302,  300,  302,  302,  301,  304,  302,  303,  301,
+     302,  300,  301,  302,  300,  303,  303,  301,  302,  301,  300,  302,
+     301,  301,  302,  303,  302,  300,  301,  299,  301,  301,  300,  302,
+     300,  300,  297,  301,  301,  300,  298,  301,  299,  299,  301,  300,
+     296,  300,  300,  300,  299,  299,  300,  300,  300,  297,  299,  300,
+     301,  299,  298,  299,  303,  300,  299,  298,  300,  299,  301,  300,
+     297,  298,  299,  298,  297,  298,  299,  296,  298,  300,  301,  298,
+     299,  297,  299,  299,  299,  301,  298,  300,  301,  296,  299,  296,
+     300,  296,  299,  298,  300,  298,  299,  299,  298,  300,  298,  300,
+     298,  298,  299,  301,  298,  296,  297,  298,  298,  300,  297,  297,
+     297,  298,  296,  297,  297,  299,  297,  299,  296,  298,  298,  296,
+     296,  297,  295,  296,  299,  298,  297,  297,  295,  294,  296,  297,
+     298,  299,  299,  296,  295,  296,  295,  297,  296,  298,  297,  296,
+     296,  294,  297,  300,  298,  295,  295,  295,  297,  295,  298,  296,
+     300,  299,  295,  297,  296,  295,  296,  296,  299,  295,  297,  295,
+     296,  297,  299,  295,  298,  297,  295,  299,  298,  297,  299,  296,
+     298,  297,  297,  297,  298,  300,  295,  299,  299,  297,  297,  298,
+     296,  295,  296,  298,  297,  298,  294,  297,  300,  297,  299,  296,
+     298,  299,  298,  297,  296,  296,  295,  298,  296,  299,  301,  297,
+     300,  299,  300,  298,  300,  299,  299,  300,  297,  298,  297,  299,
+     298,  301,  299,  300,  298,  300,  301,  298,  299,  302,  300,  300,
+     301,  300,  301,  301,  298,  303,  299,  299,  298,  299,  300,  301,
+     299,  300,  302,  300,  298,  299,  299,  299,  301,  301,  301,  298,
+     302,  301,  299,  300,  303,  302,  300,  300,  303,  301,  300,  300,
+     302,  301,  302,  300,  302,  302,  300,  300,  303,  303,  301,  300,
+     300,  301,  304,  301,  304,  303,  300,  299,  302,  303,  303,  301,
+     302,  302,  299,  300,  303,  302,  302,  301,  306,  300,  302,  303,
+     304,  302,  302,  302,  307,  301,  304,  304,  305,  307,  301,  305,
+     304,  305,  305,  302,  303,  301,  303,  301,  303,  305,  303,  303,
+     303,  302,  302,  303,  305,  302,  302,  304,  304,  303,  304,  304,
+     302,  303,  305,  304,  303,  306,  303,  306,  305,  302,  302,  304,
+     303,  306,  304,  306,  304,  305,  303,  308,  305,  303,  303,  305,
+     305,  305,  303,  304,  305,  305,  302,  304,  304,  304,  305,  305,
+     305,  304,  305,  304,  303,  302,  302,  303,  306,  303,  302,  304,
+     304,  305,  304,  303,  303,  306,  304,  302,  302,  304,  303,  306,
+     307,  303,  307,  304,  305,  302,  303,  306,  302,  304,  307,  303,
+     303,  302,  305,  302,  305,  303,  305,  306,  302,  302,  304,  306,
+     305,  305,  304,  301,  304,  304,  304,  304,  304,  305,  306,  302,
+     301,  305,  301,  303,  304,  302,  304,  300,  303,  303,  306,  303,
+     303,  306,  302,  305,  302,  302,  302,  305,  302,  301,  303,  303,
+     302,  299,  303,  304,  304,  303,  303,  300,  299,  300,  303,  300,
+     303,  304,  301,  299,  303,  300,  297,  301,  299,  301,  299,  300,
+     302,  302,  302,  300,  301,  299,  300,  302,  301,  299,  300,  300,
+     302,  301,  301,  302,  303,  302,  300,  299,  300,  298,  299,  300,
+     302,  299,  300,  301,  302,  301,  299,  298,  299,  300,  300,  299,
+     299,  299,  299,  298,  299,  300,  299,  295,  299,  300,  300,  300,
+     299,  298,  297,  300,  301,  299,  295,  295,  299,  298,  298,  298,
+     296,  295,  300,  300,  298,  297,  299,  297,  295,  296,  299,  298,
+     299,  299,  296,  296,  298,  298,  298,  296,  297,  297,  297,  297,
+     298,  299,  298,  298,  298,  296,  300,  297,  296,  298,  296,  297,
+     296,  298,  299,  295,  299,  296,  298,  296,  298,  298,  297,  297,
+     296,  295,  295,  298,  299,  297,  296,  294,  296,  296,  295,  295,
+     296,  300,  296,  297,  297,  297,  299,  296,  295,  298,  295,  296,
+     298,  299,  296,  298,  296,  296,  296,  295,  297,  297,  298,  296,
+     297,  295,  296,  295,  296,  296,  298,  295,  298,  297,  297,  294,
+     296,  296,  299,  296,  298,  297,  294,  298,  297,  300,  298,  297,
+     295,  298,  297,  294,  298,  298,  296,  300,  296,  298,  296,  297,
+     297,  297,  298,  297,  297,  297,  299,  296,  301,  296,  298,  299,
+     299,  297,  296,  299,  298,  299,  299,  300,  300,  297,  298,  299,
+     300,  298,  298,  299,  298,  299,  299,  300,  299,  299,  299,  300,
+     298,  301,  298,  301,  300,  299,  301,  297,  298,  300,  298,  301,
+     300,  298,  298,  299,  298,  300,  300,  297,  301,  299,  303,  298,
+     298,  304,  301,  300,  298,  301,  297,  303,  299,  299,  299,  302,
+     301,  302,  302,  300,  301,  302,  303,  302,  300,  302,  301,  301,
+     303,  303,  299,  303,  302,  302,  300,  303,  302,  301,  301,  302,
+     303,  304,  303,  302,  305,  302,  304,  303,  303,  299,  302,  305,
+     303,  302,  302,  302,  306,  303,  303,  303,  303,  302,  305,  305,
+     302,  302,  305,  304,  302,  303,  302,  303,  303,  302,  304,  303,
+     305,  305,  304,  303,  305,  306,  304,  302,  304,  303,  304,  304,
+     303,  302,  303,  304,  303,  303,  304,  304,  301,  300,  302,  303,
+     302,  304,  303,  305,  304,  305,  304,  303,  303,  304,  305,  301,
+     303,  303,  305,  306,  305,  302,  308,  309,  304,  306,  305,  303,
+     305,  303,  305,  303,  305,  304,  302,  305,  306,  304,  304,  304,
+     306,  302,  302,  304,  302,  303,  305,  304,  304,  302,  303,  304,
+     307,  302,  305,  303,  301,  304,  305,  305,  306,  305,  306,  306,
+     301,  304,  304,  304,  305,  301,  304,  305,  304,  305,  305,  304,
+     306,  304,  304,  303,  304,  303,  302,  301,  306,  303,  307,  304,
+     304,  304,  302,  304,  304,  304,  304,  301,  302,  302,  304,  301,
+     305,  302,  305,  305,  303,  305,  303,  302,  301,  300,  303,  304,
+     301,  303,  304,  302,  300,  304,  302,  303,  301,  302,  301,  303,
+     303,  301,  302,  300,  302,  303,  304,  303,  303,  305,  300,  301,
+     300,  301,  301,  304,  301,  301,  300,  300,  301,  302,  301,  303,
+     300,  300,  301,  301,  301,  301,  299,  300,  300,  302,  302,  302,
+     302,  300,  299,  297,  302,  300,  299,  300,  299,  298,  299,  299,
+     301,  298,  301,  298,  297,  298,  297,  298,  299,  299,  302,  298,
+     301,  298,  297,  301,  297,  298,  299,  300,  301,  298,  300,  295,
+     298,  302,  300,  300,  299,  298,  298,  300,  296,  299,  299,  301,
+     298,  301,  300,  298,  298,  298,  295,  297,  300,  296,  295,  300,
+     296,  297,  300,  297,  296,  299,  299,  300,  297,  297,  296,  297,
+     295,  297,  298,  300,  296,  300,  296,  297,  294,  297,  298,  297,
+     296,  296,  296,  296,  298,  296,  297,  298,  296,  296,  298,  294,
+     296,  295,  296,  298,  296,  295,  296,  296,  295,  298,  297,  298,
+     297,  299,  299,  296,  299,  296,  295,  296,  296,  296,  297,  296,
+     297,  297,  297,  298,  296,  296,  296,  297,  295,  297,  297,  296,
+     297,  298,  297,  297,  299,  297,  299,  297,  297,  297,  296,  297,
+     295,  298,  295,  297,  296,  296,  299,  297,  294,  298,  295,  296,
+     299,  298,  297,  297,  297,  299,  298,  297,  298,  298,  299,  297,
+     297,  298,  295,  297,  298,  298,  297,  295,  298,  297,  301,  300,
+     298,  299,  299,  299,  300,  299,  300,  301,  299,  302,  298,  300,
+     299,  296,  301,  299,  296,  298,  298,  299,  299,  298,  298,  299,
+     301,  297,  298,  298,  301,  299,  298,  297,  302,  300,  298,  297,
+     299,  302,  300,  301,  299,  298,  300,  301,  299,  296,  301,  300,
+     298,  299,  302,  303,  298,  297,  303,  302,  302,  299,  303,  301,
+     302,  302,  300,  302,  298,  301,  302,  299,  299,  300,  300,  301,
+     302,  301,  303,  304,  300,  304,  302,  300,  301,  301,  304,  301,
+     303,  303,  303,  303,  303,  302,  302,  302,  302,  302,  304,  302,
+     300,  304,  301,  305,  303,  304,  301,  304,  301,  303,  302,  302,
+     302,  303,  304,  300,  302,  303,  301,  300,  306,  304,  301,  305,
+     305,  304,  304,  303,  305,  305,  302,  304,  303,  303,  304,  304,
+     304,  302,  303,  304,  305,  302,  304,  304,  303,  305,  303,  305,
+     301,  303,  303,  303,  304,  306,  305,  304,  303,  306,  306,  303,
+     305,  307,  302,  303,  303,  307,  304,  306,  302,  304,  306,  304,
+     303,  304,  303,  302,  306,  305,  303,  305,  305,  302,  303,  305,
+     303,  305,  307,  305,  305,  302,  302,  305,  305,  304,  302,  304,
+     305,  304,  302,  305,  305,  305,  302,  303,  304,  302,  305,  307,
+     304,  304,  303,  306,  305,  305,  306,  302,  305,  305,  303,  304,
+     304,  303,  304,  303,  304,  301,  305,  306,  304,  303,  303,  303,
+     303,  304,  303,  303,  303,  303,  302,  303,  303,  304,  303,  303,
+     304,  305,  303,  302,  303,  303,  303,  304,  304,  303,  303,  303,
+     301,  303,  302,  303,  302,  302,  301,  302,  301,  302,  300,  303,
+     302,  302,  304,  301,  302,  301,  302,  301,  302,  299,  301,  301,
+     300,  300,  303,  302,  302,  300,  300,  298,  302,  300,  298,  302,
+     299,  300,  303,  300,  303,  296,  301,  301,  299,  300,  298,  300,
+     303,  296,  302,  299,  299,  301,  300,  300,  300,  298,  297,  301,
+     300,  299,  298,  297,  299,  297,  297,  299,  295,  301,  297,  299,
+     299,  300,  300,  299,  299,  298,  299,  299,  298,  300,  300,  297,
+     301,  298,  299,  298,  299,  299,  298,  299,  298,  296,  297,  299,
+     302,  297,  298,  298,  297,  297,  299,  297,  300,  299,  297,  300,
+     295,  297,  296,  296,  298,  297,  296,  297,  296,  296,  298,  296,
+     298,  299,  298,  298,  299,  298,  293,  298,  301,  298,  296,  297,
+     297,  297,  297,  296,  297,  297,  300,  297,  294,  297,  297,  299,
+     299,  299,  299,  299,  298,  299,  296,  297,  295,  297,  297,  297,
+     296,  296,  295,  296,  296,  296,  297,  298,  300,  296,  296,  300,
+     296,  296,  297,  298,  298,  298,  295,  297,  296,  296,  298,  297,
+     297,  296,  302,  296,  296,  295,  297,  297,  298,  297,  299,  297,
+     298,  298,  294,  300,  298,  295,  296,  299,  296,  300,  298,  300,
+     299,  296,  297,  298,  298,  299,  296,  296,  296,  299,  297,  298,
+     296,  297,  297,  298,  299,  301,  299,  298,  300,  298,  297,  297,
+     301,  297,  296,  300,  298,  298,  297,  301,  298,  296,  300,  296,
+     299,  298,  297,  299,  300,  299,  298,  298,  298,  299,  302,  300,
+     300,  297,  296,  301,  300,  300,  300,  300,  298,  300,  299,  300,
+     301,  301,  299,  301,  303,  302,  300,  298,  299,  301,  300,  300,
+     301,  299,  301,  298,  300,  298,  303,  300,  299,  302,  298,  299,
+     300,  301,  302,  300,  302,  301,  300,  303,  304,  304,  301,  302,
+     303,  301,  303,  301,  301,  301,  302,  301,  301,  300,  302,  301,
+     301,  299,  301,  302,  301,  301,  302,  302,  304,  301,  301,  300,
+     303,  305,  304,  304,  302,  303,  301,  303,  303,  304,  302,  305,
+     304,  301,  303,  305,  303,  302,  302,  305,  303,  303,  301,  302,
+     302,  301,  304,  307,  304,  303,  301,  306,  304,  303,  306,  304,
+     303,  307,  304,  303,  304,  301,  305,  306,  304,  303,  305,  305,
+     300,  307,  303,  303,  303,  305,  302,  305,  303,  305,  303,  304,
+     304,  307,  304,  303,  306,  306,  303,  306,  302,  303,  306,  303,
+     304,  303,  305,  304,  304,  304,  305,  304,  305,  303,  305,  302,
+     305,  306,  304,  303,  303,  304,  304,  303,  302,  303,  305,  303,
+     302,  304,  303,  307,  303,  304,  305,  305,  299,  304,  303,  302,
+     306,  303,  304,  303,  305,  303,  304,  305,  306,  303,  304,  305,
+     303,  304,  301,  306,  303,  302,  303,  304,  300,  303,  305,  305,
+     304,  302,  303,  304,  303,  303,  304,  304,  305,  303,  302,  304,
+     302,  305,  301,  300,  302,  303,  303,  305,  303,  305,  301,  301,
+     305,  306,  303,  302,  302,  300,  303,  302,  302,  300,  303,  301,
+     302,  303,  302,  300,  303,  301,  301,  302,  300,  303,  300,  301,
+     301,  304,  299,  306,  300,  300,  302,  301,  300,  300,  299,  300,
+     300,  299,  301,  298,  300,  299,  299,  302,  300,  299,  300,  302,
+     300,  301,  301,  303,  299,  301,  300,  300,  298,  297,  300,  300,
+     299,  298,  297,  300,  300,  299,  301,  298,  301,  299,  300,  301,
+     299,  299,  298,  300,  299,  300,  301,  299,  299,  298,  296,  301,
+     299,  298,  297,  301,  295,  298,  296,  297,  297,  300,  295,  297,
+     300,  297,  299,  299,  300,  302,  298,  297,  297,  298,  294,  296,
+     295,  298,  297,  295,  296,  298,  294,  299,  299,  297,  298,  297,
+     297,  298,  296,  299,  298,  297,  296,  297,  298,  296,  296,  296,
+     298,  299,  298,  298,  294,  299,  298,  296,  301,  297,  296,  297,
+     298,  297,  299,  294,  297,  295,  298,  298,  298,  297,  294,  297,
+     298,  299,  296,  296,  296,  300,  297,  297,  295,  297,  299,  297,
+     297,  297,  297,  296,  300,  295,  298,  298,  298,  297,  298,  297,
+     297,  298,  295,  296,  297,  295,  297,  295,  299,  298,  298,  296,
+     297,  296,  300,  294,  299,  295,  297,  299,  298,  299,  300,  296,
+     298,  298,  296,  298,  297,  300,  299,  296,  298,  297,  296,  300,
+     296,  301,  297,  299,  297,  298,  298,  299,  302,  298,  296,  302,
+     300,  299,  298,  301,  298,  296,  300,  300,  298,  297,  299,  300,
+     299,  297,  301,  300,  301,  297,  301,  299,  299,  298,  301,  299,
+     303,  301,  298,  300,  299,  302,  298,  299,  300,  299,  298,  303,
+     300,  297,  302,  299,  298,  302,  302,  302,  297,  299,  299,  300,
+     299,  303,  302,  299,  302,  299,  298,  301,  299,  300,  303,  303,
+     303,  302,  299,  301,  302,  302,  302,  301,  302,  303,  300,  300,
+     301,  302,  301,  303,  300,  302,  300,  301,  301,  302,  299,  304,
+     302,  301,  303,  304,  304,  304,  302,  302,  302,  302,  304,  301,
+     301,  303,  300,  303,  303,  303,  305,  304,  303,  305,  303,  303,
+     303,  305,  304,  304,  304,  305,  302,  303,  304,  303,  303,  303,
+     302,  302,  302,  302,  303,  305,  301,  305,  302,  304,  302,  302,
+     304,  304,  305,  302,  305,  304,  304,  304,  305,  304,  304,  303,
+     305,  304,  305,  303,  302,  304,  303,  304,  305,  307,  306,  306,
+     303,  304,  303,  307,  305,  306,  302,  302,  306,  306,  302,  305,
+     303,  307,  303,  304,  305,  303,  306,  306,  302,  304,  304,  305,
+     305,  303,  301,  304,  305,  303,  305,  305,  305,  305,  303,  305,
+     304,  304,  303,  304,  305,  303,  307,  306,  304,  303,  304,  303,
+     305,  304,  304,  304,  304,  302,  303,  299,  304,  304,  303,  301,
+     303,  305,  302,  304,  304,  302,  305,  300,  301,  304,  304,  304,
+     300,  302,  301,  306,  302,  303,  303,  305,  301,  303,  304,  305,
+     300,  304,  304,  302,  300,  303,  302,  301,  301,  302,  304,  300,
+     302,  302,  303,  302,  301,  301,  299,  303,  299,  300,  302,  304,
+     300,  300,  300,  299,  297,  301,  302,  303,  298,  299,  302,  301,
+     303,  301,  300,  300,  299,  300,  301,  300,  299,  301,  303,  300,
+     302,  299,  302,  298,  302,  299,  299,  299,  304,  303,  300,  301,
+     302,  302,  299,  300,  300,  298,  302,  300,  300,  299,  297,  300,
+     298,  300,  302,  301,  300,  297,  298,  300,  298,  297,  299,  298,
+     298,  299,  299,  296,  299,  299,  301,  298,  298,  300,  299,  297,
+     300,  298,  300,  299,  297,  297,  295,  300,  297,  298,  298,  299,
+     297,  299,  299,  297,  299,  295,  300,  299,  299,  296,  298,  298,
+     300,  297,  297,  297,  297,  297,  298,  295,  299,  298,  300,  298,
+     296,  298,  297,  296,  297,  299,  299,  298,  298,  294,  297,  298,
+     295,  300,  294,  297,  295,  296,  296,  297,  297,  296,  298,  297,
+     296,  296,  294,  297,  296,  293,  295,  298,  296,  297,  297,  295,
+     297,  299,  295,  297,  298,  298,  294,  299,  297,  297,  296,  297,
+     296,  296,  297,  297,  300,  298,  295,  296,  297,  298,  297,  297,
+     297,  296,  296,  298,  300,  297,  296,  298,  296,  297,  300,  297,
+     295,  297,  298,  298,  299,  297,  300,  295,  298,  297,  298,  300,
+     297,  297,  298,  298,  297,  298,  297,  299,  296,  300,  297,  298,
+     297,  300,  298,  298,  297,  297,  298,  298,  299,  300,  299,  299,
+     299,  301,  298,  300,  299,  298,  299,  298,  300,  297,  300,  299,
+     299,  300,  298,  300,  300,  300,  299,  300,  302,  297,  299,  298,
+     299,  300,  299,  300,  300,  301,  299,  298,  300,  300,  300,  300,
+     301,  303,  302,  304,  299,  301,  301,  302,  300,  301,  300,  300,
+     301,  300,  302,  301,  301,  301,  302,  301,  302,  301,  301,  303,
+     301,  300,  301,  300,  302,  302,  302,  301,  301,  298,  301,  304,
+     299,  303,  304,  302,  300,  301,  304,  301,  302,  300,  302,  304,
+     303,  302,  305,  304,  306,  302,  304,  302,  303,  303,  303,  303,
+     305,  305,  303,  305,  302,  304,  305,  304,  305,  302,  305,  301,
+     303,  303,  304,  303,  303,  304,  304,  302,  302,  305,  304,  303,
+     305,  303,  304,  304,  307,  302,  302,  302,  304,  305,  303,  304,
+     303,  302,  303,  306,  304,  306,  306,  303,  305,  304,  303,  307,
+     304,  304,  303,  304,  302,  303,  304,  304,  304,  305,  305,  305,
+     307,  305,  307,  302,  303,  306,  303,  303,  307,  302,  304,  303,
+     302,  306,  305,  305,  304,  302,  306,  303,  304,  304,  306,  304,
+     303,  302,  303,  305,  305,  302,  306,  304,  305,  304,  303,  303,
+     303,  306,  304,  301,  303,  305,  304,  307,  302,  304,  303,  305,
+     305,  304,  304,  303,  304,  302,  302,  303,  304,  303,  305,  303,
+     308,  305,  301,  302,  303,  304,  303,  305,  302,  301,  303,  303,
+     303,  304,  304,  304,  303,  304,  303,  302,  302,  305,  300,  300,
+     303,  303,  304,  303,  301,  300,  301,  301,  301,  303,  303,  302,
+     300,  300,  304,  302,  301,  298,  303,  301,  299,  303,  300,  302,
+     301,  301,  302,  300,  302,  304,  301,  301,  299,  302,  301,  301,
+     301,  303,  301,  300,  304,  303,  300,  299,  298,  301,  297,  298,
+     298,  299,  299,  300,  301,  299,  298,  301,  301,  301,  298,  301,
+     300,  298,  300,  301,  298,  298,  302,  298,  302,  300,  300,  298,
+     296,  296,  302,  297,  298,  300,  298,  302,  301,  298,  297,  299,
+     301,  298,  295,  295,  298,  298,  298,  299,  297,  298,  295,  297,
+     299,  298,  294,  298,  298,  297,  299,  300,  299,  301,  296,  299,
+     298,  299,  296,  296,  299,  297,  299,  295,  298,  298,  297,  299,
+     297,  297,  295,  297,  298,  299,  297,  298,  295,  295,  296,  298,
+     295,  297,  292,  297,  298,  298,  297,  296,  297,  296,  297,  297,
+     296,  296,  296,  296,  297,  297,  298,  297,  296,  296,  296,  299,
+     295,  297,  298,  298,  299,  294,  300,  297,  296,  298,  298,  297,
+     296,  298,  299,  299,  296,  295,  297,  295,  296,  296,  298,  296,
+     298,  299,  298,  299,  296,  295,  296,  297,  298,  300,  298,  297,
+     297,  297,  296,  296,  298,  298,  297,  297,  297,  295,  298,  298,
+     298,  300,  299,  297,  297,  297,  295,  297,  297,  296,  297,  297,
+     296,  298,  298,  299,  297,  302,  298,  300,  296,  299,  298,  297,
+     298,  300,  301,  300,  299,  298,  298,  296,  303,  300,  297,  301,
+     301,  301,  296,  300,  297,  301,  300,  300,  301,  296,  299,  300,
+     300,  301,  300,  297,  301,  299,  300,  298,  299,  300,  299,  299,
+     300,  303,  300,  300,  302,  302,  297,  299,  298,  301,  302,  301,
+     300,  302,  300,  301,  300,  302,  304,  303,  303,  304,  301,  298,
+     302,  304,  303,  300,  303,  299,  303,  298,  302,  301,  301,  304,
+     299,  303,  298,  302,  304,  299,  301,  302,  301,  302,  302,  300,
+     304,  301,  300,  304,  303,  301,  302,  300,  299,  303,  304,  303,
+     303,  303,  301,  304,  302,  303,  303,  303,  301,  304,  302,  303,
+     301,  307,  302,  304,  306,  302,  306,  304,  305,  302,  302,  301,
+     303,  304,  303,  304,  304,  302,  301,  304,  303,  304,  304,  305,
+     304,  303,  306,  304,  303,  304,  302,  302,  304,  302,  304,  306,
+     304,  303,  306,  302,  308,  306,  304,  303,  306,  303,  302,  303,
+     307,  304,  304,  305,  301,  303,  303,  305,  303,  306,  303,  307,
+     302,  306,  306,  304,  304,  303,  306,  307,  305,  304,  304,  303,
+     305,  304,  306,  305,  304,  303,  303,  303,  304,  305,  304,  304,
+     306,  304,  305,  306,  307,  301,  303,  303,  305,  306,  301,  303,
+     304,  304,  303,  304,  303,  307,  301,  304,  303,  304,  302,  303,
+     303,  303,  306,  304,  304,  304,  300,  300,  304,  306,  303,  305,
+     304,  300,  303,  302,  304,  300,  304,  302,  304,  304,  302,  303,
+     302,  303,  304,  302,  303,  303,  299,  305,  301,  304,  302,  303,
+     302,  303,  302,  301,  304,  303,  302,  298,  304,  302,  302,  302,
+     301,  299,  301,  304,  305,  300,  301,  301,  298,  302,  302,  302,
+     300,  304,  300,  301,  303,  298,  300,  299,  301,  301,  300,  300,
+     301,  300,  301,  298,  301,  300,  301,  300,  301,  298,  302,  300,
+     300,  299,  299,  301,  302,  298,  299,  301,  298,  302,  297,  300,
+     302,  300,  300,  300,  301,  298,  299,  300,  298,  299,  299,  301,
+     297,  300,  297,  298,  301,  300,  299,  294,  299,  296,  298,  297,
+     298,  300,  299,  297,  297,  296,  298,  298,  297,  298,  297,  298,
+     299,  296,  301,  298,  300,  299,  298,  297,  297,  296,  296,  296,
+     295,  298,  296,  298,  297,  300,  295,  299,  294,  299,  298,  298,
+     298,  297,  297,  298,  296,  297,  298,  298,  298,  295,  296,  299,
+     293,  297,  298,  298,  295,  295,  297,  293,  297,  296,  297,  295,
+     298,  296,  297,  294,  297,  299,  298,  297,  297,  298,  297,  297,
+     295,  297,  299,  298,  299,  299,  297,  298,  296,  296,  298,  298,
+     296,  298,  297,  299,  300,  296,  296,  297,  298,  298,  295,  299,
+     298,  298,  299,  296,  298,  296,  298,  299,  297,  295,  295,  296,
+     296,  298,  296,  294,  298,  299,  297,  297,  300,  296,  299,  295,
+     297,  298,  299,  299,  299,  297,  298,  298,  298,  300,  298,  297,
+     299,  298,  299,  297,  299,  299,  296,  301,  296,  299,  299,  299,
+     298,  298,  299,  298,  298,  297,  299,  298,  296,  301,  299,  297,
+     300,  300,  296,  301,  300,  301,  299,  296,  302,  300,  300,  299,
+     300,  300,  296,  298,  298,  301,  299,  299,  302,  301,  302,  298,
+     298,  303,  301,  298,  299,  298,  302,  299,  302,  302,  300,  301,
+     302,  300,  302,  300,  302,  300,  301,  302,  303,  301,  302,  301,
+     302,  302,  300,  301,  304,  300,  303,  303,  301,  515,  740,  916,
+    1057, 1167, 1249, 1309, 1355, 1381, 1395, 1380, 1256, 1156, 1091, 1067,
+    1076, 1119, 1180, 1242, 1291, 1318, 1319, 1286, 1223, 1137, 1041,  942,
+     851,  778,  729,  703,  700,  711,  738,  760,  782,  788,  782,  762,
+     727,  682,  631,  582,  533,  501,  478,  465,  465,  473,  489,  504,
+     513,  516,  515,  506,  488,  466,  439,  416,  393,  379,  369,  366,
+     365,  372,  378,  392,  395,  400,  397,  394,  383,  372,  360,  350,
+     340,  331,  327,  324,  330,  331,  335,  339,  343,  347,  345,  342,
+     336,  335,  327,  323,  315,  311,  310,  311,  315,  315,  317,  320,
+     318,  322,  326,  322,  316,  315,  316,  310,  309,  307,  309,  306,
+     306,  309,  310,  310,  315,  309,  312,  311,  313,  308,  307,  305,
+     304,  307,  302,  305,  307,  306,  308,  308,  307,  303,  309,  307,
+     306,  305,  305,  304,  305,  308,  303,  302,  301,  304,  302,  305,
+     305,  304,  308,  306,  305,  306,  303,  302,  306,  305,  302,  302,
+     303,  304,  302,  304,  301,  304,  300,  302,  303,  302,  302,  303,
+     304,  300,  302,  302,  302,  302,  298,  303,  301,  302,  300,  302,
+     305,  303,  302,  302,  301,  303,  303,  302,  302,  301,  302,  300,
+     300,  300,  301,  301,  301,  301,  303,  300,  302,  301,  302,  301,
+     300,  305,  302,  301,  300,  301,  301,  301,  302,  302,  299,  299,
+     298,  301,  298,  303,  299,  299,  299,  300,  302,  303,  301,  299,
+     300,  297,  299,  299,  299,  299,  301,  302,  299,  300,  302,  296,
+     301,  299,  298,  298,  298,  300,  300,  299,  297,  300,  298,  299,
+     299,  301,  297,  298,  297,  300,  297,  299,  294,  297,  301,  297,
+     298,  298,  298,  298,  296,  298,  297,  299,  298,  299,  298,  301,
+     293,  294,  298,  297,  299,  298,  298,  296,  296,  299,  299,  301,
+     298,  297,  296,  299,  299,  299,  298,  298,  294,  297,  298,  296,
+     297,  299,  297,  296,  296,  296,  296,  295,  298,  299,  297,  298,
+     296,  299,  300,  301,  297,  297,  300,  296,  296,  300,  299,  298,
+     298,  298,  297,  298,  299,  297,  297,  298,  294,  296,  299,  295,
+     296,  296,  299,  296,  297,  299,  297,  296,  298,  299,  298,  295,
+     297,  296,  294,  295,  298,  298,  296,  298,  298,  298,  296,  297,
+     297,  296,  297,  297,  297,  298,  296,  298,  297,  297,  298,  296,
+     297,  295,  298,  298,  301,  298,  299,  295,  296,  298,  298,  299,
+     299,  298,  299,  300,  296,  296,  296,  299,  297,  298,  299,  297,
+     300,  298,  297,  300,  298,  299,  298,  296,  298,  297,  300,  299,
+     300,  300,  296,  297,  298,  297,  300,  299,  299,  298,  297,  299,
+     299,  301,  297,  299,  298,  301,  299,  297,  299,  300,  301,  299,
+     298,  301,  298,  301,  301,  301,  299,  302,  301,  301,  300,  299,
+     300,  302,  297,  299,  296,  298,  299,  302,  299,  303,  302,  301,
+     302,  302,  300,  305,  301,  300,  300,  303,  302,  301,  302,  300,
+     298,  303,  302,  304,  302,  301,  301,  302,  302,  299,  302,  301,
+     301,  301,  302,  303,  303,  300,  302,  300,  301,  302,  305,  305,
+     302,  301,  305,  302,  302,  305,  304,  304,  302,  301,  304,  302,
+     302,  303,  303,  303,  302,  303,  302,  302,  303,  301,  303,  303,
+     300,  302,  302,  306,  303,  304,  305,  304,  302,  303,  305,  305,
+     303,  302,  304,  303,  304,  305,  303,  305,  304,  306,  304,  306,
+     304,  304,  302,  301,  304,  306,  305,  303,  301,  307,  303,  306,
+     303,  302,  306,  305,  303,  304,  306,  304,  305,  302,  300,  304,
+     306,  305,  306,  307,  306,  307,  304,  306,  304,  305,  305,  304,
+     305,  305,  304,  305,  302,  303,  306,  302,  303,  303,  303,  304,
+     301,  305,  303,  304,  305,  305,  304,  302,  302,  304,  305,  305,
+     301,  304,  304,  305,  302,  304,  302,  304,  303,  303,  303,  303,
+     303,  303,  304,  305,  303,  303,  302,  304,  302,  305,  302,  304,
+     302,  304,  303,  303,  304,  302,  303,  303,  304,  304,  300,  302,
+     303,  303,  304,  303,  303,  305,  302,  302,  301,  300,  304,  304,
+     302,  301,  301,  301,  302,  300,  304,  302,  304,  302,  301,  302,
+     302,  302,  299,  301,  303,  303,  302,  303,  304,  299,  300,  300,
+     302,  300,  301,  301,  300,  300,  300,  300,  300,  301,  298,  301,
+     299,  300,  301,  300,  301,  301,  299,  303,  299,  302,  301,  300,
+     300,  301,  300,  299,  298,  300,  298,  300,  301,  302,  297,  301,
+     300,  300,  300,  301,  298,  299,  301,  300,  298,  300,  301,  299,
+     297,  298,  297,  295,  299,  300,  300,  299,  298,  298,  301,  299,
+     302,  298,  298,  299,  300,  298,  298,  298,  297,  300,  299,  299,
+     298,  299,  298,  295,  299,  298,  300,  297,  295,  298,  298,  298,
+     297,  298,  298,  297,  296,  298,  299,  293,  298,  297,  296,  296,
+     298,  297,  297,  298,  299,  296,  298,  298,  297,  295,  296,  294,
+     296,  298,  297,  298,  300,  296,  297,  298,  296,  297,  298,  298,
+     297,  295,  299,  298,  299,  299,  299,  299,  295,  296,  296,  298,
+     295,  297,  298,  298,  296,  294,  299,  296,  297,  297,  299,  296,
+     296,  298,  300,  297,  298,  299,  296,  297,  299,  297,  298,  296,
+     298,  297,  297,  297,  299,  299,  298,  295,  298,  299,  295,  299,
+     299,  298,  299,  298,  300,  300,  296,  297,  295,  299,  298,  295,
+     298,  295,  298,  300,  295,  294,  295,  299,  298,  298,  296,  295,
+     300,  298,  298,  299,  300,  297,  298,  295,  298,  296,  300,  298,
+     297,  299,  300,  298,  297,  299,  299,  300,  298,  299,  298,  301,
+     299,  299,  296,  299,  299,  298,  302,  299,  298,  297,  301,  300,
+     302,  299,  298,  297,  300,  300,  299,  299,  300,  300,  301,  300,
+     297,  299,  301,  299,  296,  298,  301,  298,  300,  298,  301,  299,
+     301,  302,  299,  300,  302,  301,  301,  302,  304,  299,  300,  303,
+     301,  302,  304,  304,  302,  300,  303,  299,  300,  301,  305,  304,
+     304,  298,  300,  299,  300,  303,  301,  302,  300,  306,  301,  302,
+     302,  303,  304,  304,  305,  302,  303,  303,  305,  303,  302,  302,
+     303,  304,  301,  305,  302,  303,  302,  303,  303,  301,  302,  303,
+     306,  306,  300,  303,  302,  302,  305,  303,  303,  305,  302,  303,
+     307,  304,  300,  304,  300,  305,  305,  305,  303,  303,  302,  304,
+     302,  301,  304,  303,  302,  304,  306,  306,  303,  306,  302,  302,
+     304,  303,  302,  308,  305,  306,  306,  303,  306,  303,  303,  304,
+     303,  303,  304,  305,  304,  304,  303,  305,  306,  304,  307,  304,
+     302,  304,  306,  303,  304,  304,  305,  303,  304,  303,  306,  304,
+     303,  305,  306,  302,  305,  303,  303,  306,  304,  304,  302,  302,
+     304,  303,  306,  307,  304,  304,  305,  304,  303,  308,  303,  303,
+     303,  303,  305,  305,  305,  303,  302,  303,  302,  303,  304,  302,
+     304,  304,  305,  300,  306,  304,  303,  300,  304,  302,  302,  304,
+     306,  304,  303,  303,  305,  303,  303,  303,  302,  300,  304,  301,
+     303,  302,  303,  302,  307,  301,  306,  302,  299,  302,  302,  303,
+     302,  304,  303,  302,  303,  299,  303,  300,  302,  300,  299,  303,
+     302,  300,  302,  305,  303,  300,  300,  302,  301,  300,  301,  300,
+     299,  297,  298,  301,  297,  303,  301,  301,  301,  302,  298,  303,
+     302,  303,  297,  301,  298,  296,  299,  302,  301,  301,  301,  302,
+     302,  300,  300,  300,  302,  301,  300,  301,  299,  299,  301,  301,
+     301,  300,  301,  296,  296,  300,  300,  299,  298,  300,  300,  298,
+     300,  299,  299,  298,  296,  299,  297,  297,  300,  298,  299,  301,
+     297,  299,  298,  300,  299,  299,  299,  302,  298,  298,  294,  298,
+     299,  297,  298,  301,  297,  297,  297,  293,  300,  296,  297,  297,
+     297,  297,  300,  297,  297,  297,  299,  296,  295,  301,  295,  299,
+     299,  298,  299,  299,  299,  297,  298,  296,  300,  299,  301,  298,
+     297,  296,  296,  298,  298,  299,  298,  295,  298,  298,  298,  298,
+     297,  297,  297,  297,  295,  299,  298,  296,  297,  297,  298,  297,
+     296,  297,  293,  296,  297,  296,  297,  297,  298,  296,  297,  298,
+     298,  299,  297,  297,  297,  298,  296,  297,  297,  294,  299,  299,
+     296,  298,  296,  296,  295,  296,  298,  296,  299,  297,  300,  297,
+     299,  297,  296,  299,  297,  298,  297,  297,  299,  296,  298,  299,
+     298,  297,  296,  296,  300,  298,  297,  295,  300,  297,  296,  299,
+     298,  298,  298,  299,  300,  301,  300,  300,  295,  298,  298,  297,
+     299,  297,  296,  297,  302,  301,  298,  297,  300,  296,  299,  298,
+     297,  298,  300,  298,  299,  297,  301,  296,  299,  300,  302,  300,
+     301,  299,  299,  299,  298,  301,  301,  300,  302,  300,  301,  301,
+     299,  303,  300,  300,  298,  300,  301,  302,  299,  303,  299,  300,
+     301,  298,  300,  301,  299,  301,  298,  302,  302,  300,  300,  303,
+     303,  301,  302,  302,  303,  302,  299,  302,  301,  303,  301,  303,
+     302,  302,  303,  302,  303,  306,  301,  302,  303,  301,  301,  302,
+     304,  304,  303,  303,  303,  304,  304,  304,  303,  302,  304,  301,
+     305,  304,  300,  306,  304,  302,  303,  303,  301,  305,  305,  303,
+     305,  303,  303,  305,  303,  306,  303,  305,  303,  302,  304,  305,
+     304,  303,  302,  301,  303,  306,  304,  303,  301,  307,  303,  302,
+     305,  303,  304,  304,  303,  306,  305,  304,  302,  302,  305,  305,
+     304,  304,  305,  305,  305,  303,  306,  304,  305,  303,  304,  304,
+     305,  306,  304,  304,  304,  305,  302,  306,  305,  305,  302,  302,
+     305,  305,  302,  306,  300,  304,  304,  305,  303,  307,  304,  303,
+     303,  304,  304,  306,  305,  303,  305,  303,  305,  301,  305,  306,
+     307,  305,  306,  302,  303,  305,  302,  304,  308,  305,  306,  302,
+     304,  303,  304,  304,  303,  303,  305,  303,  308,  304,  305,  305,
+     302,  305,  305,  303,  304,  304,  305,  303,  303,  301,  303,  305,
+     304,  305,  305,  304,  305,  304,  301,  302,  301,  302,  301,  304,
+     301,  300,  302,  304,  302,  302,  305,  300,  302,  303,  301,  304,
+     303,  304,  301,  302,  302,  303,  302,  304,  303,  302,  301,  302,
+     304,  301,  303,  303,  299,  302,  301,  303,  301,  302,  304,  301,
+     301,  302,  302,  300,  302,  301,  301,  302,  300,  301,  300,  300,
+     300,  300,  302,  302,  301,  301,  298,  300,  301,  299,  300,  298,
+     301,  299,  302,  303,  300,  303,  303,  297,  300,  298,  298,  297,
+     297,  301,  299,  299,  299,  299,  300,  298,  299,  297,  299,  297,
+     296,  302,  299,  299,  300,  302,  297,  299,  299,  296,  297,  296,
+     298,  297,  296,  296,  296,  300,  300,  299,  297,  300,  298,  297,
+     296,  300,  299,  298,  299,  300,  297,  295,  300,  296,  296,  297,
+     297,  299,  300,  295,  297,  296,  299,  295,  296,  295,  298,  298,
+     297,  298,  297,  295,  296,  295,  298,  295,  298,  297,  295,  298,
+     298,  298,  296,  299,  296,  297,  296,  295,  292,  296,  298,  295,
+     297,  298,  296,  297,  300,  299,  297,  298,  298,  295,  297,  296,
+     295,  296,  297,  295,  297,  297,  295,  302,  297,  296,  297,  295,
+     297,  296,  295,  298,  296,  294,  296,  295,  298,  299,  297,  299,
+     295,  298,  296,  298,  298,  298,  299,  298,  296,  296,  298,  298,
+     297,  296,  295,  297,  297,  297,  296,  298,  299,  297,  298,  298,
+     297,  297,  299,  297,  298,  298,  299,  298,  300,  296,  297,  296,
+     296,  296,  298,  300,  301,  300,  297,  298,  296,  296,  300,  298,
+     299,  297,  298,  299,  300,  297,  299,  298,  298,  297,  300,  299,
+     300,  297,  300,  301,  301,  298,  301,  301,  300,  302,  299,  299,
+     298,  300,  302,  301,  300,  300,  299,  302,  301,  300,  301,  297,
+     301,  300,  301,  301,  301,  302,  299,  299,  302,  299,  302,  302,
+     302,  303,  302,  302,  302,  299,  301,  299,  302,  301,  301,  302,
+     303,  305,  303,  301,  299,  301,  300,  305,  300,  299,  302,  299,
+     303,  301,  299,  302,  302,  303,  302,  303,  301,  303,  305,  301,
+     304,  302,  300,  301,  304,  305,  301,  304,  304,  303,  303,  301,
+     303,  304,  304,  304,  303,  304,  301,  303,  302,  303,  304,  303,
+     306,  307,  304,  304,  302,  303,  305,  306,  301,  304,  303,  303,
+     306,  301,  305,  303,  304,  305,  305,  305,  304,  304,  306,  306,
+     304,  304,  302,  305,  303,  303,  306,  306,  304,  305,  304,  304,
+     303,  305,  304,  304,  302,  304,  305,  303,  308,  303,  306,  303,
+     305,  306,  305,  305,  302,  303,  303,  303,  304,  304,  306,  305,
+     307,  305,  308,  307,  306,  304,  302,  304,  304,  304,  303,  303,
+     307,  306,  306,  300,  305,  303,  304,  305,  305,  304,  305,  300,
+     305,  304,  306,  305,  301,  302,  305,  305,  305,  304,  305,  303,
+     304,  304,  304,  302,  304,  304,  305,  304,  303,  302,  302,  306,
+     304,  303,  303,  303,  302,  303,  303,  302,  306,  303,  303,  304,
+     302,  301,  305,  304,  303,  302,  301,  303,  303,  303,  301,  301,
+     301,  301,  302,  302,  303,  303,  300,  302,  301,  301,  301,  300,
+     300,  303,  301,  303,  303,  299,  303,  299,  302,  302,  300,  302,
+     302,  305,  304,  301,  304,  299,  302,  301,  300,  298,  302,  300,
+     301,  298,  299,  300,  301,  300,  301,  300,  301,  301,  300,  301,
+     301,  300,  298,  300,  302,  301,  298,  297,  299,  300,  299,  300,
+     298,  298,  302,  300,  297,  301,  299,  298,  298,  297,  298,  300,
+     299,  298,  302,  297,  297,  299,  301,  299,  297,  297,  300,  299,
+     296,  300,  298,  299,  298,  297,  299,  299,  297,  300,  300,  296,
+     300,  298,  300,  300,  296,  298,  299,  299,  297,  299,  297,  299,
+     298,  300,  299,  298,  294,  300,  300,  295,  296,  299,  295,  299,
+     298,  298,  296,  297,  296,  296,  297,  296,  294,  296,  297,  299,
+     298,  296,  298,  298,  299,  298,  298,  295,  297,  296,  295,  296,
+     297,  297,  298,  299,  297,  296,  297,  298,  298,  297,  299,  300,
+     295,  298,  297,  295,  296,  296,  298,  302,  295,  296,  299,  297,
+     297,  300,  297,  296,  296,  295,  299,  296,  298,  299,  297,  296,
+     302,  298,  297,  297,  300,  298,  296,  298,  302,  295,  298,  299,
+     296,  300,  296,  297,  298,  298,  295,  296,  296,  300,  296,  296,
+     298,  297,  296,  300,  297,  298,  297,  299,  297,  297,  296,  300,
+     296,  298,  298,  298,  296,  300,  296,  298,  297,  301,  302,  298,
+     299,  301,  299,  299,  298,  298,  295,  299,  299,  300,  302,  299,
+     300,  298,  298,  297,  302,  297,  299,  299,  299,  299,  301,  300,
+     298,  299,  299,  301,  302,  300,  300,  300,  302,  300,  299,  299,
+     300,  299,  299,  300,  301,  301,  301,  301,  299,  300,  299,  302,
+     302,  304,  299,  298,  304,  299,  299,  301,  301,  300,  300,  300,
+     299,  301,  303,  301,  300,  301,  303,  301,  301,  302,  303,  304,
+     302,  302,  300,  301,  302,  303,  303,  301,  302,  300,  303,  303,
+     302,  303,  303,  302,  304,  301,  303,  304,  300,  301,  305,  303,
+     300,  301,  302,  303,  299,  301,  301,  304,  302,  304,  303,  304,
+     303,  304,  304,  304,  302,  299,  304,  305,  301,  304,  305,  303,
+     303,  305,  302,  304,  301,  301,  305,  303,  304,  305,  305,  304,
+     305,  306,  304,  302,  304,  305,  304,  304,  302,  305,  304,  305,
+     303,  303,  306,  303,  304,  304,  304,  304,  305,  303,  304,  304,
+     304,  302,  307,  306,  305,  304,  304,  304,  304,  303,  301,  305,
+     305,  304,  306,  304,  302,  302,  307,  304,  304,  303,  303,  305,
+     303,  304,  305,  307,  303,  304,  303,  303,  304,  302,  305,  309,
+     305,  303,  304,  305,  303,  304,  304,  306,  302,  307,  303,  304,
+     305,  304,  301,  303,  305,  306,  303,  303,  301,  304,  304,  302,
+     302,  304,  303,  301,  305,  302,  303,  300,  305,  304,  303,  303,
+     307,  303,  304,  302,  304,  305,  303,  299,  303,  303,  302,  302,
+     302,  303,  305,  306,  303,  303,  304,  302,  302,  303,  303,  302,
+     304,  302,  302,  302,  301,  306,  300,  304,  302,  302,  305,  303,
+     303,  302,  301,  302,  300,  303,  301,  301,  301,  303,  300,  301,
+     299,  299,  302,  303,  302,  303,  302,  301,  301,  302,  303,  298,
+     299,  303,  304,  302,  299,  301,  300,  302,  300,  299,  302,  301,
+     301,  301,  301,  301,  301,  299,  299,  299,  299,  300,  302,  299,
+     301,  299,  298,  300,  299,  300,  298,  300,  300,  298,  300,  301,
+     299,  299,  300,  298,  297,  300,  298,  298,  299,  299,  299,  299,
+     299,  298,  299,  301,  299,  301,  297,  298,  299,  296,  297,  297,
+     298,  301,  298,  302,  298,  297,  296,  296,  297,  298,  296,  298,
+     300,  297,  296,  300,  296,  298,  299,  298,  296,  298,  296,  294,
+     296,  295,  299,  298,  295,  298,  297,  298,  293,  300,  298,  297,
+     297,  297,  297,  299,  297,  294,  296,  298,  298,  298,  296,  297,
+     295,  294,  294,  297,  296,  298,  299,  298,  296,  294,  298,  297,
+     297,  299,  298,  299,  296,  296,  297,  297,  295,  296,  295,  295,
+     297,  297,  297,  297,  298,  294,  298,  296,  298,  296,  299,  295,
+     297,  299,  297,  297,  297,  299,  297,  295,  298,  299,  298,  297,
+     296,  299,  295,  296,  298,  297,  300,  300,  298,  299,  296,  297,
+     297,  299,  296,  297,  300,  300,  297,  300,  296,  300,  299,  298,
+     298,  299,  299,  297,  298,  297,  299,  298,  299,  296,  297,  299,
+     300,  301,  297,  295,  297,  299,  300,  298,  298,  299,  298,  299,
+     300,  302,  294,  298,  300,  300,  298,  298,  299,  303,  297,  298,
+     297,  300,  299,  300,  298,  299,  300,  301,  300,  301,  302,  299,
+     298,  299,  301,  302,  300,  303,  301,  299,  302,  300,  300,  301,
+     301,  298,  301,  300,  303,  301,  299,  300,  301,  300,  303,  301,
+     299,  302,  303,  301,  302,  304,  302,  300,  302,  300,  303,  302,
+     302,  302,  301,  303,  301,  304,  302,  301,  305,  303,  302,  302,
+     304,  302,  306,  303,  303,  302,  305,  301,  301,  303,  301,  302,
+     301,  304,  301,  303,  303,  305,  304,  303,  303,  302,  306,  305,
+     304,  304,  302,  302,  305,  304,  304,  301,  302,  303,  302,  304,
+     303,  301,  304,  300,  304,  301,  304,  305,
+};
@@ -0,0 +1,13 @@
+#ifndef __BENCHBLOCKS_H
+#define __BENCHBLOCKS_H
+
+#include <stdint.h>
+
+/*
+ * 基准测试的固定输入（BenchBlocks.c由Tools/bench_blocks.py生成）
+ *   bench_block_count个DETECTOR_BLOCK_SAMPLES样本的DMA块，按顺序存放
+ */
+extern const uint16_t bench_block_count;
+extern const uint16_t bench_samples[];
+
+#endif
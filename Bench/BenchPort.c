@@ -0,0 +1,166 @@
+#include "BenchPort.h"
+
+#define SYST_CSR        (*(volatile uint32_t *)0xE000E010)
+#define SYST_RVR        (*(volatile uint32_t *)0xE000E014)
+#define SYST_CVR        (*(volatile uint32_t *)0xE000E018)
+#define SYST_CSR_ENABLE     0x1u
+#define SYST_CSR_CLKSOURCE  0x4u         // 处理器时钟（lm3s6965evb的参考时钟在QEMU中未接）
+#define SYST_MASK       0x00FFFFFFu
+
+#define SEMIHOST_SYS_WRITE0     0x04
+#define SEMIHOST_SYS_EXIT       0x18
+#define ADP_STOPPED_APPLICATION_EXIT    0x20026
+#define ADP_STOPPED_RUNTIME_ERROR       0x20023
+
+extern uint32_t _sidata, _sdata, _edata, _sbss, _ebss, __initial_sp;
+extern int main(void);
+
+static uint32_t calib_cycles;            // 标定区间的指令数
+static uint32_t calib_ticks;             // 标定区间的SysTick节拍数
+static uint32_t overhead_ticks;          // 空测量区间的节拍数（从每次测量中扣除）
+
+static uint32_t Semihost_Call(uint32_t op, const void *arg)
+{
+    register uint32_t r0 __asm("r0") = op;
+    register const void *r1 __asm("r1") = arg;
+
+    __asm volatile ("bkpt 0xAB" : "+r"(r0) : "r"(r1) : "memory");
+    return r0;
+}
+
+/* 执行2*loops条指令 */
+static void __attribute__((noinline)) BenchPort_Spin(uint32_t loops)
+{
+    __asm volatile ("1: subs %0, %0, #1\n\tbne 1b" : "+r"(loops) : : "cc");
+}
+
+static uint32_t BenchPort_Ticks(uint32_t start)
+{
+    return (start - SYST_CVR) & SYST_MASK;
+}
+
+/**
+  * @brief  启动SysTick并标定节拍与指令数的比例
+  * @note   两种长度的空循环相减，消去调用与读数本身的开销
+  */
+void BenchPort_Init(void)
+{
+    uint32_t start, t1, t2;
+
+    SYST_RVR = SYST_MASK;
+    SYST_CVR = 0;
+    SYST_CSR = SYST_CSR_ENABLE | SYST_CSR_CLKSOURCE;
+
+    start = BenchPort_Now();
+    BenchPort_Spin(BENCHPORT_CALIB_LOOPS);
+    t1 = BenchPort_Ticks(start);
+    start = BenchPort_Now();
+    BenchPort_Spin(2u * BENCHPORT_CALIB_LOOPS);
+    t2 = BenchPort_Ticks(start);
+    calib_cycles = 2u * BENCHPORT_CALIB_LOOPS;
+    calib_ticks = (t2 > t1) ? t2 - t1 : 1u;
+
+    start = BenchPort_Now();
+    overhead_ticks = BenchPort_Ticks(start);
+}
+
+/* 测量区间起点（SysTick当前值） */
+uint32_t BenchPort_Now(void)
+{
+    return SYST_CVR;
+}
+
+/**
+  * @brief  从start到现在的周期数
+  * @param  start BenchPort_Now的返回值
+  * @retval 扣除测量开销后的周期数（四舍五入）
+  */
+uint32_t BenchPort_Cycles(uint32_t start)
+{
+    uint32_t ticks = BenchPort_Ticks(start);
+
+    ticks = (ticks > overhead_ticks) ? ticks - overhead_ticks : 0;
+    return (uint32_t)(((uint64_t)ticks * calib_cycles + calib_ticks / 2u) / calib_ticks);
+}
+
+void BenchPort_Print(const char *s)
+{
+    Semihost_Call(SEMIHOST_SYS_WRITE0, s);
+}
+
+/* 输出一行 key=value */
+void BenchPort_PrintValue(const char *key, uint32_t value)
+{
+    char line[48];
+    char digits[10];
+    uint8_t n = 0, i = 0;
+
+    while (key[i] != '\0' && i < sizeof(line) - 13)
+    {
+        line[i] = key[i];
+        i++;
+    }
+    line[i++] = '=';
+    do
+    {
+        digits[n++] = (char)('0' + value % 10u);
+        value /= 10u;
+    } while (value != 0);
+    while (n > 0)
+        line[i++] = digits[--n];
+    line[i++] = '\n';
+    line[i] = '\0';
+    BenchPort_Print(line);
+}
+
+/**
+  * @brief  结束运行（QEMU随之退出）
+  * @param  ok 1：退出码0；0：退出码1
+  */
+void BenchPort_Exit(uint8_t ok)
+{
+    Semihost_Call(SEMIHOST_SYS_EXIT,
+                  (const void *)(uintptr_t)(ok ? ADP_STOPPED_APPLICATION_EXIT : ADP_STOPPED_RUNTIME_ERROR));
+    while (1)
+    {
+    }
+}
+
+/* ---------------- 启动 ---------------- */
+
+void Reset_Handler(void)
+{
+    uint32_t *src = &_sidata;
+    uint32_t *dst;
+
+    for (dst = &_sdata; dst < &_edata; )
+        *dst++ = *src++;
+    for (dst = &_sbss; dst < &_ebss; )
+        *dst++ = 0;
+    BenchPort_Exit(main() == 0);
+}
+
+/* 任何异常都视为基准程序出错，立即结束，避免QEMU空转到超时 */
+static void Fault_Handler(void)
+{
+    BenchPort_Print("bench_fault=1\n");
+    BenchPort_Exit(0);
+}
+
+__attribute__((section(".isr_vector"), used))
+static void (*const bench_vectors[16])(void) =
+{
+    (void (*)(void))&__initial_sp,
+    Reset_Handler,
+    Fault_Handler,                       // NMI
+    Fault_Handler,                       // HardFault
+    Fault_Handler,                       // MemManage
+    Fault_Handler,                       // BusFault
+    Fault_Handler,                       // UsageFault
+    0, 0, 0, 0,
+    Fault_Handler,                       // SVCall
+    Fault_Handler,                       // DebugMon
+    0,
+    Fault_Handler,                       // PendSV
+    Fault_Handler,                       // SysTick（未开中断，不应进入）
+};
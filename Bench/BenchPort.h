@@ -0,0 +1,23 @@
+#ifndef __BENCHPORT_H
+#define __BENCHPORT_H
+
+#include <stdint.h>
+
+/*
+ * QEMU Cortex-M3基准测试的平台层（lm3s6965evb，启动、计时与半主机输出）
+ *   计时：SysTick（处理器时钟）自由运行，24位向下计数；QEMU -icount下虚拟时钟按执行的指令推进，
+ *     读数与宿主机负载无关、每次运行相同。启动时用已知指令数的空循环标定，
+ *     BenchPort_Cycles把节拍换算为周期（QEMU按每条指令1个周期计，不模拟流水线停顿与Flash等待）
+ *   输出：ARM半主机SYS_WRITE0，运行须带 -semihosting-config enable=on,target=native
+ *   单次测量区间须短于2^24个节拍
+ */
+#define BENCHPORT_CALIB_LOOPS   65536u   // 标定循环次数（每次2条指令）
+
+void BenchPort_Init(void);
+uint32_t BenchPort_Now(void);
+uint32_t BenchPort_Cycles(uint32_t start);
+void BenchPort_Print(const char *s);
+void BenchPort_PrintValue(const char *key, uint32_t value);
+void BenchPort_Exit(uint8_t ok);
+
+#endif
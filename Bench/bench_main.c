@@ -0,0 +1,245 @@
+/*
+ * Cortex-M3周期基准：在QEMU lm3s6965evb上以-icount确定性计时运行固件的检测链
+ *
+ * 输入：BenchBlocks.c中的固定样本块，循环送入BENCH_PASSES遍，时序与Host/Replay.c相同
+ *   （每块先做模拟看门狗判断再调用Detector_ProcessBlock，采样时间每过10ms执行一次主循环）
+ * 测量（BenchPort计时，单位为周期）：
+ *   isr_block      每个50样本DMA块的Detector_ProcessBlock（采样中断中的检测部分）
+ *   isr_capture    其中快照采集进行中的块
+ *   validate       每个快照的判定（DropCounter_Judge，不含事件级死区内直接丢弃的快照）
+ *   threshold      每次自适应阈值更新（Threshold_Update）
+ *   display        每次显示刷新（UI_Render：渲染到帧缓冲+脏块整理，OLED_BUS_NONE不发送）；
+ *                  每BENCH_DISPLAY_PER_PAGE次刷新翻一页，各页另有display_<页名>
+ * 输出：每项的次数/平均/最大（<项>_n、<项>_mean、<项>_max），以及检测漏斗计数，
+ *   以key=value逐行经半主机输出，由Tools/rain_bench.py与Bench/baseline.txt比较
+ */
+#include <stdint.h>
+#include "BenchPort.h"
+#include "BenchBlocks.h"
+#include "CoreHal.h"
+#include "Detector.h"
+#include "Threshold.h"
+#include "DropCounter.h"
+#include "DropSize.h"
+#include "RainStats.h"
+#include "Arena.h"
+#include "UI.h"
+#include "Key.h"
+
+#define BENCH_PASSES            21       // 样本块循环遍数（238块×21 ≈ 10s采样时间）
+#define BENCH_LOOP_US           10000    // 主循环周期（与main.c一致）
+#define BENCH_DISPLAY_LOOPS     20       // 每20次主循环刷新一次显示（200ms，与main.c一致）
+#define BENCH_DISPLAY_PER_PAGE  10       // 每页刷新次数
+
+typedef struct
+{
+    uint32_t n;
+    uint32_t max;
+    uint64_t total;
+} BenchStat;
+
+static BenchStat stat_isr_block;
+static BenchStat stat_isr_capture;
+static BenchStat stat_validate;
+static BenchStat stat_threshold;
+static BenchStat stat_display;
+static BenchStat stat_page[UI_PAGE_COUNT];
+
+static const char *const page_names[UI_PAGE_COUNT] =
+{
+    "display_live", "display_trend", "display_dsd", "display_noise", "display_counters"
+};
+
+static uint16_t awd_threshold;           // 模拟看门狗上限（固件AD_SetThreshold）
+static uint8_t pending_key;              // 下次Key_GetEvent返回的按键
+static uint32_t sum_cv;                  // 实时页累计电压（0.01V）
+
+/* UI.c引用的主程序变量 */
+volatile uint32_t watchdog_trigger_count = 0;
+
+/* 按键由基准程序注入（代替Key.c的TIM2扫描） */
+uint8_t Key_GetEvent(void)
+{
+    uint8_t ev = pending_key;
+
+    pending_key = KEY_NONE;
+    return ev;
+}
+
+static void Hal_SetThreshold(void *user, uint16_t threshold)
+{
+    (void)user;
+    awd_threshold = threshold;
+}
+
+static const CoreHal bench_hal = { 0, 0, Hal_SetThreshold, 0, 0 };
+
+static void Stat_Add(BenchStat *s, uint32_t cycles)
+{
+    s->n++;
+    s->total += cycles;
+    if (cycles > s->max)
+        s->max = cycles;
+}
+
+/* key = name + suffix（截断到size-1个字符） */
+static void Bench_Key(char *key, uint8_t size, const char *name, const char *suffix)
+{
+    uint8_t i = 0;
+
+    while (*name != '\0' && i < size - 1u)
+        key[i++] = *name++;
+    while (*suffix != '\0' && i < size - 1u)
+        key[i++] = *suffix++;
+    key[i] = '\0';
+}
+
+static void Stat_Print(const char *name, const BenchStat *s)
+{
+    char key[32];
+
+    Bench_Key(key, sizeof(key), name, "_n");
+    BenchPort_PrintValue(key, s->n);
+    Bench_Key(key, sizeof(key), name, "_mean");
+    BenchPort_PrintValue(key, s->n ? (uint32_t)((s->total + s->n / 2u) / s->n) : 0);
+    Bench_Key(key, sizeof(key), name, "_max");
+    BenchPort_PrintValue(key, s->max);
+}
+
+/* 采样中断：一个DMA块 */
+static void Bench_Block(const uint16_t *block)
+{
+    uint32_t start, cycles;
+    uint8_t capture;
+    uint16_t i;
+
+    /* 模拟看门狗中断优先级低于DMA，块内越界时标志在块处理前已置位 */
+    for (i = 0; i < DETECTOR_BLOCK_SAMPLES; i++)
+    {
+        if (block[i] > awd_threshold)
+        {
+            watchdog_trigger_count++;
+            Detector_AwdTrigger();
+            break;
+        }
+    }
+
+    capture = snapshot_collecting;
+    start = BenchPort_Now();
+    Detector_ProcessBlock(block, DETECTOR_BLOCK_SAMPLES);
+    cycles = BenchPort_Cycles(start);
+    Stat_Add(&stat_isr_block, cycles);
+    if (capture || snapshot_collecting || snapshot_ready)
+        Stat_Add(&stat_isr_capture, cycles);
+}
+
+/* 显示刷新：实时页数值取自检测结果 */
+static void Bench_Display(void)
+{
+    UiLive live;
+    uint32_t start, cycles;
+    uint16_t peak = last_peak_value_from_isr;
+
+    live.peak = peak;
+    live.gain = 'H';
+    live.volt_cv = (uint16_t)((uint32_t)peak * 330u / 4095u);
+    live.intensity_cmh = RainStats_Intensity1Min();
+    live.sum_cv = (uint16_t)(sum_cv % 100000u);
+
+    start = BenchPort_Now();
+    UI_Render(&live);
+    cycles = BenchPort_Cycles(start);
+    Stat_Add(&stat_display, cycles);
+    Stat_Add(&stat_page[UI_Page()], cycles);
+
+    if (stat_display.n % BENCH_DISPLAY_PER_PAGE == 0)
+    {
+        pending_key = KEY_1;                 // 翻页（重绘标签不计入刷新）
+        UI_HandleKeys();
+    }
+}
+
+/* 主循环中与检测、显示有关的部分（顺序与main.c一致） */
+static void Bench_MainLoop(uint32_t loop)
+{
+    SnapshotVerdict verdict;
+    uint32_t start, cycles;
+    uint8_t state;
+
+    if (last_peak_ready_from_isr)
+        last_peak_ready_from_isr = 0;
+
+    RainStats_Advance(sampling_tick_counter);
+
+    start = BenchPort_Now();
+    state = DropCounter_Judge(arena_work.smoothed, &verdict);
+    cycles = BenchPort_Cycles(start);
+    if (state == DROPCOUNTER_JUDGED)
+    {
+        Stat_Add(&stat_validate, cycles);
+        if (verdict.reject == REJECT_NONE)
+        {
+            DropCounter_Count(&verdict);
+            sum_cv += (uint32_t)verdict.peak_value * 330u / 4095u;
+        }
+        snapshot_ready = 0;
+    }
+
+    start = BenchPort_Now();
+    Threshold_Update(arena_work.window);
+    Stat_Add(&stat_threshold, BenchPort_Cycles(start));
+
+    if (loop % BENCH_DISPLAY_LOOPS == 0)
+        Bench_Display();
+
+    DropCounter_Loop();
+}
+
+int main(void)
+{
+    uint32_t pass, elapsed_us = 0, next_loop_us = BENCH_LOOP_US, loops = 0;
+    uint16_t b;
+    uint8_t p;
+
+    BenchPort_Init();
+
+    Detector_Reset();
+    Threshold_Reset();
+    DropCounter_Reset();
+    DropSize_ClearHistogram();
+    RainStats_Reset(0);
+    CoreHal_Register(&bench_hal);
+    awd_threshold = dynamic_threshold;
+    UI_Init();
+
+    for (pass = 0; pass < BENCH_PASSES; pass++)
+    {
+        for (b = 0; b < bench_block_count; b++)
+        {
+            Bench_Block(&bench_samples[(uint32_t)b * DETECTOR_BLOCK_SAMPLES]);
+            elapsed_us += (uint32_t)(DETECTOR_BLOCK_SAMPLES * ADC_SAMPLE_INTERVAL_US);
+            while (elapsed_us >= next_loop_us)
+            {
+                next_loop_us += BENCH_LOOP_US;
+                Bench_MainLoop(++loops);
+            }
+        }
+    }
+
+    Stat_Print("isr_block", &stat_isr_block);
+    Stat_Print("isr_capture", &stat_isr_capture);
+    Stat_Print("validate", &stat_validate);
+    Stat_Print("threshold", &stat_threshold);
+    Stat_Print("display", &stat_display);
+    for (p = 0; p < UI_PAGE_COUNT; p++)
+        Stat_Print(page_names[p], &stat_page[p]);
+
+    /* 检测漏斗：与基线不同说明输入或检测行为变了，周期比较须结合这些计数看 */
+    BenchPort_PrintValue("blocks", stat_isr_block.n);
+    BenchPort_PrintValue("loops", loops);
+    BenchPort_PrintValue("snapshots", snapshot_capture_count);
+    BenchPort_PrintValue("deadtime", snapshot_deadtime_drops);
+    BenchPort_PrintValue("counted", snapshot_valid_count);
+    BenchPort_PrintValue("final_threshold", dynamic_threshold);
+    return 0;
+}
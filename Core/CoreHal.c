@@ -0,0 +1,39 @@
+#include "CoreHal.h"
+
+static const CoreHal *core_hal = 0;
+
+/**
+  * @brief  注册平台接口
+  * @param  hal 接口表（须在整个运行期间有效），0表示全部使用空实现
+  * @note   固件在AD_Init之前调用，此后采样中断才会经过本接口
+  */
+void CoreHal_Register(const CoreHal *hal)
+{
+    core_hal = hal;
+}
+
+uint16_t CoreHal_ReadSamples(uint16_t *dst, uint16_t count)
+{
+    if (core_hal == 0 || core_hal->read_samples == 0)
+        return 0;
+    return core_hal->read_samples(core_hal->user, dst, count);
+}
+
+uint32_t CoreHal_Cycles(void)
+{
+    if (core_hal == 0 || core_hal->cycles == 0)
+        return 0;
+    return core_hal->cycles(core_hal->user);
+}
+
+void CoreHal_SetThreshold(uint16_t threshold)
+{
+    if (core_hal != 0 && core_hal->set_threshold != 0)
+        core_hal->set_threshold(core_hal->user, threshold);
+}
+
+void CoreHal_Trigger(uint32_t tick, uint16_t tail)
+{
+    if (core_hal != 0 && core_hal->trigger != 0)
+        core_hal->trigger(core_hal->user, tick, tail);
+}
@@ -0,0 +1,32 @@
+#ifndef __COREHAL_H
+#define __COREHAL_H
+
+#include <stdint.h>
+
+/*
+ * 检测核心的平台接口（HAL）
+ *   Core/目录下的模块不包含外设库、寄存器或编译器扩展，与平台的交互只经过本接口：
+ *     样本源 read_samples  ：主机由文件/生成器提供，Detector_Pump取样后按块送入检测；
+ *                            固件中DMA半传输/传输完成中断直接调用Detector_ProcessBlock，置0即可
+ *     时钟   cycles        ：自由运行的周期计数，只用于耗时统计（Pack12_RecordCost）
+ *     输出   set_threshold ：自适应阈值变化（固件写ADC模拟看门狗）
+ *            trigger       ：快照触发（触发样本的采样计数、所在块内其后的样本数）
+ *   未注册或某项为0时使用空实现，主机测试只需填写关心的项
+ *   回调可能在采样中断内调用（cycles、trigger），须短小且不可阻塞
+ */
+typedef struct
+{
+    uint16_t (*read_samples)(void *user, uint16_t *dst, uint16_t count); // 返回实际样本数，0为样本源结束
+    uint32_t (*cycles)(void *user);
+    void (*set_threshold)(void *user, uint16_t threshold);
+    void (*trigger)(void *user, uint32_t tick, uint16_t tail);
+    void *user;                          // 原样传给各回调
+} CoreHal;
+
+void CoreHal_Register(const CoreHal *hal);
+uint16_t CoreHal_ReadSamples(uint16_t *dst, uint16_t count);
+uint32_t CoreHal_Cycles(void);
+void CoreHal_SetThreshold(uint16_t threshold);
+void CoreHal_Trigger(uint32_t tick, uint16_t tail);
+
+#endif
@@ -0,0 +1,494 @@
+#include "Detector.h"
+#include "Threshold.h"
+#include "CoreHal.h"
+
+/* 在线峰值检测参数 */
+#define PEAK_STATE_IDLE         0        // 空闲状态
+#define PEAK_STATE_SEARCHING    1        // 峰值搜索状态
+#define PEAK_STATE_WAIT_FALL    2        // 等待回落状态
+#define PEAK_WINDOW_SIZE        60       // 峰值锁定窗口大小
+#define BASELINE_SIZE           100      // 基线估算窗口大小
+#define RETURN_THRESHOLD        20       // 回落阈值（ADC单位）
+#define DEAD_TIME_INIT          50       // 死区时间初始值
+
+/* 前部峰值检测参数：只分析前部（上升→峰值→下降到0），忽略后部（0→负向极值→0） */
+#define PEAK_LOCK_DECAY_COUNT   4        // 连续下降样本数阈值，达到后锁定峰值
+#define PEAK_LOCK_BASELINE_DELTA 30      // 回落到基线附近的阈值（ADC单位），用于提前锁定峰值
+
+/* 后部噪声过滤参数：避免后部噪声误判为新峰值 */
+#define IDLE_TRIGGER_MARGIN     50       // IDLE状态触发阈值余量（ADC单位），适配小信号检测
+#define IDLE_TRIGGER_CONSEC     3        // IDLE状态需要连续N个样本都超过阈值才触发
+#define STABLE_PERIOD_COUNT     100      // 稳定期样本数，WAIT_FALL完成后需要值在基线附近保持的样本数（约4.2ms，确保后部震荡完全结束）
+#define STABLE_BASELINE_DELTA   50       // 稳定期基线附近的范围（ADC单位）
+#define DEAD_TIME_SCALE_FACTOR  2        // 死区时间缩放因子，根据峰值大小动态调整
+#define DEAD_TIME_MIN           50       // 最小死区时间
+#define DEAD_TIME_MAX           200      // 最大死区时间
+
+/* 差值触发配置 */
+#define DIFF_TRIGGER_THRESHOLD      100   // 差分触发阈值（ADC单位，约80mV），适配小信号检测
+#define DIFF_TRIGGER_CONSEC         2     // 连续满足差分阈值的样本数
+#define DIFF_TRIGGER_COOLDOWN       150   // 触发后冷却样本数，避免重复触发
+
+/* 环形缓冲与快照（单通道模式，仅使用通道0；内存规划见Arena.h） */
+volatile uint8_t adc_ring_packed_ch0[PACK12_BYTES(RING_BUFFER_SIZE)];  // 通道0环形缓冲区（12位打包）
+volatile uint16_t ring_write_index_ch0 = 0;  // 通道0写索引
+
+volatile uint8_t snapshot_ready = 0;
+volatile uint16_t snapshot_buffer_high[SNAPSHOT_SIZE];
+volatile uint16_t snapshot_write_index = 0;
+volatile uint8_t snapshot_collecting = 0; /* 0-未采集，1-正在采集 */
+volatile uint16_t snapshot_peak_value = 0;
+volatile uint16_t snapshot_peak_index = 0;
+
+volatile uint32_t sampling_tick_counter = 0; /* 每处理一个样本推进，用于异常检测与时间基准 */
+
+volatile uint16_t last_peak_value_from_isr = 0;
+volatile uint16_t last_peak_index_from_isr = 0;
+volatile uint8_t  last_peak_ready_from_isr = 0;
+
+volatile uint32_t diff_trigger_count = 0;
+volatile uint32_t snapshot_capture_count = 0;
+
+static volatile uint8_t awd_trigger_pending = 0;
+static uint32_t dma_block_end_tick = 0;  // 当前块处理完后的采样计数
+static uint16_t prev_ch0_value = 0;
+static uint8_t have_prev_ch0 = 0;
+static uint8_t diff_hit_counter = 0;
+static uint16_t diff_cooldown_counter = 0;
+
+typedef struct
+{
+    uint32_t baseline_sum;
+    uint16_t baseline_buffer[BASELINE_SIZE];
+    uint16_t baseline_value;
+    uint16_t dead_time;
+    uint16_t search_count;
+    uint16_t local_max;
+    uint16_t local_max_index;
+    uint8_t baseline_index;
+    uint8_t baseline_count;
+    uint8_t peak_state;
+    /* 前部峰值检测：只分析前部，忽略后部 */
+    uint16_t prev_value;                 // 上一次的值，用于检测下降
+    uint8_t decay_count;                 // 连续下降计数
+    uint8_t peak_locked;                 // 峰值锁定标志：1=已锁定，不再更新local_max
+    /* 后部噪声过滤：避免后部噪声误判为新峰值 */
+    uint8_t stable_count;                // 稳定期计数，WAIT_FALL完成后值在基线附近的样本数
+    uint8_t idle_trigger_count;           // IDLE状态触发计数，连续超过阈值的样本数
+    uint16_t last_peak_value;            // 上一次的峰值，用于动态调整死区时间
+} PeakDetectorContext;
+
+static PeakDetectorContext peak_ctx[2];
+
+static void UpdateBaseline(PeakDetectorContext *ctx, uint16_t value)
+{
+    ctx->baseline_sum -= ctx->baseline_buffer[ctx->baseline_index];
+    ctx->baseline_buffer[ctx->baseline_index] = value;
+    ctx->baseline_sum += value;
+    ctx->baseline_index = (ctx->baseline_index + 1) % BASELINE_SIZE;
+
+    if (ctx->baseline_count < BASELINE_SIZE)
+    {
+        ctx->baseline_count++;
+        ctx->baseline_value = (uint16_t)(ctx->baseline_sum / ctx->baseline_count);
+    }
+    else
+    {
+        ctx->baseline_value = (uint16_t)(ctx->baseline_sum / BASELINE_SIZE);
+    }
+}
+
+/**
+  * @brief  用已知基线预填充峰值检测器（热启动）
+  * @param  baseline 上一次运行保存的基线（ADC单位）
+  * @retval 无
+  * @note   必须在AD_Init之前调用，此时DMA中断尚未开始访问peak_ctx
+  */
+void Peak_Detector_Seed(uint16_t baseline)
+{
+    uint8_t ch, k;
+    for (ch = 0; ch < 2; ch++)
+    {
+        PeakDetectorContext *ctx = &peak_ctx[ch];
+        for (k = 0; k < BASELINE_SIZE; k++)
+        {
+            ctx->baseline_buffer[k] = baseline;
+        }
+        ctx->baseline_sum = (uint32_t)baseline * BASELINE_SIZE;
+        ctx->baseline_index = 0;
+        ctx->baseline_count = BASELINE_SIZE;
+        ctx->baseline_value = baseline;
+    }
+}
+
+/**
+  * @brief  读取通道0当前基线（用于热启动保存）
+  * @retval 基线值（ADC单位），基线窗口未填满时返回0
+  */
+uint16_t Peak_Detector_GetBaseline(void)
+{
+    if (peak_ctx[0].baseline_count < BASELINE_SIZE)
+    {
+        return 0;
+    }
+    return peak_ctx[0].baseline_value;
+}
+
+static void Process_ADC_Sample(uint8_t channel, uint16_t value, uint16_t ring_index)
+{
+    PeakDetectorContext *ctx = &peak_ctx[channel];
+    volatile uint16_t *dynamic_thr = &dynamic_threshold;   /* 当前只使用通道0的动态阈值 */
+
+    if (ctx->dead_time > 0)
+    {
+        ctx->dead_time--;
+        if (ctx->peak_state == PEAK_STATE_IDLE)
+        {
+            UpdateBaseline(ctx, value);
+        }
+        return;
+    }
+
+    if (ctx->peak_state == PEAK_STATE_IDLE)
+    {
+        UpdateBaseline(ctx, value);
+    }
+
+    switch (ctx->peak_state)
+    {
+        case PEAK_STATE_IDLE:
+            /* 后部噪声过滤：提高IDLE状态的触发条件，避免后部小波动触发新的峰值检测 */
+            
+            /* 稳定期检查：如果刚从WAIT_FALL状态出来，需要值在基线附近保持一段时间 */
+            if (ctx->stable_count > 0)
+            {
+                /* 在稳定期内，检查值是否在基线附近 */
+                if (value <= (ctx->baseline_value + STABLE_BASELINE_DELTA) &&
+                    value >= (ctx->baseline_value - STABLE_BASELINE_DELTA))
+                {
+                    /* 值在基线附近，稳定期计数递减 */
+                    ctx->stable_count--;
+                }
+                else
+                {
+                    /* 值不在基线附近，重置稳定期计数 */
+                    ctx->stable_count = STABLE_PERIOD_COUNT;
+                }
+                
+                /* 稳定期未结束，不允许新的峰值检测 */
+                if (ctx->stable_count > 0)
+                {
+                    break;
+                }
+            }
+            
+            /* 稳定期已结束，检查是否触发新的峰值检测 */
+            /* 提高触发条件：值必须明显超过阈值（阈值 + 余量） */
+            if (value > (*dynamic_thr + IDLE_TRIGGER_MARGIN))
+            {
+                /* 值超过阈值+余量，增加触发计数 */
+                ctx->idle_trigger_count++;
+                
+                /* 需要连续N个样本都超过阈值才触发，避免单次噪声触发 */
+                if (ctx->idle_trigger_count >= IDLE_TRIGGER_CONSEC)
+                {
+                    /* 触发新的峰值检测 */
+                    ctx->peak_state = PEAK_STATE_SEARCHING;
+                    ctx->search_count = 0;
+                    ctx->local_max = value;
+                    ctx->local_max_index = ring_index;
+                    /* 初始化前部峰值检测变量 */
+                    ctx->prev_value = value;
+                    ctx->decay_count = 0;
+                    ctx->peak_locked = 0;
+                    /* 重置触发计数 */
+                    ctx->idle_trigger_count = 0;
+                }
+            }
+            else
+            {
+                /* 值未超过阈值+余量，重置触发计数 */
+                ctx->idle_trigger_count = 0;
+            }
+            break;
+
+        case PEAK_STATE_SEARCHING:
+            /* 前部峰值检测：只在前部（上升→峰值→下降到0）搜索峰值，忽略后部 */
+            /* 关键：限制搜索时间窗口，确保只捕获前部峰值，不捕获后部震荡 */
+            
+            /* 检查是否已回落到基线附近（前部结束标志） */
+            if (value <= (ctx->baseline_value + PEAK_LOCK_BASELINE_DELTA))
+            {
+                /* 已回落到基线，前部结束，立即锁定峰值并进入WAIT_FALL状态 */
+                ctx->peak_locked = 1;
+                ctx->peak_state = PEAK_STATE_WAIT_FALL;
+                break;
+            }
+            
+            /* 如果峰值尚未锁定，继续搜索 */
+            if (!ctx->peak_locked)
+            {
+                /* 检测下降趋势 */
+                if (value < ctx->prev_value)
+                {
+                    /* 值在下降，增加下降计数 */
+                    ctx->decay_count++;
+                    
+                    /* 如果连续下降达到阈值，说明峰值已过，锁定峰值 */
+                    if (ctx->decay_count >= PEAK_LOCK_DECAY_COUNT)
+                    {
+                        ctx->peak_locked = 1;
+                    }
+                }
+                else
+                {
+                    /* 值未下降，重置下降计数 */
+                    ctx->decay_count = 0;
+                    
+                    /* 如果值大于当前峰值，更新峰值（只在前部上升阶段） */
+                    if (value > ctx->local_max)
+                    {
+                        ctx->local_max = value;
+                        ctx->local_max_index = ring_index;
+                    }
+                }
+            }
+            /* 如果峰值已锁定，不再更新local_max，即使后续有更大的值（可能是后部噪声） */
+            
+            ctx->prev_value = value;  // 更新上一次的值
+            ctx->search_count++;
+            
+            /* 如果搜索窗口用完，强制锁定峰值并进入WAIT_FALL状态（防止搜索时间过长捕获后部震荡） */
+            if (ctx->search_count >= PEAK_WINDOW_SIZE)
+            {
+                ctx->peak_locked = 1;  // 强制锁定峰值
+                ctx->peak_state = PEAK_STATE_WAIT_FALL;
+            }
+            break;
+
+        case PEAK_STATE_WAIT_FALL:
+            if (value < (ctx->baseline_value + RETURN_THRESHOLD))
+            {
+                /* 脉冲完成：记录本次完整脉冲的峰值（仅通道0/PA0），供主循环显示使用 */
+                /* 验证峰值是否明显大于基线，过滤后部噪声和ADC数字噪声（后部噪声通常不会明显大于基线） */
+                /* 降低阈值到80，适配420-540mV小雨滴信号（约320-410mV相对基线） */
+                if (channel == 0 && ctx->local_max > (ctx->baseline_value + 80))
+                {
+                    last_peak_value_from_isr = ctx->local_max;
+                    last_peak_index_from_isr = ctx->local_max_index;
+                    last_peak_ready_from_isr = 1;
+                }
+
+                /* 动态调整死区时间：根据峰值大小调整，大峰值后需要更长的死区时间 */
+                uint16_t dynamic_dead_time = DEAD_TIME_INIT;
+                /* 根据当前峰值大小计算死区时间：峰值越大，死区时间越长 */
+                /* 峰值每增加1000个ADC单位（约0.8V），死区时间增加50个样本 */
+                if (ctx->local_max > 1000)
+                {
+                    uint16_t extra_dead_time = ((ctx->local_max - 1000) / 1000) * 50;
+                    dynamic_dead_time = DEAD_TIME_INIT + extra_dead_time;
+                    if (dynamic_dead_time > DEAD_TIME_MAX)
+                        dynamic_dead_time = DEAD_TIME_MAX;
+                    if (dynamic_dead_time < DEAD_TIME_MIN)
+                        dynamic_dead_time = DEAD_TIME_MIN;
+                }
+                
+                /* 保存当前峰值，用于调试或后续分析 */
+                ctx->last_peak_value = ctx->local_max;
+
+                ctx->peak_state = PEAK_STATE_IDLE;
+                ctx->search_count = 0;
+                ctx->local_max = 0;
+                ctx->dead_time = dynamic_dead_time;
+                /* 重置前部峰值检测变量 */
+                ctx->prev_value = 0;
+                ctx->decay_count = 0;
+                ctx->peak_locked = 0;
+                /* 进入稳定期：值必须在基线附近保持一段时间，才允许新的峰值检测 */
+                ctx->stable_count = STABLE_PERIOD_COUNT;
+                /* 重置触发计数 */
+                ctx->idle_trigger_count = 0;
+            }
+            break;
+    }
+
+}
+
+static void Start_Snapshot_From_Index(uint16_t trig_idx_ch0, uint16_t trig_val_ch0)
+{
+    uint32_t t0;
+
+    if (snapshot_collecting || snapshot_ready)
+    {
+        return;
+    }
+
+    int16_t start_high = (int16_t)trig_idx_ch0 - SNAPSHOT_PRE_SAMPLES;
+    if (start_high < 0) start_high += RING_BUFFER_SIZE;
+
+    /* 预触发样本从打包环形缓冲成块解包 */
+    t0 = CoreHal_Cycles();
+    Pack12_UnpackRing((uint16_t *)snapshot_buffer_high, (const uint8_t *)adc_ring_packed_ch0,
+                      RING_BUFFER_SIZE, (uint16_t)start_high, SNAPSHOT_PRE_SAMPLES);
+    Pack12_RecordCost(CoreHal_Cycles() - t0, SNAPSHOT_PRE_SAMPLES);
+
+    /* 将触发样本放在索引 SNAPSHOT_PRE_SAMPLES */
+    snapshot_buffer_high[SNAPSHOT_PRE_SAMPLES] = trig_val_ch0;
+
+    snapshot_write_index = SNAPSHOT_PRE_SAMPLES + 1;
+    snapshot_collecting = 1;
+
+    /* 采样计数已越过触发样本：触发样本为计数-1，本块内其后还有(块末-计数)个样本 */
+    CoreHal_Trigger(sampling_tick_counter - 1, (uint16_t)(dma_block_end_tick - sampling_tick_counter));
+}
+
+static void Evaluate_Diff_Trigger(uint16_t ch0_value, uint16_t idx_ch0)
+{
+    if (snapshot_collecting || snapshot_ready)
+    {
+        /* 仍然需要更新前一个采样值以便下一次触发 */
+        prev_ch0_value = ch0_value;
+        have_prev_ch0 = 1;
+        if (diff_cooldown_counter > 0)
+            diff_cooldown_counter--;
+        return;
+    }
+
+    uint8_t trigger_now = 0;
+
+    if (awd_trigger_pending)
+    {
+        trigger_now = 1;
+        awd_trigger_pending = 0;
+    }
+    else if (have_prev_ch0)
+    {
+        uint16_t diff = (ch0_value > prev_ch0_value) ? (ch0_value - prev_ch0_value) : (prev_ch0_value - ch0_value);
+        if (diff >= DIFF_TRIGGER_THRESHOLD)
+        {
+            if (diff_hit_counter < 0xFF)
+                diff_hit_counter++;
+        }
+        else if (diff_hit_counter > 0)
+        {
+            diff_hit_counter--;
+        }
+
+        if (diff_hit_counter >= DIFF_TRIGGER_CONSEC && diff_cooldown_counter == 0)
+        {
+            trigger_now = 1;
+            diff_hit_counter = 0;
+            diff_cooldown_counter = DIFF_TRIGGER_COOLDOWN;
+            diff_trigger_count++;
+        }
+    }
+
+    prev_ch0_value = ch0_value;
+    have_prev_ch0 = 1;
+    if (diff_cooldown_counter > 0)
+        diff_cooldown_counter--;
+
+    if (trigger_now)
+    {
+        Start_Snapshot_From_Index(idx_ch0, ch0_value);
+    }
+}
+
+
+/**
+  * @brief  处理一块连续样本（DMA半缓冲）
+  * @param  block 样本（12位右对齐）
+  * @param  count 样本数（固件固定为DETECTOR_BLOCK_SAMPLES）
+  * @note   整块先打包写入环形缓冲再逐点处理：块内触发时，预触发解包读到的都是已写入的样本
+  */
+void Detector_ProcessBlock(const uint16_t *block, uint16_t count)
+{
+    uint16_t i;
+
+    Pack12_PackRing((uint8_t *)adc_ring_packed_ch0, RING_BUFFER_SIZE, ring_write_index_ch0, block, count);
+    dma_block_end_tick = sampling_tick_counter + count;
+    for (i = 0; i < count; i++)  // 每次处理一个通道0数据
+    {
+        uint16_t ch0_value = block[i];
+
+        uint16_t current_index = ring_write_index_ch0;
+        ring_write_index_ch0 = (current_index + 1) % RING_BUFFER_SIZE;
+        Process_ADC_Sample(0, ch0_value, current_index);
+        sampling_tick_counter++;
+
+        Evaluate_Diff_Trigger(ch0_value, current_index);
+
+        if (snapshot_collecting && snapshot_write_index < SNAPSHOT_SIZE)
+        {
+            snapshot_buffer_high[snapshot_write_index] = ch0_value;
+            snapshot_write_index++;
+            if (snapshot_write_index >= SNAPSHOT_SIZE)
+            {
+                snapshot_ready = 1;
+                snapshot_collecting = 0;
+                snapshot_capture_count++;
+            }
+        }
+    }
+}
+
+/**
+  * @brief  从HAL样本源读取一块并处理（主机回放/测试用）
+  * @retval 本次处理的样本数，0表示样本源已结束
+  */
+uint16_t Detector_Pump(void)
+{
+    uint16_t block[DETECTOR_BLOCK_SAMPLES];
+    uint16_t n = CoreHal_ReadSamples(block, DETECTOR_BLOCK_SAMPLES);
+
+    if (n > DETECTOR_BLOCK_SAMPLES)
+        n = DETECTOR_BLOCK_SAMPLES;
+    if (n > 0)
+        Detector_ProcessBlock(block, n);
+    return n;
+}
+
+/**
+  * @brief  标记一次模拟看门狗越界，下一个样本处理时启动快照
+  * @note   固件在ADC中断中调用（优先级低于DMA中断，单字节标志无需保护）
+  */
+void Detector_AwdTrigger(void)
+{
+    awd_trigger_pending = 1;
+}
+
+/**
+  * @brief  清除全部检测状态（环形缓冲、快照、峰值检测器、触发计数）
+  * @note   主机在每段回放/每个测试前调用；固件上电时静态区已清零，不调用
+  */
+void Detector_Reset(void)
+{
+    static const PeakDetectorContext peak_ctx_zero;
+    uint16_t i;
+
+    for (i = 0; i < PACK12_BYTES(RING_BUFFER_SIZE); i++)
+        adc_ring_packed_ch0[i] = 0;
+    for (i = 0; i < SNAPSHOT_SIZE; i++)
+        snapshot_buffer_high[i] = 0;
+    ring_write_index_ch0 = 0;
+    snapshot_ready = 0;
+    snapshot_write_index = 0;
+    snapshot_collecting = 0;
+    snapshot_peak_value = 0;
+    snapshot_peak_index = 0;
+    sampling_tick_counter = 0;
+    last_peak_value_from_isr = 0;
+    last_peak_index_from_isr = 0;
+    last_peak_ready_from_isr = 0;
+    diff_trigger_count = 0;
+    snapshot_capture_count = 0;
+
+    peak_ctx[0] = peak_ctx_zero;
+    peak_ctx[1] = peak_ctx_zero;
+    awd_trigger_pending = 0;
+    dma_block_end_tick = 0;
+    prev_ch0_value = 0;
+    have_prev_ch0 = 0;
+    diff_hit_counter = 0;
+    diff_cooldown_counter = 0;
+}
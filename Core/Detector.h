@@ -0,0 +1,60 @@
+#ifndef __DETECTOR_H
+#define __DETECTOR_H
+
+#include <stdint.h>
+#include "Pack12.h"
+
+/*
+ * 采样中断侧检测（与平台无关，固件在DMA1通道1中断中调用，主机测试/回放直接调用）
+ *   每个DMA半缓冲（DETECTOR_BLOCK_SAMPLES个样本）调用一次Detector_ProcessBlock：
+ *     1) 整块打包写入环形缓冲（预触发样本来源）
+ *     2) 逐样本：在线峰值状态机（基线、死区、前部峰值锁定）→ 采样计数+1 →
+ *        差分/模拟看门狗触发 → 快照填充（预触发从环形缓冲解包，后触发逐点写入）
+ *   快照填满后置snapshot_ready，主循环用Validate_Snapshot判定后清零；
+ *   snapshot_ready或snapshot_collecting期间不接受新的触发
+ */
+#define DETECTOR_BLOCK_SAMPLES  50       // 每次处理的样本数（DMA半缓冲）
+#define ADC_SAMPLE_INTERVAL_US  42.0f    // 12MHz ADC、239.5周期采样 ≈ 42us/样本
+
+#define RING_BUFFER_SIZE 680            // 12位打包存储，1020字节（偶数：样本对不跨越回绕点）
+#define SNAPSHOT_PRE_SAMPLES 200
+#define SNAPSHOT_POST_SAMPLES 300
+#define SNAPSHOT_SIZE (SNAPSHOT_PRE_SAMPLES + SNAPSHOT_POST_SAMPLES)
+
+/* 预触发样本取自环形缓冲，触发所在DMA块的整块样本在逐点处理前已写入 */
+#if SNAPSHOT_PRE_SAMPLES + 2 * DETECTOR_BLOCK_SAMPLES > RING_BUFFER_SIZE
+#error "环形缓冲须能容纳预触发样本加一个DMA缓冲"
+#endif
+
+/* 环形缓冲区（单通道模式，仅通道0；12位打包，读写见Pack12.h） */
+extern volatile uint8_t adc_ring_packed_ch0[PACK12_BYTES(RING_BUFFER_SIZE)];  // 通道0环形缓冲区
+extern volatile uint16_t ring_write_index_ch0;  // 通道0写索引
+
+extern volatile uint8_t snapshot_ready;
+extern volatile uint16_t snapshot_buffer_high[SNAPSHOT_SIZE];
+extern volatile uint16_t snapshot_write_index;
+extern volatile uint8_t snapshot_collecting;
+extern volatile uint16_t snapshot_peak_value;
+extern volatile uint16_t snapshot_peak_index;
+
+extern volatile uint32_t sampling_tick_counter;
+
+/* 在线峰值（仅PA0）：每次完整脉冲结束时更新，主循环作显示备用路径 */
+extern volatile uint16_t last_peak_value_from_isr;   // 最近一次完整脉冲的峰值ADC码
+extern volatile uint16_t last_peak_index_from_isr;   // 对应环形缓冲索引（调试用）
+extern volatile uint8_t  last_peak_ready_from_isr;   // 标志位：1表示有新峰值待处理
+
+/* 检测漏斗计数（中断中累加） */
+extern volatile uint32_t diff_trigger_count;      // 差分触发次数
+extern volatile uint32_t snapshot_capture_count;  // 完整采集的快照数
+
+void Detector_Reset(void);
+void Detector_ProcessBlock(const uint16_t *block, uint16_t count);
+uint16_t Detector_Pump(void);
+void Detector_AwdTrigger(void);
+
+/* 峰值检测器热启动接口 */
+void Peak_Detector_Seed(uint16_t baseline);
+uint16_t Peak_Detector_GetBaseline(void);
+
+#endif
@@ -0,0 +1,105 @@
+#include "DropCounter.h"
+#include "Threshold.h"
+#include "DropSize.h"
+#include "RainStats.h"
+
+volatile uint32_t drop_count = 0;
+volatile uint32_t total_rain_um = 0;
+uint16_t rain_residual_nm = 0;
+volatile uint32_t snapshot_valid_count = 0;
+
+uint32_t snapshot_deadtime_drops = 0;
+uint16_t reject_counts[REJECT_COUNT];
+
+static uint16_t event_deadtime_loops = 0;
+
+/**
+  * @brief  清零累计量、漏斗计数与事件级死区
+  * @note   固件在命令"reset"中关中断调用，主机在每段回放前调用
+  */
+void DropCounter_Reset(void)
+{
+	uint8_t i;
+
+	drop_count = 0;
+	total_rain_um = 0;
+	rain_residual_nm = 0;
+	snapshot_valid_count = 0;
+	snapshot_deadtime_drops = 0;
+	for (i = 0; i < REJECT_COUNT; i++)
+	{
+		reject_counts[i] = 0;
+	}
+	event_deadtime_loops = 0;
+}
+
+/**
+  * @brief  判定就绪的快照
+  * @param  scratch 平滑用临时区（至少SNAPSHOT_SIZE个样本）
+  * @param  verdict 判定结果（仅返回DROPCOUNTER_JUDGED时有效）
+  * @retval DROPCOUNTER_IDLE/DROPCOUNTER_DEADTIME/DROPCOUNTER_JUDGED
+  * @note   拒绝原因在此计数；通过的快照须再调用DropCounter_Count才计入雨量
+  */
+uint8_t DropCounter_Judge(uint16_t *scratch, SnapshotVerdict *verdict)
+{
+	if (!snapshot_ready)
+	{
+		return DROPCOUNTER_IDLE;
+	}
+
+	/* 事件级死区内：直接丢弃本次快照，避免同一滴的拖尾触发 */
+	if (event_deadtime_loops > 0)
+	{
+		snapshot_deadtime_drops++;
+		snapshot_ready = 0;
+		return DROPCOUNTER_DEADTIME;
+	}
+
+	Validate_Snapshot((const uint16_t *)snapshot_buffer_high, SNAPSHOT_SIZE, dynamic_threshold,
+	                  scratch, verdict);
+	snapshot_peak_value = verdict->peak_value;
+	snapshot_peak_index = verdict->peak_index;
+
+	if (verdict->reject != REJECT_NONE && reject_counts[verdict->reject] < 0xFFFFu)
+	{
+		reject_counts[verdict->reject]++;
+	}
+	return DROPCOUNTER_JUDGED;
+}
+
+/**
+  * @brief  把通过验证的快照计为一滴
+  * @param  verdict DropCounter_Judge的结果（reject须为REJECT_NONE）
+  * @retval 单滴体积（nL）
+  * @note   按峰值幅度估算单滴体积并累计雨量（整数运算），随后开启事件级死区
+  */
+uint32_t DropCounter_Count(const SnapshotVerdict *verdict)
+{
+	uint16_t amplitude = (verdict->peak_value > verdict->baseline) ?
+		(uint16_t)(verdict->peak_value - verdict->baseline) : 0;
+	uint32_t volume_nl = DropSize_VolumeNl(amplitude);
+	uint32_t depth_nm = DropSize_DepthNm(volume_nl);
+	uint32_t carry_nm = depth_nm + rain_residual_nm;
+
+	snapshot_valid_count++;
+	drop_count++;                        // 雨滴计数加1
+	DropSize_Record(volume_nl);          // 滴谱
+	total_rain_um += carry_nm / 1000u;
+	rain_residual_nm = (uint16_t)(carry_nm % 1000u);
+	RainStats_AddDrop(depth_nm);         // 多分辨率雨量统计
+
+	/* 在快照层面开启事件级死区，避免拖尾引起的重复快照触发 */
+	event_deadtime_loops = EVENT_DEADTIME_LOOPS;
+	return volume_nl;
+}
+
+/**
+  * @brief  主循环节拍（每10ms一次）：事件级死区递减
+  */
+void DropCounter_Loop(void)
+{
+	if (event_deadtime_loops > 0)
+	{
+		event_deadtime_loops--;
+	}
+}
@@ -0,0 +1,35 @@
+#ifndef __DROPCOUNTER_H
+#define __DROPCOUNTER_H
+
+#include <stdint.h>
+#include "Validate.h"
+
+/*
+ * 快照计数（主循环调用，与平台无关）
+ *   快照就绪 → 事件级死区内直接丢弃 → Validate_Snapshot → 通过则按峰值幅度换算体积/深度，
+ *   累计滴数、雨量（um+不足1um的余量）、滴谱与多分辨率雨量统计，并开启事件级死区
+ *   固件与主机回放共用同一份判定与累计逻辑；显示、日志、导出等由调用者在两步之间完成
+ *   DropCounter_Judge返回DROPCOUNTER_JUDGED时快照仍被占用，调用者用完后清snapshot_ready
+ */
+#define EVENT_DEADTIME_LOOPS    50       // 约 500ms，可按需要标定，避免同一滴的拖尾触发新的快照
+
+#define DROPCOUNTER_IDLE        0        // 无就绪快照
+#define DROPCOUNTER_DEADTIME    1        // 死区内丢弃（snapshot_ready已清除）
+#define DROPCOUNTER_JUDGED      2        // 已判定，结果在verdict中
+
+/* 累计量（drop_count/total_rain_um/rain_residual_nm跨复位由日志恢复） */
+extern volatile uint32_t drop_count;          // 雨滴计数
+extern volatile uint32_t total_rain_um;       // 累计降雨量（微米）
+extern uint16_t rain_residual_nm;             // 不足1um的累计余量（纳米）
+extern volatile uint32_t snapshot_valid_count; // 验证通过次数（通过即计数，兼作漏斗末级）
+
+/* 检测漏斗（本次上电）：完整快照 → 死区丢弃 → 验证通过（=计数，snapshot_valid_count） */
+extern uint32_t snapshot_deadtime_drops;      // 事件级死区内丢弃的快照
+extern uint16_t reject_counts[REJECT_COUNT];  // 各拒绝原因计数（[REJECT_NONE]不用）
+
+void DropCounter_Reset(void);
+uint8_t DropCounter_Judge(uint16_t *scratch, SnapshotVerdict *verdict);
+uint32_t DropCounter_Count(const SnapshotVerdict *verdict);
+void DropCounter_Loop(void);
+
+#endif
@@ -0,0 +1,80 @@
+#include "DropSize.h"
+
+/*
+ * 幅度->体积标定表（按幅度递增），占位值：
+ *   假设压电幅度近似正比于滴径平方，对应滴径1~6mm（体积πD³/6）
+ *   实际使用前需用标准滴（滴管/称重）重新标定
+ */
+static const DropCalPoint drop_cal_table[] =
+{
+    {    0,      0 },
+    {  100,    524 },                    // D=1mm
+    {  400,   4189 },                    // D=2mm
+    {  900,  14137 },                    // D=3mm
+    { 1600,  33510 },                    // D=4mm
+    { 2500,  65450 },                    // D=5mm
+    { 3600, 113097 },                    // D=6mm
+};
+#define DROP_CAL_POINTS (sizeof(drop_cal_table) / sizeof(drop_cal_table[0]))
+
+uint16_t drop_histogram[DROP_HIST_BINS];
+
+/**
+  * @brief  峰值幅度 -> 单滴体积（分段线性插值）
+  * @param  amplitude 峰值幅度（ADC单位，相对基线）
+  * @retval 体积（nL）；超出表尾时按最后一段斜率外推
+  */
+uint32_t DropSize_VolumeNl(uint16_t amplitude)
+{
+    uint8_t i;
+    const DropCalPoint *a, *b;
+
+    for (i = 1; i < DROP_CAL_POINTS - 1; i++)
+    {
+        if (amplitude < drop_cal_table[i].amplitude)
+            break;
+    }
+    a = &drop_cal_table[i - 1];
+    b = &drop_cal_table[i];
+
+    /* 体积差不超过2^17，幅度差不超过2^12，乘积不溢出32位 */
+    return a->volume_nl + (uint32_t)(b->volume_nl - a->volume_nl) * (uint32_t)(amplitude - a->amplitude)
+                          / (uint32_t)(b->amplitude - a->amplitude);
+}
+
+/**
+  * @brief  单滴体积 -> 雨量深度
+  * @param  volume_nl 体积（nL，1nL = 0.001mm³）
+  * @retval 深度（nm）= 体积(mm³)/面积(mm²)*1e6
+  */
+uint32_t DropSize_DepthNm(uint32_t volume_nl)
+{
+    return volume_nl * 1000u / DROP_COLLECTOR_AREA_MM2;
+}
+
+/**
+  * @brief  记录一滴到滴谱
+  */
+void DropSize_Record(uint32_t volume_nl)
+{
+    uint8_t bin = 0;
+    uint32_t limit = DROP_HIST_MIN_NL;
+
+    while (bin < DROP_HIST_BINS - 1 && volume_nl >= limit)
+    {
+        bin++;
+        limit <<= 1;
+    }
+    if (drop_histogram[bin] < 0xFFFF)
+        drop_histogram[bin]++;
+}
+
+void DropSize_ClearHistogram(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < DROP_HIST_BINS; i++)
+    {
+        drop_histogram[i] = 0;
+    }
+}
@@ -0,0 +1,30 @@
+#ifndef __DROPSIZE_H
+#define __DROPSIZE_H
+
+#include <stdint.h>
+
+/*
+ * 雨滴体积标定与滴谱统计
+ *   峰值幅度（前部峰值减基线，ADC单位）经分段线性标定表换算为单滴体积（nL），
+ *   再除以受雨面积得到单滴雨量深度（nm），全部为整数运算
+ *   滴谱：按体积以2为底对数分箱，每个统计周期（DROP_HIST_PERIOD_S）输出一次后清零
+ */
+#define DROP_COLLECTOR_AREA_MM2 2000u    // 传感器受雨面积（mm²）——占位标定值
+#define DROP_HIST_BINS          10       // 对数分箱数
+#define DROP_HIST_MIN_NL        256u     // 第0箱上限（nL），第k箱为[256*2^(k-1), 256*2^k)，末箱不设上限
+#define DROP_HIST_PERIOD_S      60       // 滴谱统计周期（秒）
+
+typedef struct
+{
+    uint16_t amplitude;                  // 峰值幅度（ADC单位，相对基线）
+    uint32_t volume_nl;                  // 对应单滴体积（nL）
+} DropCalPoint;
+
+extern uint16_t drop_histogram[DROP_HIST_BINS];  // 当前统计周期的滴谱
+
+uint32_t DropSize_VolumeNl(uint16_t amplitude);
+uint32_t DropSize_DepthNm(uint32_t volume_nl);
+void DropSize_Record(uint32_t volume_nl);
+void DropSize_ClearHistogram(void);
+
+#endif
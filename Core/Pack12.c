@@ -0,0 +1,145 @@
+#include "Pack12.h"
+
+volatile uint32_t pack12_block_cycles_last = 0;
+volatile uint32_t pack12_block_cycles_max = 0;
+
+/**
+  * @brief  写入一个样本
+  * @param  base  打包区起始地址
+  * @param  index 样本序号
+  * @param  value 样本（只取低12位）
+  * @note   读改写同一16位窗口，相邻样本的4位不受影响
+  */
+void Pack12_Put(uint8_t *base, uint16_t index, uint16_t value)
+{
+    uint8_t *p = base + index + (index >> 1);
+    uint8_t shift = (uint8_t)((index & 1u) << 2);
+    uint16_t w = (uint16_t)(p[0] | (p[1] << 8));
+
+    w = (uint16_t)((w & ~(0x0FFFu << shift)) | ((value & 0x0FFFu) << shift));
+    p[0] = (uint8_t)w;
+    p[1] = (uint8_t)(w >> 8);
+}
+
+/**
+  * @brief  读取一个样本
+  */
+uint16_t Pack12_Get(const uint8_t *base, uint16_t index)
+{
+    const uint8_t *p = base + index + (index >> 1);
+
+    return (uint16_t)(((p[0] | (p[1] << 8)) >> ((index & 1u) << 2)) & 0x0FFFu);
+}
+
+/**
+  * @brief  连续打包count个样本，从第start个样本位置开始写入
+  */
+void Pack12_Pack(uint8_t *dst, uint16_t start, const uint16_t *src, uint16_t count)
+{
+    uint8_t *p;
+
+    if (count > 0 && (start & 1u))
+    {
+        Pack12_Put(dst, start, *src++);
+        start++;
+        count--;
+    }
+    p = dst + start + (start >> 1);
+    for (; count >= 2; count -= 2)
+    {
+        uint16_t a = src[0] & 0x0FFFu;
+        uint16_t b = src[1] & 0x0FFFu;
+
+        p[0] = (uint8_t)a;
+        p[1] = (uint8_t)((a >> 8) | (b << 4));
+        p[2] = (uint8_t)(b >> 4);
+        p += 3;
+        src += 2;
+    }
+    if (count > 0)
+    {
+        p[0] = (uint8_t)*src;
+        p[1] = (uint8_t)((p[1] & 0xF0u) | ((*src >> 8) & 0x0Fu));
+    }
+}
+
+/**
+  * @brief  从第start个样本起连续解包count个样本
+  */
+void Pack12_Unpack(uint16_t *dst, const uint8_t *src, uint16_t start, uint16_t count)
+{
+    const uint8_t *p;
+
+    if (count > 0 && (start & 1u))
+    {
+        *dst++ = Pack12_Get(src, start);
+        start++;
+        count--;
+    }
+    p = src + start + (start >> 1);
+    for (; count >= 2; count -= 2)
+    {
+        uint8_t b1 = p[1];
+
+        dst[0] = (uint16_t)(p[0] | ((b1 & 0x0Fu) << 8));
+        dst[1] = (uint16_t)((b1 >> 4) | (p[2] << 4));
+        p += 3;
+        dst += 2;
+    }
+    if (count > 0)
+    {
+        *dst = (uint16_t)(p[0] | ((p[1] & 0x0Fu) << 8));
+    }
+}
+
+/**
+  * @brief  写入环形打包区（超过末尾时回绕）
+  * @param  ring_size 环形缓冲样本数（偶数，样本对不跨越回绕点）
+  */
+void Pack12_PackRing(uint8_t *ring, uint16_t ring_size, uint16_t start, const uint16_t *src, uint16_t count)
+{
+    while (count > 0)
+    {
+        uint16_t n = ring_size - start;
+
+        if (n > count)
+            n = count;
+        Pack12_Pack(ring, start, src, n);
+        src += n;
+        count -= n;
+        start = 0;
+    }
+}
+
+/**
+  * @brief  从环形打包区读出（超过末尾时回绕）
+  */
+void Pack12_UnpackRing(uint16_t *dst, const uint8_t *ring, uint16_t ring_size, uint16_t start, uint16_t count)
+{
+    while (count > 0)
+    {
+        uint16_t n = ring_size - start;
+
+        if (n > count)
+            n = count;
+        Pack12_Unpack(dst, ring, start, n);
+        dst += n;
+        count -= n;
+        start = 0;
+    }
+}
+
+/**
+  * @brief  记录一次解包耗时，折算为每PACK12_BLOCK_SAMPLES个样本的周期数
+  */
+void Pack12_RecordCost(uint32_t cycles, uint16_t count)
+{
+    uint32_t per_block;
+
+    if (count == 0)
+        return;
+    per_block = cycles * PACK12_BLOCK_SAMPLES / count;
+    pack12_block_cycles_last = per_block;
+    if (per_block > pack12_block_cycles_max)
+        pack12_block_cycles_max = per_block;
+}
@@ -0,0 +1,28 @@
+#ifndef __PACK12_H
+#define __PACK12_H
+
+#include <stdint.h>
+
+/*
+ * 12位样本紧凑存储：每2个样本3字节（与RAW捕获帧的打包格式相同）
+ *   样本对k（样本2k、2k+1）占字节3k~3k+2：b0=a[7:0]，b1=a[11:8]|b[3:0]<<4，b2=b[11:4]
+ *   样本i的字节偏移为i+i/2，该处16位小端字右移(i&1)*4位取低12位即为样本，单点读写无分支
+ *   成块函数按样本对展开（每对3字节、无分支），只在起止位置为奇数时单独处理首尾样本；
+ *   环形版本在回绕处分成两段
+ *   调用者负责并发：环形缓冲只由采样中断写入，主循环只读写指针之前的样本
+ */
+#define PACK12_BYTES(n)         (((uint32_t)(n) * 3u + 1u) / 2u)
+#define PACK12_BLOCK_SAMPLES    50       // 解包耗时折算的块长（与DMA半缓冲一致）
+
+extern volatile uint32_t pack12_block_cycles_last;  // 最近一次解包折合每块周期数
+extern volatile uint32_t pack12_block_cycles_max;   // 折合每块最大周期数
+
+void Pack12_Put(uint8_t *base, uint16_t index, uint16_t value);
+uint16_t Pack12_Get(const uint8_t *base, uint16_t index);
+void Pack12_Pack(uint8_t *dst, uint16_t start, const uint16_t *src, uint16_t count);
+void Pack12_Unpack(uint16_t *dst, const uint8_t *src, uint16_t start, uint16_t count);
+void Pack12_PackRing(uint8_t *ring, uint16_t ring_size, uint16_t start, const uint16_t *src, uint16_t count);
+void Pack12_UnpackRing(uint16_t *dst, const uint8_t *ring, uint16_t ring_size, uint16_t start, uint16_t count);
+void Pack12_RecordCost(uint32_t cycles, uint16_t count);
+
+#endif
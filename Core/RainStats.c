@@ -0,0 +1,224 @@
+#include "RainStats.h"
+
+typedef struct
+{
+    RainBucket *ring;                    // 已完成的桶
+    uint8_t size;                        // 桶数
+    uint8_t period;                      // 每个桶包含的下级桶数
+    uint8_t index;                       // 下一个写入位置
+    uint8_t filled;                      // 已完成的桶数（不超过size）
+    uint8_t children;                    // 当前桶已累加的下级桶数
+    RainBucket cur;                      // 正在累计的桶
+    uint32_t sum_depth_nm;               // 环内全部桶的深度和
+    uint32_t sum_drops;                  // 环内全部桶的滴数和
+    uint32_t short_depth_nm;             // 最近RAINSTATS_SHORT_MINUTES个桶的深度和（仅分钟级）
+    uint32_t peak_min_nm;                // 当前桶内最大1分钟雨量（仅小时/天级）
+} RainLevel;
+
+static RainBucket ring_sec[60];
+static RainBucket ring_min[60];
+static RainBucket ring_hour[24];
+static RainBucket ring_day[7];
+
+static RainLevel rain_levels[RAIN_LEVEL_COUNT] =
+{
+    { ring_sec,  60, 1,  0, 0, 0, {0, 0}, 0, 0, 0, 0 },
+    { ring_min,  60, 60, 0, 0, 0, {0, 0}, 0, 0, 0, 0 },
+    { ring_hour, 24, 60, 0, 0, 0, {0, 0}, 0, 0, 0, 0 },
+    { ring_day,  7,  24, 0, 0, 0, {0, 0}, 0, 0, 0, 0 },
+};
+
+static uint32_t last_tick = 0;           // 上次推进时的采样计数
+static uint32_t pending_us = 0;          // 未满1秒的累计微秒
+
+/**
+  * @brief  清空全部统计并以tick_now为起点
+  */
+void RainStats_Reset(uint32_t tick_now)
+{
+    uint8_t l, i;
+
+    for (l = 0; l < RAIN_LEVEL_COUNT; l++)
+    {
+        RainLevel *lv = &rain_levels[l];
+        for (i = 0; i < lv->size; i++)
+        {
+            lv->ring[i].depth_nm = 0;
+            lv->ring[i].drops = 0;
+        }
+        lv->index = 0;
+        lv->filled = 0;
+        lv->children = 0;
+        lv->cur.depth_nm = 0;
+        lv->cur.drops = 0;
+        lv->sum_depth_nm = 0;
+        lv->sum_drops = 0;
+        lv->short_depth_nm = 0;
+        lv->peak_min_nm = 0;
+    }
+    last_tick = tick_now;
+    pending_us = 0;
+}
+
+/**
+  * @brief  当前桶入环：出环桶从窗口和中减去，新桶加入（O(1)）
+  */
+static void Level_Push(RainLevel *lv)
+{
+    RainBucket *slot = &lv->ring[lv->index];
+
+    lv->sum_depth_nm += lv->cur.depth_nm - slot->depth_nm;
+    lv->sum_drops += lv->cur.drops - slot->drops;
+    if (lv == &rain_levels[RAIN_LEVEL_MIN])
+    {
+        /* 短窗：加入新桶，减去第RAINSTATS_SHORT_MINUTES个之前的桶 */
+        uint8_t old = (uint8_t)((lv->index + lv->size - RAINSTATS_SHORT_MINUTES) % lv->size);
+        lv->short_depth_nm += lv->cur.depth_nm - lv->ring[old].depth_nm;
+    }
+
+    *slot = lv->cur;
+    lv->index = (uint8_t)((lv->index + 1) % lv->size);
+    if (lv->filled < lv->size)
+        lv->filled++;
+    lv->cur.depth_nm = 0;
+    lv->cur.drops = 0;
+}
+
+/**
+  * @brief  完成一秒：逐级向上结转
+  */
+static void RainStats_RollSecond(void)
+{
+    uint8_t l;
+    RainBucket done;
+
+    for (l = 0; l < RAIN_LEVEL_COUNT; l++)
+    {
+        RainLevel *lv = &rain_levels[l];
+
+        if (l > 0)
+        {
+            /* 把刚完成的下级桶累加到本级当前桶 */
+            lv->cur.depth_nm += done.depth_nm;
+            lv->cur.drops += done.drops;
+            if (++lv->children < lv->period)
+                break;
+            lv->children = 0;
+        }
+
+        if (l == RAIN_LEVEL_MIN)
+        {
+            /* 一分钟完成：更新小时/天内的最大1分钟雨量 */
+            uint8_t k;
+            for (k = RAIN_LEVEL_HOUR; k < RAIN_LEVEL_COUNT; k++)
+            {
+                if (lv->cur.depth_nm > rain_levels[k].peak_min_nm)
+                    rain_levels[k].peak_min_nm = lv->cur.depth_nm;
+            }
+        }
+        else if (l >= RAIN_LEVEL_HOUR)
+        {
+            lv->peak_min_nm = 0;         // 新的小时/天重新统计峰值
+        }
+
+        done = lv->cur;
+        Level_Push(lv);
+    }
+}
+
+/**
+  * @brief  按采样计数推进时间（每次主循环调用）
+  * @param  tick_now 当前sampling_tick_counter
+  */
+void RainStats_Advance(uint32_t tick_now)
+{
+    pending_us += (tick_now - last_tick) * RAINSTATS_TICK_US;
+    last_tick = tick_now;
+    while (pending_us >= 1000000u)
+    {
+        pending_us -= 1000000u;
+        RainStats_RollSecond();
+    }
+}
+
+/**
+  * @brief  记录一滴
+  * @param  depth_nm 单滴雨量深度（纳米）
+  */
+void RainStats_AddDrop(uint32_t depth_nm)
+{
+    rain_levels[RAIN_LEVEL_SEC].cur.depth_nm += depth_nm;
+    rain_levels[RAIN_LEVEL_SEC].cur.drops++;
+}
+
+/* 深度(nm) / 窗口(秒) -> 0.01mm/h：nm*3600/window_s/1e4 */
+static uint16_t Depth_To_Intensity(uint32_t depth_nm, uint32_t window_s)
+{
+    uint32_t v = (uint32_t)(((uint64_t)depth_nm * 36u) / (window_s * 100u));
+    return (v > 0xFFFF) ? 0xFFFF : (uint16_t)v;
+}
+
+uint16_t RainStats_Intensity1Min(void)
+{
+    return Depth_To_Intensity(rain_levels[RAIN_LEVEL_SEC].sum_depth_nm, 60);
+}
+
+uint16_t RainStats_Intensity10Min(void)
+{
+    return Depth_To_Intensity(rain_levels[RAIN_LEVEL_MIN].short_depth_nm, RAINSTATS_SHORT_MINUTES * 60u);
+}
+
+uint16_t RainStats_Intensity60Min(void)
+{
+    return Depth_To_Intensity(rain_levels[RAIN_LEVEL_MIN].sum_depth_nm, 3600);
+}
+
+/**
+  * @brief  当前小时/天内最大1分钟雨强
+  * @param  level RAIN_LEVEL_HOUR或RAIN_LEVEL_DAY
+  */
+uint16_t RainStats_PeakIntensity(uint8_t level)
+{
+    if (level < RAIN_LEVEL_HOUR || level >= RAIN_LEVEL_COUNT)
+        return 0;
+    return Depth_To_Intensity(rain_levels[level].peak_min_nm, 60);
+}
+
+/**
+  * @brief  当前分钟/小时/天累计雨量（包含各下级未完成的桶）
+  */
+uint32_t RainStats_CurrentUm(uint8_t level)
+{
+    uint32_t nm = 0;
+    uint8_t l;
+
+    for (l = 0; l <= level && l < RAIN_LEVEL_COUNT; l++)
+    {
+        nm += rain_levels[l].cur.depth_nm;
+    }
+    return nm / 1000u;
+}
+
+uint32_t RainStats_CurrentDrops(uint8_t level)
+{
+    uint32_t drops = 0;
+    uint8_t l;
+
+    for (l = 0; l <= level && l < RAIN_LEVEL_COUNT; l++)
+    {
+        drops += rain_levels[l].cur.drops;
+    }
+    return drops;
+}
+
+const RainBucket *RainStats_Bucket(uint8_t level, uint8_t age)
+{
+    RainLevel *lv;
+
+    if (level >= RAIN_LEVEL_COUNT)
+        return 0;
+    lv = &rain_levels[level];
+    if (age >= lv->filled)
+        return 0;
+    return &lv->ring[(lv->index + lv->size - 1 - age) % lv->size];
+}
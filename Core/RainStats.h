@@ -0,0 +1,46 @@
+#ifndef __RAINSTATS_H
+#define __RAINSTATS_H
+
+#include <stdint.h>
+
+/*
+ * 多分辨率雨量统计（级联环形聚合）
+ *   级别        桶长    桶数  窗口
+ *   RAIN_LEVEL_SEC   1s     60   最近1分钟
+ *   RAIN_LEVEL_MIN   1min   60   最近10分钟（短窗）/60分钟
+ *   RAIN_LEVEL_HOUR  1h     24   最近24小时
+ *   RAIN_LEVEL_DAY   1d      7   最近7天
+ *   每个桶记录雨量深度(nm)与滴数；下级桶完成时累加到上级当前桶，
+ *   窗口和在桶入环/出环时增量更新，任何读取均为O(1)
+ *   峰值：每完成1分钟，用该分钟雨量更新所在小时/天的最大1分钟雨强
+ *   时间基准为ADC采样计数（RAINSTATS_TICK_US微秒/样本），不依赖主循环节拍
+ *   内存：(60+60+24+7)*8 + 级别头 ≈ 1.3KB
+ */
+#define RAIN_LEVEL_SEC          0
+#define RAIN_LEVEL_MIN          1
+#define RAIN_LEVEL_HOUR         2
+#define RAIN_LEVEL_DAY          3
+#define RAIN_LEVEL_COUNT        4
+
+#define RAINSTATS_TICK_US       42u      // 每个采样计数的微秒数（与ADC_SAMPLE_INTERVAL_US一致）
+#define RAINSTATS_SHORT_MINUTES 10       // 分钟级短窗长度
+
+typedef struct
+{
+    uint32_t depth_nm;                   // 雨量深度（纳米）
+    uint32_t drops;                      // 滴数
+} RainBucket;
+
+void RainStats_Reset(uint32_t tick_now);
+void RainStats_Advance(uint32_t tick_now);
+void RainStats_AddDrop(uint32_t depth_nm);
+
+uint16_t RainStats_Intensity1Min(void);         // 0.01mm/h，最近60秒
+uint16_t RainStats_Intensity10Min(void);        // 0.01mm/h，最近10个完整分钟
+uint16_t RainStats_Intensity60Min(void);        // 0.01mm/h，最近60个完整分钟
+uint16_t RainStats_PeakIntensity(uint8_t level); // 0.01mm/h，当前小时/天内最大1分钟雨强
+uint32_t RainStats_CurrentUm(uint8_t level);    // 当前分钟/小时/天（含未完成部分）累计雨量（um）
+uint32_t RainStats_CurrentDrops(uint8_t level); // 同上，滴数
+const RainBucket *RainStats_Bucket(uint8_t level, uint8_t age); // 第age个已完成的桶（0=最近），越界返回0
+
+#endif
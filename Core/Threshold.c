@@ -0,0 +1,105 @@
+#include "Threshold.h"
+#include "CoreHal.h"
+
+volatile uint16_t dynamic_threshold = THRESHOLD_INIT;  // 动态阈值变量（通道0）- 在中断中使用，需volatile
+volatile uint16_t noise_mad_estimate = 0;
+
+/**
+  * @brief  恢复初始阈值（主机回放/测试用；固件由热启动或静态初值决定）
+  */
+void Threshold_Reset(void)
+{
+	dynamic_threshold = THRESHOLD_INIT;
+	noise_mad_estimate = 0;
+}
+
+/**
+  * @brief  更新自适应阈值
+  * @param  window 解包噪声窗口用的临时区（至少NOISE_WINDOW个样本，调用期间独占）
+  * @retval 无
+  * @note   主循环每轮调用一次（10ms）
+  */
+void Threshold_Update(uint16_t *window)
+{
+	uint32_t t0;                           // 解包起始周期
+	int32_t sum;                           // 求和变量
+	uint16_t i;                           // 循环计数器
+	int16_t start;                        // 起始索引
+	int32_t mean_times_1;                 // 均值变量
+	int32_t mad_sum;                      // 平均绝对偏差和
+	int32_t mad;                          // 平均绝对偏差
+	int32_t target;                       // 目标阈值
+
+	/* 环形缓冲尚未填满噪声窗口时不更新，保留冷启动默认值或热启动恢复值 */
+	if (sampling_tick_counter < NOISE_WINDOW)
+		return;
+
+	/* ========== 通道0阈值计算（单通道PA0） ========== */
+	/* 改进：排除异常峰值，避免干扰影响阈值计算 */
+	/* 先计算均值，然后排除明显异常值（超过均值+3*MAD的样本） */
+	start = (int16_t)ring_write_index_ch0 - NOISE_WINDOW;
+	if (start < 0) start += RING_BUFFER_SIZE;
+	/* 窗口只解包一次，四遍统计都在解包后的数组上进行 */
+	t0 = CoreHal_Cycles();
+	Pack12_UnpackRing(window, (const uint8_t *)adc_ring_packed_ch0, RING_BUFFER_SIZE, (uint16_t)start, NOISE_WINDOW);
+	Pack12_RecordCost(CoreHal_Cycles() - t0, NOISE_WINDOW);
+
+	sum = 0;
+	for (i = 0; i < NOISE_WINDOW; i++)
+	{
+		sum += window[i];
+	}
+	mean_times_1 = sum / (int32_t)NOISE_WINDOW;
+	
+	/* 计算MAD用于识别异常值 */
+	mad_sum = 0;
+	for (i = 0; i < NOISE_WINDOW; i++)
+	{
+		int32_t v = (int32_t)window[i];
+		int32_t d = v - mean_times_1;
+		if (d < 0) d = -d;
+		mad_sum += d;
+	}
+	int32_t mad_pre = mad_sum / (int32_t)NOISE_WINDOW;
+	
+	/* 排除异常值后重新计算均值 */
+	sum = 0;
+	uint16_t valid_count = 0;
+	int32_t outlier_threshold = mean_times_1 + (int32_t)(3 * mad_pre);
+	for (i = 0; i < NOISE_WINDOW; i++)
+	{
+		int32_t v = (int32_t)window[i];
+		/* 排除明显异常值（可能是干扰峰值） */
+		if (v <= outlier_threshold)
+		{
+			sum += v;
+			valid_count++;
+		}
+	}
+	if (valid_count > 0)
+	{
+		mean_times_1 = sum / (int32_t)valid_count;
+	}
+
+	mad_sum = 0;
+	for (i = 0; i < NOISE_WINDOW; i++)
+	{
+		int32_t v = (int32_t)window[i];
+		int32_t d = v - mean_times_1;
+		if (d < 0) d = -d;
+		mad_sum += d;
+	}
+	mad = mad_sum / (int32_t)NOISE_WINDOW;
+	noise_mad_estimate = (uint16_t)mad;
+
+	target = mean_times_1 + (int32_t)(MAD_GAIN * mad);
+	if (target < MIN_THRESHOLD) target = MIN_THRESHOLD; // 限制最小值400mV
+	if (target > MAX_THRESHOLD) target = MAX_THRESHOLD;
+
+	if ((int32_t)dynamic_threshold - target > HYSTERESIS_MARGIN ||
+		target - (int32_t)dynamic_threshold > HYSTERESIS_MARGIN)
+	{
+		dynamic_threshold = (uint16_t)target;
+		CoreHal_SetThreshold(dynamic_threshold); // 固件：设置ADC模拟看门狗阈值（通道0/PA0）
+	}
+}
@@ -0,0 +1,31 @@
+#ifndef __THRESHOLD_H
+#define __THRESHOLD_H
+
+#include <stdint.h>
+#include "Detector.h"
+
+/*
+ * 自适应触发阈值（主循环调用）
+ *   从环形缓冲取最近NOISE_WINDOW个样本：均值 → MAD → 剔除超过均值+3*MAD的样本后重算均值与MAD，
+ *   目标阈值 = 均值 + MAD_GAIN*MAD，限幅到[MIN_THRESHOLD, MAX_THRESHOLD]，
+ *   与当前阈值相差超过HYSTERESIS_MARGIN才更新，并经CoreHal_SetThreshold通知平台
+ *   dynamic_threshold同时是采样中断中在线峰值检测的触发门限
+ */
+#define THRESHOLD_INIT          496      // 初始阈值（ADC单位，400mV = 400/3.3*4095 ≈ 496）
+#define NOISE_WINDOW            200      // 噪声统计窗口长度（从环形缓冲末端向前取）
+#define MIN_THRESHOLD           496      // 阈值下限，防止过低（400mV = 400/3.3*4095 ≈ 496）
+#define MAX_THRESHOLD           3000     // 阈值上限，防止过高
+#define MAD_GAIN                3        // 平均绝对偏差放大倍数
+#define HYSTERESIS_MARGIN       15       // 阈值滞回，降低抖动
+
+#if NOISE_WINDOW > RING_BUFFER_SIZE
+#error "噪声窗口超出环形缓冲"
+#endif
+
+extern volatile uint16_t dynamic_threshold;   // 动态阈值（通道0），中断中读取
+extern volatile uint16_t noise_mad_estimate;  // 最近一次噪声MAD估计（ADC单位）
+
+void Threshold_Reset(void);
+void Threshold_Update(uint16_t *window);
+
+#endif
@@ -0,0 +1,616 @@
+#include "Validate.h"
+
+/* 事件与抗干扰判定 */
+#define MIN_PEAK_DELTA_OVER_THR 8        // 峰值需高出阈值的最小余量（约6.5mV，适配小信号）
+#define MIN_LOCAL_DELTA         6        // 峰值相对于邻近样本的最小差值（适配小信号）
+#define MIN_RISE_SAMPLES        3        // 峰前上升最少采样点数
+#define MIN_DECAY_SAMPLES       3        // 峰后下降最少采样点数
+#define SHAPE_WINDOW_PRE        12       // 峰前用于形状判定的样本数
+#define SHAPE_WINDOW_POST       24       // 峰后用于形状判定的样本数
+
+/* 时间特征判定参数：区分真实雨滴信号和噪声干扰 */
+#define MIN_RISE_TIME_US        300      // 最小上升时间（微秒），适配小雨滴信号（降低到300us）
+#define MIN_FALL_TIME_US        300      // 最小下降时间（微秒），适配小雨滴信号（降低到300us）
+#define MIN_PULSE_DURATION_US   600      // 最小脉冲持续时间（微秒），适配小雨滴信号（降低到600us，约0.6ms）
+#define MAX_NOISE_PULSE_WIDTH   10       // 最大噪声脉冲宽度（采样点数），超过此宽度才可能是真实信号（约420us）
+
+/* 形状平滑度判定参数：真实信号相对平滑，干扰可能很陡峭 */
+#define MIN_SMOOTH_RISE_RATIO   0.25f    // 最小平滑上升比例：适配小雨滴信号（降低到25%）
+#define MIN_SMOOTH_FALL_RATIO   0.25f    // 最小平滑下降比例：适配小雨滴信号（降低到25%）
+#define MAX_STEEP_SLOPE         50       // 最大陡峭斜率（ADC单位/样本），适配小雨滴信号（提高到50）
+#define PEAK_STABILITY_WINDOW   5        // 峰值稳定性窗口：峰值附近±N个样本应该接近峰值
+#define PEAK_STABILITY_DELTA    30       // 峰值稳定性容差：峰值附近样本与峰值的最大差值
+
+/* 信号平滑滤波参数 */
+#define SMOOTH_FILTER_SIZE      3        // 移动平均滤波窗口大小（3点或5点）
+#define BASELINE_SAMPLE_COUNT   80       // 基线估算样本数
+#define LOCAL_REFINEMENT_RADIUS 6        // 峰值局部搜索半径
+#define MIN_PEAK_AMPLITUDE      500      // 最小峰值幅度（ADC单位，约400mV），适配420-540mV小雨滴信号
+
+/* 峰值搜索与前部分割参数 */
+#define PEAK_SEARCH_HALFSPAN    80       // 在触发点附近±半窗口内搜索峰值
+#define PEAK_SEARCH_CENTER      SNAPSHOT_PRE_SAMPLES  // 触发点索引（预触发长度）
+#define TAIL_SETTLE_COUNT       5        // 识别回落到基线所需的连续样本数
+
+/* 前/后部分割参数（仅分析前部“上升→峰值→回落到基线”） */
+#define FRONT_START_DELTA       MIN_LOCAL_DELTA   // 认为“离开基线”的门限
+#define FRONT_END_DELTA         MIN_LOCAL_DELTA   // 认为“回到基线”的门限
+#define FRONT_END_SETTLE_COUNT  TAIL_SETTLE_COUNT// 回落连续样本计数
+
+/* 严格前部处理：每个脉冲信号只取前部（约2ms），后部数据完全不分析，避免后部抖动导致跳变 */
+#define FRONT_ANALYSIS_TIME_MS  2.0f              // 前部分析时间窗口（毫秒）
+#define FRONT_ANALYSIS_SAMPLES   ((uint16_t)(FRONT_ANALYSIS_TIME_MS * 1000.0f / ADC_SAMPLE_INTERVAL_US))  // 前部分析采样点数（约48点）
+
+static void Smooth_Filter(const uint16_t *buf, uint16_t *smoothed, uint16_t len, uint16_t start_idx, uint16_t end_idx);
+static int32_t Compute_Baseline(const uint16_t *buf, uint16_t len);
+static void Find_Peak_In_Buffer(const uint16_t *buf, uint16_t len, int32_t baseline,
+                                uint16_t *peak_index, uint16_t *peak_value,
+                                uint16_t search_start, uint16_t search_end);
+
+/**
+  * @brief  判定一个完整快照
+  * @param  buf     快照（触发样本位于PEAK_SEARCH_CENTER）
+  * @param  len     样本数
+  * @param  threshold 当前动态阈值
+  * @param  scratch 平滑用临时区（至少len个样本，调用期间独占）
+  * @param  out     判定结果（基线、前部区间、前部峰值、拒绝原因）
+  * @retval REJECT_NONE：有效雨滴，其他：拒绝原因
+  * @note   只分析“上升→峰值→回落至基线”的前部：触发点起FRONT_ANALYSIS_SAMPLES个样本，
+  *         后部震荡不参与峰值与形状判定；峰值搜索可向预触发区延伸PEAK_SEARCH_HALFSPAN点
+  */
+uint8_t Validate_Snapshot(const uint16_t *buf, uint16_t len, uint16_t threshold,
+                          uint16_t *scratch, SnapshotVerdict *out)
+{
+	uint16_t high_peak_idx = 0, high_peak_val = 0;
+
+	int32_t baseline_high = Compute_Baseline(buf, len);
+
+	/* 严格前部处理：初始峰值搜索允许在预触发区域和前部窗口内搜索，但不搜索后部数据 */
+	/* 定义前部分析窗口：触发点后的前2ms（约48个采样点），完全忽略后部数据 */
+	uint16_t front_window_start = PEAK_SEARCH_CENTER;  // 触发点索引（200）
+	uint16_t front_window_end = PEAK_SEARCH_CENTER + FRONT_ANALYSIS_SAMPLES;  // 触发点后2ms（248）
+	if (front_window_end > len)
+	{
+		front_window_end = len - 1;
+	}
+
+	/* 峰值搜索窗口：允许在预触发区域（触发点前80点）和前部窗口内搜索，确保能找到峰值 */
+	/* 但分析时只使用前部窗口的数据，不分析后部数据 */
+	uint16_t search_start = (PEAK_SEARCH_CENTER > PEAK_SEARCH_HALFSPAN) ?
+		(PEAK_SEARCH_CENTER - PEAK_SEARCH_HALFSPAN) : 0;  // 允许搜索预触发区域
+	uint16_t search_end = front_window_end - 1;  // 限制在前部窗口结束位置，不搜索后部
+
+	Find_Peak_In_Buffer(buf, len, baseline_high,
+	                    &high_peak_idx, &high_peak_val, search_start, search_end);
+
+	const uint16_t *active_buffer = buf;
+	int32_t active_baseline = baseline_high;
+	uint16_t active_peak_index = high_peak_idx;
+	uint16_t active_peak_value = high_peak_val;
+
+	/* 严格前部处理：只分析前部窗口内的数据（触发点后2ms），完全忽略后部数据 */
+	/* 注意：front_window_start和front_window_end已在上面定义 */
+	uint16_t start_index = front_window_start;    // front_start，从触发点开始
+	while (start_index < front_window_end && active_buffer[start_index] <= (active_baseline + FRONT_START_DELTA))
+	{
+		start_index++;
+	}
+	if (start_index > active_peak_index)
+	{
+		start_index = (active_peak_index > SHAPE_WINDOW_PRE) ? (active_peak_index - SHAPE_WINDOW_PRE) : front_window_start;
+	}
+	if (start_index < front_window_start)
+	{
+		start_index = front_window_start;
+	}
+
+	uint16_t end_index = active_peak_index;   // front_end 初始从峰值开始向后搜索
+	while (end_index < front_window_end && active_buffer[end_index] > (active_baseline + FRONT_END_DELTA))
+	{
+		end_index++;
+	}
+	/* 限制end_index不超过前部窗口结束位置 */
+	if (end_index >= front_window_end)
+	{
+		end_index = front_window_end - 1;
+	}
+
+	/* 进一步确认回落点：需连续 TAIL_SETTLE_COUNT 个样本低于基线+delta */
+	/* 但限制在前部窗口内搜索，不搜索后部数据 */
+	uint16_t settle_idx = active_peak_index + 1;
+	uint8_t settle_count = 0;
+	uint16_t trimmed_end = end_index;
+	while (settle_idx <= end_index && settle_idx < front_window_end)
+	{
+		if (active_buffer[settle_idx] <= (active_baseline + FRONT_END_DELTA))
+		{
+			settle_count++;
+			if (settle_count >= FRONT_END_SETTLE_COUNT)
+			{
+				trimmed_end = settle_idx - (TAIL_SETTLE_COUNT - 1);
+				break;
+			}
+		}
+		else
+		{
+			settle_count = 0;
+		}
+		settle_idx++;
+	}
+	end_index = trimmed_end;
+	if (end_index <= active_peak_index)
+		end_index = (active_peak_index < len - 1) ? (active_peak_index + 1) : active_peak_index;
+	/* 确保end_index不超过前部窗口结束位置 */
+	if (end_index >= front_window_end)
+	{
+		end_index = front_window_end - 1;
+	}
+
+	/* 在前部区间 [start_index, end_index] 内重新搜索峰值，保证峰值仅来自前部 */
+	/* 如果初始搜索找到的峰值不在前部窗口内，在前部窗口内重新搜索 */
+	uint16_t front_peak_index = active_peak_index;
+	uint16_t front_peak_value = active_peak_value;
+	
+	/* 验证峰值是否在前部窗口内 */
+	if (active_peak_index < front_window_start || active_peak_index >= front_window_end)
+	{
+		/* 峰值不在前部窗口内（可能在预触发区域），在前部窗口内重新搜索峰值 */
+		front_peak_index = front_window_start;
+		front_peak_value = active_buffer[front_window_start];
+		for (uint16_t i = front_window_start + 1; i < front_window_end; i++)
+		{
+			if (active_buffer[i] > front_peak_value)
+			{
+				front_peak_value = active_buffer[i];
+				front_peak_index = i;
+			}
+		}
+	}
+	else if (end_index >= start_index)
+	{
+		/* 峰值在前部窗口内，在前部区间内重新搜索峰值 */
+		front_peak_index = start_index;
+		front_peak_value = active_buffer[start_index];
+		for (uint16_t i = start_index + 1; i <= end_index; i++)
+		{
+			if (active_buffer[i] > front_peak_value)
+			{
+				front_peak_value = active_buffer[i];
+				front_peak_index = i;
+			}
+		}
+	}
+
+	out->baseline = active_baseline;
+	out->start_index = start_index;
+	out->end_index = end_index;
+	out->peak_index = front_peak_index;
+	out->peak_value = front_peak_value;
+	out->reject = Validate_And_Count_Event(active_buffer, end_index + 1, front_peak_index, front_peak_value,
+	                                       threshold, start_index, end_index, scratch);
+	return out->reject;
+}
+
+/**
+  * @brief  对缓冲区进行移动平均滤波，减少ADC量化噪声
+  * @param  buf: 输入缓冲区
+  * @param  smoothed: 输出平滑后的缓冲区
+  * @param  len: 缓冲区长度
+  * @param  start_idx: 起始索引
+  * @param  end_idx: 结束索引
+  * @retval 无
+  */
+static void Smooth_Filter(const uint16_t *buf, uint16_t *smoothed, uint16_t len, uint16_t start_idx, uint16_t end_idx)
+{
+	uint16_t i;
+	uint16_t half_window = SMOOTH_FILTER_SIZE / 2;
+	
+	for (i = start_idx; i <= end_idx && i < len; i++)
+	{
+		uint32_t sum = 0;
+		uint16_t count = 0;
+		
+		/* 计算移动平均：取当前点及其前后各half_window个点 */
+		int16_t win_start = (int16_t)i - (int16_t)half_window;
+		int16_t win_end = (int16_t)i + (int16_t)half_window;
+		
+		/* 限制窗口范围在有效区间内 */
+		if (win_start < (int16_t)start_idx) win_start = (int16_t)start_idx;
+		if (win_end > (int16_t)end_idx) win_end = (int16_t)end_idx;
+		if (win_end >= (int16_t)len) win_end = (int16_t)len - 1;
+		
+		for (int16_t j = win_start; j <= win_end; j++)
+		{
+			if (j >= 0 && j < (int16_t)len)
+			{
+				sum += buf[j];
+				count++;
+			}
+		}
+		
+		if (count > 0)
+		{
+			smoothed[i] = (uint16_t)(sum / count);
+		}
+		else
+		{
+			smoothed[i] = buf[i];
+		}
+	}
+}
+
+/**
+  * @brief  验证并计数事件
+  * @param  buf: 数据缓冲区指针
+  * @param  len: 缓冲区长度
+  * @param  peak_index: 峰值索引
+  * @param  peak_value: 峰值数值
+  * @param  threshold: 对应通道的动态阈值
+  * @param  scratch: 平滑用临时区（至少len个样本）
+  * @retval REJECT_NONE: 有效事件，其他: 拒绝原因（REJECT_xxx，首个未通过的判定）
+  * @note   验证事件的有效性，包括幅值判定和形状判定
+  */
+uint8_t Validate_And_Count_Event(const uint16_t *buf, uint16_t len, uint16_t peak_index, uint16_t peak_value,
+                                 uint16_t threshold, uint16_t start_index, uint16_t end_index, uint16_t *scratch)
+{
+	uint16_t pre;                        // 峰前样本数
+	uint16_t post;                       // 峰后样本数
+	uint16_t rise_ok;                    // 上升斜率计数
+	uint16_t decay_ok;                   // 下降斜率计数
+	int i;                               // 循环计数器
+
+	if (len == 0 || start_index >= len)
+		return REJECT_RANGE;
+	if (end_index >= len)
+		end_index = len - 1;
+	if (peak_index < start_index || peak_index > end_index)
+		return REJECT_RANGE;
+	
+	/* 0) 信号平滑滤波：减少ADC量化噪声，让信号特征更明显 */
+	/* 平滑后的缓冲区在调用者提供的临时区（固件为arena_work），只在本函数内有效 */
+	uint16_t *smoothed_buf = scratch;
+	uint16_t smooth_start = (start_index > 0) ? (start_index - 1) : 0;
+	uint16_t smooth_end = (end_index < len - 1) ? (end_index + 1) : (len - 1);
+	
+	/* 对有效区间进行平滑滤波 */
+	Smooth_Filter(buf, smoothed_buf, len, smooth_start, smooth_end);
+	/* 区间以外保留原始样本：临时区与其他使用者共用，不能依赖上次留下的内容 */
+	for (i = 0; i < smooth_start; i++)
+		smoothed_buf[i] = buf[i];
+	for (i = smooth_end + 1; i < len; i++)
+		smoothed_buf[i] = buf[i];
+	
+	/* 使用平滑后的数据进行后续判定 */
+	const uint16_t *filtered_buf = smoothed_buf;
+	
+	/* 重新计算平滑后的峰值（在峰值附近搜索） */
+	uint16_t filtered_peak_value = filtered_buf[peak_index];
+	uint16_t filtered_peak_index = peak_index;
+	for (i = (peak_index > 2) ? (peak_index - 2) : 0; 
+	     i <= ((peak_index + 2 < len) ? (peak_index + 2) : (len - 1)); 
+	     i++)
+	{
+		if (filtered_buf[i] > filtered_peak_value)
+		{
+			filtered_peak_value = filtered_buf[i];
+			filtered_peak_index = i;
+		}
+	}
+	
+	/* 更新使用平滑后的峰值和缓冲区 */
+	peak_value = filtered_peak_value;
+	peak_index = filtered_peak_index;
+	buf = filtered_buf;
+
+	/* 1) 幅值判定 */
+	if (peak_value <= threshold) return REJECT_THRESHOLD; // 如果峰值不超过通道阈值
+	if (peak_value < (uint16_t)(threshold + MIN_PEAK_DELTA_OVER_THR)) return REJECT_MARGIN; // 如果峰值余量不足
+	if (peak_value < MIN_PEAK_AMPLITUDE) return REJECT_AMPLITUDE; // 如果峰值幅度太小，可能是噪声
+
+	/* 2) 形状判定：峰前上升&峰后下降（避免随机振动） */
+	uint16_t available_pre = peak_index - start_index;
+	pre = (available_pre > SHAPE_WINDOW_PRE) ? SHAPE_WINDOW_PRE : available_pre; // 计算峰前样本数
+	uint16_t available_post = (end_index > peak_index) ? (end_index - peak_index) : 0;
+	post = (available_post > SHAPE_WINDOW_POST) ? SHAPE_WINDOW_POST : available_post; // 计算峰后样本数
+	if (pre < MIN_RISE_SAMPLES || post < MIN_DECAY_SAMPLES) return REJECT_SAMPLES; // 如果样本数不足
+
+	/* 峰前：计算上升斜率数量 */
+	rise_ok = 0;                         // 初始化上升计数
+	int rise_start = (int)peak_index - (int)pre + 1;
+	if (rise_start < (int)start_index + 1)
+		rise_start = (int)start_index + 1;
+	for (i = rise_start; i <= (int)peak_index; i++) // 遍历峰前样本
+	{
+		if (buf[i] > buf[i - 1]) rise_ok++; // 如果当前值大于前一个值，计数加1
+	}
+	/* 峰后：计算下降斜率数量 */
+	decay_ok = 0;                        // 初始化下降计数
+	int decay_end = (int)peak_index + (int)post;
+	if (decay_end > (int)end_index)
+		decay_end = (int)end_index;
+	for (i = (int)peak_index + 1; i <= decay_end; i++) // 遍历峰后样本
+	{
+		if (buf[i] < buf[i - 1]) decay_ok++; // 如果当前值小于前一个值，计数加1
+	}
+	if (rise_ok < MIN_RISE_SAMPLES || decay_ok < MIN_DECAY_SAMPLES)
+	{
+		/* 对于窄脉冲，要求更严格的差值条件，避免噪声误判 */
+		uint16_t left_now = (peak_index > start_index) ? buf[peak_index - 1] : buf[peak_index];
+		uint16_t right_now = ((peak_index + 1) <= end_index) ? buf[peak_index + 1] : buf[peak_index];
+		/* 要求峰值相对于邻近样本的差值至少是 MIN_LOCAL_DELTA 的2倍 */
+		uint16_t min_diff_required = MIN_LOCAL_DELTA * 2;
+		if ((peak_value > left_now + min_diff_required) && (peak_value > right_now + min_diff_required))
+		{
+			return REJECT_NONE;
+		}
+		/* 如果前后样本差值不足，检查更远的样本 */
+		if ((peak_index > (start_index + 1)) && peak_value > buf[peak_index - 2] + min_diff_required)
+		{
+			if ((peak_index + 2) <= end_index && peak_value > buf[peak_index + 2] + min_diff_required)
+			{
+				return REJECT_NONE;
+			}
+		}
+		return REJECT_NARROW;
+	}
+
+	/* 3) 时间特征判定：区分真实雨滴信号和噪声干扰 */
+	/* 真实信号：上升→峰值→下降有一定时间，噪声：快速毛刺 */
+	
+	/* 3.1 快速过滤明显毛刺：脉冲宽度太窄直接判定为噪声 */
+	uint16_t pulse_width_samples = end_index - start_index + 1;
+	if (pulse_width_samples <= MAX_NOISE_PULSE_WIDTH)
+	{
+		/* 脉冲宽度小于等于10个采样点（约420us），判定为噪声毛刺 */
+		return REJECT_WIDTH;
+	}
+	
+	/* 3.2 计算上升时间：从开始到峰值的时间 */
+	uint16_t rise_samples = (peak_index > start_index) ? (peak_index - start_index) : 1;
+	float rise_time_us = (float)rise_samples * ADC_SAMPLE_INTERVAL_US;
+	
+	/* 3.3 计算下降时间：从峰值到结束的时间 */
+	uint16_t fall_samples = (end_index > peak_index) ? (end_index - peak_index) : 1;
+	float fall_time_us = (float)fall_samples * ADC_SAMPLE_INTERVAL_US;
+	
+	/* 3.4 计算总脉冲持续时间 */
+	float pulse_duration_us = (float)pulse_width_samples * ADC_SAMPLE_INTERVAL_US;
+	
+	/* 3.5 时间特征判定：真实信号必须有足够的上升时间、下降时间和总持续时间 */
+	if (rise_time_us < MIN_RISE_TIME_US)
+	{
+		/* 上升时间太短，可能是快速毛刺噪声 */
+		return REJECT_RISE_TIME;
+	}
+	
+	if (fall_time_us < MIN_FALL_TIME_US)
+	{
+		/* 下降时间太短，可能是快速毛刺噪声 */
+		return REJECT_FALL_TIME;
+	}
+	
+	if (pulse_duration_us < MIN_PULSE_DURATION_US)
+	{
+		/* 总持续时间太短，可能是快速毛刺噪声 */
+		return REJECT_DURATION;
+	}
+	
+	/* 3.6 上升下降平滑度判定：真实信号相对平滑，干扰可能很陡峭 */
+	/* 计算上升过程中的平滑上升比例 */
+	uint16_t smooth_rise_count = 0;
+	uint16_t continuous_rise_count = 0;  // 连续上升计数
+	uint16_t max_continuous_rise = 0;    // 最大连续上升长度
+	uint16_t total_rise_samples = (peak_index > start_index) ? (peak_index - start_index) : 1;
+	if (total_rise_samples > 1)
+	{
+		for (i = start_index + 1; i <= peak_index; i++)
+		{
+			uint16_t diff = (buf[i] > buf[i - 1]) ? (buf[i] - buf[i - 1]) : 0;
+			/* 平滑上升：差值不超过最大陡峭斜率 */
+			if (diff > 0 && diff <= MAX_STEEP_SLOPE)
+			{
+				smooth_rise_count++;
+				continuous_rise_count++;
+				if (continuous_rise_count > max_continuous_rise)
+				{
+					max_continuous_rise = continuous_rise_count;
+				}
+			}
+			else
+			{
+				continuous_rise_count = 0;  // 重置连续计数
+			}
+		}
+	}
+	float smooth_rise_ratio = (total_rise_samples > 0) ? 
+		((float)smooth_rise_count / (float)total_rise_samples) : 0.0f;
+	
+	/* 计算下降过程中的平滑下降比例 */
+	uint16_t smooth_fall_count = 0;
+	uint16_t continuous_fall_count = 0;  // 连续下降计数
+	uint16_t max_continuous_fall = 0;     // 最大连续下降长度
+	uint16_t total_fall_samples = (end_index > peak_index) ? (end_index - peak_index) : 1;
+	if (total_fall_samples > 1)
+	{
+		for (i = peak_index + 1; i <= end_index; i++)
+		{
+			uint16_t diff = (buf[i - 1] > buf[i]) ? (buf[i - 1] - buf[i]) : 0;
+			/* 平滑下降：差值不超过最大陡峭斜率 */
+			if (diff > 0 && diff <= MAX_STEEP_SLOPE)
+			{
+				smooth_fall_count++;
+				continuous_fall_count++;
+				if (continuous_fall_count > max_continuous_fall)
+				{
+					max_continuous_fall = continuous_fall_count;
+				}
+			}
+			else
+			{
+				continuous_fall_count = 0;  // 重置连续计数
+			}
+		}
+	}
+	float smooth_fall_ratio = (total_fall_samples > 0) ? 
+		((float)smooth_fall_count / (float)total_fall_samples) : 0.0f;
+	
+	/* 增强判定：要求有足够的连续上升/下降，确保信号有明确的趋势 */
+	/* 根据信号幅度动态调整要求：小雨滴信号可能连续性稍弱 */
+	uint16_t min_continuous_required;
+	if (peak_value > 650)  // 大于650 ADC单位（约520mV），要求更严格
+	{
+		min_continuous_required = (total_rise_samples > 5) ? 3 : 2;
+	}
+	else  // 小雨滴信号（420-540mV），要求放宽
+	{
+		min_continuous_required = 1;  // 至少连续1个样本即可，降低要求
+	}
+	
+	/* 只在样本数足够多时才检查连续性，避免误判小雨滴 */
+	if (max_continuous_rise < min_continuous_required && total_rise_samples > 5)
+	{
+		/* 上升过程缺乏连续性，可能是噪声（但样本数要足够多才判定） */
+		return REJECT_RISE_CONTINUITY;
+	}
+	if (max_continuous_fall < min_continuous_required && total_fall_samples > 5)
+	{
+		/* 下降过程缺乏连续性，可能是噪声（但样本数要足够多才判定） */
+		return REJECT_FALL_CONTINUITY;
+	}
+	
+	/* 平滑度判定：真实信号应该有足够的平滑上升和下降 */
+	if (smooth_rise_ratio < MIN_SMOOTH_RISE_RATIO)
+	{
+		/* 上升过程不够平滑，可能是陡峭干扰 */
+		return REJECT_RISE_SMOOTHNESS;
+	}
+	
+	if (smooth_fall_ratio < MIN_SMOOTH_FALL_RATIO)
+	{
+		/* 下降过程不够平滑，可能是陡峭干扰 */
+		return REJECT_FALL_SMOOTHNESS;
+	}
+	
+	/* 3.7 峰值稳定性判定：真实信号峰值相对稳定，干扰峰值可能波动大 */
+	uint16_t peak_stable_count = 0;
+	uint16_t peak_check_start = (peak_index > PEAK_STABILITY_WINDOW) ? 
+		(peak_index - PEAK_STABILITY_WINDOW) : start_index;
+	uint16_t peak_check_end = (peak_index + PEAK_STABILITY_WINDOW < end_index) ? 
+		(peak_index + PEAK_STABILITY_WINDOW) : end_index;
+	
+	for (i = peak_check_start; i <= peak_check_end; i++)
+	{
+		uint16_t diff = (peak_value > buf[i]) ? (peak_value - buf[i]) : (buf[i] - peak_value);
+		/* 峰值附近样本应该接近峰值（在容差范围内） */
+		if (diff <= PEAK_STABILITY_DELTA)
+		{
+			peak_stable_count++;
+		}
+	}
+	
+	/* 峰值稳定性判定：峰值附近至少应该有部分样本接近峰值 */
+	uint16_t peak_check_samples = peak_check_end - peak_check_start + 1;
+	float peak_stability_ratio = (peak_check_samples > 0) ? 
+		((float)peak_stable_count / (float)peak_check_samples) : 0.0f;
+	
+	/* 根据信号幅度动态调整峰值稳定性要求：小雨滴信号可能峰值稳定性稍弱 */
+	float min_stability_ratio;
+	if (peak_value > 650)  // 大于650 ADC单位（约520mV），要求更严格
+	{
+		min_stability_ratio = 0.3f;  // 30%
+	}
+	else  // 小雨滴信号，要求放宽
+	{
+		min_stability_ratio = 0.2f;  // 20%，降低要求
+	}
+	
+	if (peak_stability_ratio < min_stability_ratio)
+	{
+		/* 峰值不够稳定，可能是孤立尖峰干扰 */
+		return REJECT_STABILITY;
+	}
+
+	/* 4) 通过所有判定：确认为真实雨滴信号 */
+	return REJECT_NONE;                  // 返回有效事件
+}
+
+static int32_t Compute_Baseline(const uint16_t *buf, uint16_t len)
+{
+	uint16_t base_count = (BASELINE_SAMPLE_COUNT < len) ? BASELINE_SAMPLE_COUNT : len;
+	if (base_count == 0)
+		return 0;
+	uint32_t base_sum = 0;
+	for (uint16_t i = 0; i < base_count; i++)
+	{
+		base_sum += buf[i];
+	}
+	return (int32_t)(base_sum / (uint32_t)base_count);
+}
+
+static void Find_Peak_In_Buffer(const uint16_t *buf, uint16_t len, int32_t baseline,
+                                uint16_t *peak_index, uint16_t *peak_value,
+                                uint16_t search_start, uint16_t search_end)
+{
+	if (len == 0)
+	{
+		*peak_index = 0;
+		*peak_value = 0;
+		return;
+	}
+
+	if (search_start >= len)
+		search_start = 0;
+	if (search_end >= len)
+		search_end = len - 1;
+	if (search_start > search_end)
+	{
+		uint16_t tmp = search_start;
+		search_start = 0;
+		search_end = tmp;
+		if (search_end >= len)
+			search_end = len - 1;
+	}
+
+	int32_t max_delta = INT32_MIN;
+	uint16_t rough_idx = 0;
+	for (uint16_t i = search_start; i <= search_end; i++)
+	{
+		int32_t acc = buf[i];
+		uint8_t denom = 1;
+		if (i > 0)
+		{
+			acc += buf[i - 1];
+			denom++;
+		}
+		if (i + 1 < len)
+		{
+			acc += buf[i + 1];
+			denom++;
+		}
+		int32_t smooth = acc / denom;
+		int32_t delta = smooth - baseline;
+		if (delta > max_delta)
+		{
+			max_delta = delta;
+			rough_idx = i;
+		}
+	}
+
+	uint16_t refine_start = (rough_idx > LOCAL_REFINEMENT_RADIUS) ? (rough_idx - LOCAL_REFINEMENT_RADIUS) : search_start;
+	if (refine_start < search_start) refine_start = search_start;
+	uint16_t refine_end = (rough_idx + LOCAL_REFINEMENT_RADIUS < len) ? (rough_idx + LOCAL_REFINEMENT_RADIUS) : (len - 1);
+	if (refine_end > search_end) refine_end = search_end;
+	uint16_t max_v = buf[rough_idx];
+	uint16_t max_i = rough_idx;
+	for (uint16_t i = refine_start; i <= refine_end; i++)
+	{
+		if (buf[i] > max_v)
+		{
+			max_v = buf[i];
+			max_i = i;
+		}
+	}
+
+	*peak_index = max_i;
+	*peak_value = max_v;
+}
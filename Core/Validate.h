@@ -0,0 +1,47 @@
+#ifndef __VALIDATE_H
+#define __VALIDATE_H
+
+#include <stdint.h>
+#include "Detector.h"
+
+/*
+ * 快照判定（主循环调用，与平台无关）
+ *   基线（快照前BASELINE_SAMPLE_COUNT点均值）→ 触发点附近找峰 → 前部分割（离开基线→峰值→回落）→
+ *   3点平滑后做幅值、形状、时间、平滑度、峰值稳定性判定，返回首个未通过的判定
+ *   不修改快照，平滑结果写入调用者提供的临时区
+ */
+/* 快照验证拒绝原因（Validate_Snapshot返回值，4位，同时写入事件日志） */
+#define REJECT_NONE             0        // 通过
+#define REJECT_RANGE            1        // 峰值/区间索引越界
+#define REJECT_THRESHOLD        2        // 峰值未超过动态阈值
+#define REJECT_MARGIN           3        // 峰值超出阈值的余量不足
+#define REJECT_AMPLITUDE        4        // 峰值低于MIN_PEAK_AMPLITUDE
+#define REJECT_SAMPLES          5        // 峰前/峰后样本数不足
+#define REJECT_NARROW           6        // 上升/下降计数不足且窄脉冲差值判定未通过
+#define REJECT_WIDTH            7        // 脉冲宽度不超过MAX_NOISE_PULSE_WIDTH（毛刺）
+#define REJECT_RISE_TIME        8        // 上升时间过短
+#define REJECT_FALL_TIME        9        // 下降时间过短
+#define REJECT_DURATION         10       // 总持续时间过短
+#define REJECT_RISE_CONTINUITY  11       // 上升缺乏连续性
+#define REJECT_FALL_CONTINUITY  12       // 下降缺乏连续性
+#define REJECT_RISE_SMOOTHNESS  13       // 上升平滑比例不足
+#define REJECT_FALL_SMOOTHNESS  14       // 下降平滑比例不足
+#define REJECT_STABILITY        15       // 峰值附近不稳定（孤立尖峰）
+#define REJECT_COUNT            16
+
+typedef struct
+{
+    int32_t baseline;                    // 快照基线（ADC单位）
+    uint16_t start_index;                // 前部起点
+    uint16_t end_index;                  // 前部终点
+    uint16_t peak_index;                 // 前部峰值索引
+    uint16_t peak_value;                 // 前部峰值（原始样本）
+    uint8_t reject;                      // REJECT_NONE或拒绝原因
+} SnapshotVerdict;
+
+uint8_t Validate_Snapshot(const uint16_t *buf, uint16_t len, uint16_t threshold,
+                          uint16_t *scratch, SnapshotVerdict *out);
+uint8_t Validate_And_Count_Event(const uint16_t *buf, uint16_t len, uint16_t peak_index, uint16_t peak_value,
+                                 uint16_t threshold, uint16_t start_index, uint16_t end_index, uint16_t *scratch);
+
+#endif
@@ -7,31 +7,17 @@
 // 数组大小为100，表示100个单通道数据点
 uint16_t AD_Value[100];
 
-/* 扩展：环形缓冲与快照（原双通道模式，当前仅使用通道0） */
-/* 双通道环形缓冲区：目前仅通道0实际参与处理，通道1保留以便后续扩展 */
-volatile uint16_t adc_ring_buffer_ch0[RING_BUFFER_SIZE];  // 通道0环形缓冲区
-volatile uint16_t adc_ring_buffer_ch1[RING_BUFFER_SIZE];  // 通道1环形缓冲区
-volatile uint16_t ring_write_index_ch0 = 0;  // 通道0写索引
-volatile uint16_t ring_write_index_ch1 = 0;  // 通道1写索引
+/* 环形缓冲、快照与采样计数在Core/Detector.c（DMA中断调用Detector_ProcessBlock） */
 
-/* Keil Array Visualization 可观察数组（500个元素） */
+#if ADC_VISUALIZE
+/* Keil Array Visualization 可观察数组（ADC_VISUALIZE_SIZE个元素） */
 /* 用于在Keil调试器中观察ADC采样数据，确保数组在文件作用域声明为全局变量 */
 /* 使用说明：在Keil调试器的Watch窗口中，添加 ADC_Visualize_Buffer 变量，
    然后右键选择 Array Visualization 即可查看波形 */
-volatile uint16_t ADC_Visualize_Buffer[500];  // ADC可视化缓冲区（通道0数据）
-volatile uint16_t ADC_Visualize_Index = 0;     // 可视化缓冲区写索引
+volatile uint16_t ADC_Visualize_Buffer[ADC_VISUALIZE_SIZE];  // ADC可视化缓冲区（通道0数据）
+#endif
 
 
-volatile uint8_t snapshot_ready = 0;
-volatile uint16_t snapshot_buffer_high[SNAPSHOT_SIZE];
-volatile uint16_t snapshot_buffer_low[SNAPSHOT_SIZE];
-volatile uint16_t snapshot_write_index = 0;
-volatile uint8_t snapshot_collecting = 0; /* 0-未采集，1-正在采集 */
-volatile uint16_t snapshot_peak_value = 0;
-volatile uint16_t snapshot_peak_index = 0;
-
-volatile uint32_t sampling_tick_counter = 0; /* 由HT/TC中断推进，用于异常检测 */
-
 volatile uint16_t ADC_Threshold = 620;  // 500mV
 
 static void AD_ConfigAWD(uint16_t threshold);
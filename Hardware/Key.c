@@ -1,15 +1,31 @@
 #include "stm32f10x.h"                  // Device header
-#include "Delay.h"
+#include "Key.h"
+
+#define KEY_COUNT		2
+#define KEY_LONG_SCANS	(KEY_LONG_MS / KEY_SCAN_MS)
+
+static const uint16_t key_pins[KEY_COUNT] = { GPIO_Pin_1, GPIO_Pin_11 };
+
+static uint8_t key_integrator[KEY_COUNT];		//消抖积分值，0~KEY_DEBOUNCE_SCANS
+static uint8_t key_pressed[KEY_COUNT];			//消抖后的状态
+static uint16_t key_hold[KEY_COUNT];			//按住的采样数
+static uint8_t key_long_sent[KEY_COUNT];		//本次按下已产生长按事件
+
+static volatile uint8_t key_fifo[KEY_FIFO_SIZE];
+static volatile uint8_t key_fifo_head = 0;		//TIM2中断写入
+static volatile uint8_t key_fifo_tail = 0;		//主循环读出
 
 /**
   * 函    数：按键初始化
   * 参    数：无
   * 返 回 值：无
+  * 注意事项：同时启动TIM2按KEY_SCAN_MS周期采样，中断优先级最低
   */
 void Key_Init(void)
 {
 	/*开启时钟*/
 	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOB, ENABLE);		//开启GPIOB的时钟
+	RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2, ENABLE);		//开启TIM2的时钟
 	
 	/*GPIO初始化*/
 	GPIO_InitTypeDef GPIO_InitStructure;
@@ -17,33 +33,108 @@ void Key_Init(void)
 	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_1 | GPIO_Pin_11;
 	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
 	GPIO_Init(GPIOB, &GPIO_InitStructure);						//将PB1和PB11引脚初始化为上拉输入
+	
+	/*TIM2时基：72MHz/7200 = 10kHz计数，KEY_SCAN_MS*10个计数溢出一次*/
+	TIM_TimeBaseInitTypeDef TIM_TimeBaseInitStructure;
+	TIM_TimeBaseInitStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+	TIM_TimeBaseInitStructure.TIM_CounterMode = TIM_CounterMode_Up;
+	TIM_TimeBaseInitStructure.TIM_Period = KEY_SCAN_MS * 10 - 1;
+	TIM_TimeBaseInitStructure.TIM_Prescaler = 7200 - 1;
+	TIM_TimeBaseInitStructure.TIM_RepetitionCounter = 0;
+	TIM_TimeBaseInit(TIM2, &TIM_TimeBaseInitStructure);
+	TIM_ClearFlag(TIM2, TIM_FLAG_Update);
+	TIM_ITConfig(TIM2, TIM_IT_Update, ENABLE);
+	
+	/*NVIC：优先级最低，采样只是读两个引脚*/
+	NVIC_InitTypeDef NVIC_InitStructure;
+	NVIC_InitStructure.NVIC_IRQChannel = TIM2_IRQn;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 3;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 3;
+	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_Init(&NVIC_InitStructure);
+	
+	TIM_Cmd(TIM2, ENABLE);
+}
+
+/**
+  * 函    数：写入一个按键事件
+  * 参    数：Event 键码（长按时或上KEY_EVENT_LONG）
+  * 返 回 值：无
+  * 注意事项：FIFO满时丢弃
+  */
+static void Key_Push(uint8_t Event)
+{
+	uint8_t next = (key_fifo_head + 1) & (KEY_FIFO_SIZE - 1);
+	if (next != key_fifo_tail)
+	{
+		key_fifo[key_fifo_head] = Event;
+		key_fifo_head = next;
+	}
 }
 
 /**
-  * 函    数：按键获取键码
+  * 函    数：按键采样（在TIM2_IRQHandler中调用）
   * 参    数：无
-  * 返 回 值：按下按键的键码值，范围：0~2，返回0代表没有按键按下
-  * 注意事项：此函数是阻塞式操作，当按键按住不放时，函数会卡住，直到按键松手
+  * 返 回 值：无
   */
-uint8_t Key_GetNum(void)
+void Key_Scan_IRQ(void)
 {
-	uint8_t KeyNum = 0;		//定义变量，默认键码值为0
+	uint8_t i;
 	
-	if (GPIO_ReadInputDataBit(GPIOB, GPIO_Pin_1) == 0)			//读PB1输入寄存器的状态，如果为0，则代表按键1按下
+	if (TIM_GetITStatus(TIM2, TIM_IT_Update) == RESET)
 	{
-		Delay_ms(20);											//延时消抖
-		while (GPIO_ReadInputDataBit(GPIOB, GPIO_Pin_1) == 0);	//等待按键松手
-		Delay_ms(20);											//延时消抖
-		KeyNum = 1;												//置键码为1
+		return;
 	}
+	TIM_ClearITPendingBit(TIM2, TIM_IT_Update);
 	
-	if (GPIO_ReadInputDataBit(GPIOB, GPIO_Pin_11) == 0)			//读PB11输入寄存器的状态，如果为0，则代表按键2按下
+	for (i = 0; i < KEY_COUNT; i++)
 	{
-		Delay_ms(20);											//延时消抖
-		while (GPIO_ReadInputDataBit(GPIOB, GPIO_Pin_11) == 0);	//等待按键松手
-		Delay_ms(20);											//延时消抖
-		KeyNum = 2;												//置键码为2
+		/*积分消抖：原始电平连续KEY_DEBOUNCE_SCANS次一致才改变状态*/
+		if (GPIO_ReadInputDataBit(GPIOB, key_pins[i]) == 0)
+		{
+			if (key_integrator[i] < KEY_DEBOUNCE_SCANS)
+				key_integrator[i]++;
+		}
+		else if (key_integrator[i] > 0)
+		{
+			key_integrator[i]--;
+		}
+		
+		if (!key_pressed[i] && key_integrator[i] == KEY_DEBOUNCE_SCANS)
+		{
+			key_pressed[i] = 1;
+			key_hold[i] = 0;
+			key_long_sent[i] = 0;
+		}
+		else if (key_pressed[i] && key_integrator[i] == 0)
+		{
+			key_pressed[i] = 0;
+			if (!key_long_sent[i])
+				Key_Push((uint8_t)(KEY_1 + i));				//松开：短按
+		}
+		else if (key_pressed[i] && !key_long_sent[i] && ++key_hold[i] >= KEY_LONG_SCANS)
+		{
+			key_long_sent[i] = 1;
+			Key_Push((uint8_t)((KEY_1 + i) | KEY_EVENT_LONG));	//按住满KEY_LONG_MS：长按
+		}
 	}
+}
+
+/**
+  * 函    数：获取按键事件
+  * 参    数：无
+  * 返 回 值：KEY_NONE表示没有事件，否则为键码（长按时或上KEY_EVENT_LONG）
+  * 注意事项：不阻塞，主循环每次调用一次即可
+  */
+uint8_t Key_GetEvent(void)
+{
+	uint8_t Event;
 	
-	return KeyNum;			//返回键码值，如果没有按键按下，所有if都不成立，则键码为默认值0
+	if (key_fifo_tail == key_fifo_head)
+	{
+		return KEY_NONE;
+	}
+	Event = key_fifo[key_fifo_tail];
+	key_fifo_tail = (key_fifo_tail + 1) & (KEY_FIFO_SIZE - 1);
+	return Event;
 }
@@ -1,7 +1,25 @@
 #ifndef __KEY_H
 #define __KEY_H
 
+#include <stdint.h>
+
+/*
+ * 按键（PB1=按键1，PB11=按键2，按下为低电平）
+ *   TIM2每KEY_SCAN_MS毫秒中断采样一次，积分消抖，按键事件写入FIFO，Key_GetEvent不阻塞
+ *   短按：松开时产生键码；长按：按住满KEY_LONG_MS时产生一次键码|KEY_EVENT_LONG，松开不再产生短按
+ */
+#define KEY_SCAN_MS             5        // 采样周期
+#define KEY_DEBOUNCE_SCANS      4        // 连续一致的采样数（20ms）
+#define KEY_LONG_MS             800      // 长按判定时间
+#define KEY_FIFO_SIZE           8        // 事件FIFO（2的幂）
+
+#define KEY_NONE                0
+#define KEY_1                   1
+#define KEY_2                   2
+#define KEY_EVENT_LONG          0x80     // 长按标志
+
 void Key_Init(void);
-uint8_t Key_GetNum(void);
+uint8_t Key_GetEvent(void);
+void Key_Scan_IRQ(void);
 
 #endif
@@ -1,6 +1,8 @@
 #include "stm32f10x.h"
+#include "OLED.h"
 #include "OLED_Font.h"
 #include "Delay.h"
+#include "Cycle.h"
 
 /* 引脚配置 - 根据你的接线修改 */
 #define OLED_SCL_PIN GPIO_Pin_8
@@ -10,6 +12,32 @@
 #define OLED_SCL(x)  GPIO_WriteBit(OLED_PORT, OLED_SCL_PIN, (BitAction)(x))
 #define OLED_SDA(x)  GPIO_WriteBit(OLED_PORT, OLED_SDA_PIN, (BitAction)(x))
 
+#define OLED_ADDR    0x78                // 从机地址（写）
+#define OLED_CTRL_CMD   0x00             // 控制字节：后续均为命令
+#define OLED_CTRL_CMD_ONE 0x80           // 控制字节（Co=1）：后面1个命令，之后还有控制字节
+#define OLED_CTRL_DATA  0x40             // 控制字节：后续均为显示数据
+
+#if OLED_BUS_NONE
+#define OLED_CYCLES()   0u               // QEMU没有DWT，刷新耗时由基准程序测量
+#else
+#define OLED_CYCLES()   Cycle_Now()
+#endif
+
+/* 帧缓冲：与SSD1306显存同构（8页×128列，每字节为一列的8个像素），保存面板上应显示的内容 */
+static uint8_t oled_fb[OLED_PAGES][OLED_WIDTH];
+/* 脏块位图：第p页第t块（8列）内容与面板不一致时oled_dirty[p]的第t位置1 */
+static volatile uint16_t oled_dirty[OLED_PAGES];
+/* 发送缓冲：一段 = 7字节控制/地址命令 + 最多一整页数据；硬件后端传输期间帧缓冲可继续改写 */
+static uint8_t oled_tx[7 + OLED_WIDTH];
+static uint8_t flush_page = 0;           // 刷新扫描到的页
+
+uint8_t oled_backend = OLED_BACKEND_SOFT;
+uint32_t oled_i2c_errors = 0;
+
+uint32_t oled_flush_cycles_last = 0;
+uint32_t oled_flush_cycles_max = 0;
+uint32_t oled_flush_bytes_last = 0;
+
 /**
   * @brief  次方计算
   * @param  X 底数
@@ -106,63 +134,496 @@ void OLED_I2C_SendByte(uint8_t Byte)
     OLED_SCL(0);
 }
 
+/* ---------------- 软件I2C后端 ---------------- */
+
+/**
+  * @brief  软件I2C发送一次传输（起始 + 从机地址 + N字节 + 停止）
+  * @param  Data 数据（首字节为控制字节）
+  * @param  Count 字节数
+  * @retval 无
+  */
+static void OLED_Soft_Write(const uint8_t *Data, uint8_t Count)
+{
+    OLED_I2C_Start();
+    OLED_I2C_SendByte(OLED_ADDR);
+    while (Count--)
+    {
+        OLED_I2C_SendByte(*Data++);
+    }
+    OLED_I2C_Stop();
+}
+
+/* ---------------- 帧缓冲 ---------------- */
+
+/* 全部标记为脏（面板内容未知：清屏、传输出错、切换后端后） */
+static void OLED_MarkAllDirty(void)
+{
+    uint8_t j;
+
+    for (j = 0; j < OLED_PAGES; j++)
+    {
+        oled_dirty[j] = 0xFFFF;
+    }
+}
+
+/**
+  * @brief  取出下一段脏块，组成一次传输写入oled_tx
+  * @retval 传输长度（字节，不含从机地址），0表示已无脏块
+  * @note   一段 = 本页相邻的脏块；先清脏位再拷贝数据，拷贝之后被改写的块会重新置脏，
+  *         因此可在中断中接续调用，与主循环并发写帧缓冲
+  *         格式：3个Co=1命令（页地址、列地址高/低4位）+ 0x40 + 数据，一次传输完成
+  */
+static uint8_t OLED_NextRun(void)
+{
+    while (flush_page < OLED_PAGES)
+    {
+        uint16_t dirty = oled_dirty[flush_page];
+        uint8_t tile = 0, run = 0, i, len;
+        uint8_t *p = oled_tx;
+        const uint8_t *src;
+
+        if (dirty == 0)
+        {
+            flush_page++;
+            continue;
+        }
+        while (!(dirty & (1u << tile)))
+        {
+            tile++;
+        }
+        while (tile + run < OLED_TILES && (dirty & (1u << (tile + run))))
+        {
+            run++;
+        }
+        oled_dirty[flush_page] &= (uint16_t)~(((1u << run) - 1u) << tile);
+
+        *p++ = OLED_CTRL_CMD_ONE;
+        *p++ = (uint8_t)(0xB0 + flush_page);                        // 页地址
+        *p++ = OLED_CTRL_CMD_ONE;
+        *p++ = (uint8_t)(0x10 + ((tile * OLED_TILE_WIDTH) >> 4));   // 列地址高4位
+        *p++ = OLED_CTRL_CMD_ONE;
+        *p++ = (uint8_t)((tile * OLED_TILE_WIDTH) & 0x0F);          // 列地址低4位
+        *p++ = OLED_CTRL_DATA;
+        src = &oled_fb[flush_page][tile * OLED_TILE_WIDTH];
+        len = (uint8_t)(run * OLED_TILE_WIDTH);
+        for (i = 0; i < len; i++)
+        {
+            *p++ = src[i];
+        }
+        len = (uint8_t)(p - oled_tx);
+        oled_flush_bytes_last += 1u + len;
+        return len;
+    }
+    return 0;
+}
+
+/* ---------------- 硬件I2C1 + DMA后端 ---------------- */
+#if OLED_HW_I2C
+
+#define HW_STATE_IDLE   0
+#define HW_STATE_START  1                // 已发起始条件，等待SB
+#define HW_STATE_ADDR   2                // 已发地址，等待ADDR
+#define HW_STATE_DATA   3                // DMA发送中
+#define HW_STATE_LAST   4                // DMA已送完，等待BTF后发停止条件
+
+static volatile uint8_t hw_state = HW_STATE_IDLE;
+static volatile uint8_t hw_errors_in_row = 0;
+static volatile uint32_t hw_start_cycles = 0;
+
+/* I2C1外设配置：400kHz快速模式（APB1=36MHz） */
+static void OLED_Hw_Configure(void)
+{
+    I2C_InitTypeDef i2c;
+
+    I2C_DeInit(I2C1);
+    i2c.I2C_Mode = I2C_Mode_I2C;
+    i2c.I2C_DutyCycle = I2C_DutyCycle_2;
+    i2c.I2C_OwnAddress1 = 0x00;
+    i2c.I2C_Ack = I2C_Ack_Enable;
+    i2c.I2C_AcknowledgedAddress = I2C_AcknowledgedAddress_7bit;
+    i2c.I2C_ClockSpeed = OLED_I2C_SPEED;
+    I2C_Init(I2C1, &i2c);
+    I2C_DMACmd(I2C1, ENABLE);
+    I2C_Cmd(I2C1, ENABLE);
+}
+
+/**
+  * @brief  硬件I2C1初始化（PB8=SCL、PB9=SDA重映射，DMA1通道6发送）
+  * @retval 1：成功，0：总线忙（上拉缺失或从机拉住SDA），应使用软件I2C
+  */
+static uint8_t OLED_Hw_Init(void)
+{
+    GPIO_InitTypeDef gpio;
+    DMA_InitTypeDef dma;
+    NVIC_InitTypeDef nvic;
+
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOB | RCC_APB2Periph_AFIO, ENABLE);
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_I2C1, ENABLE);
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+
+    GPIO_PinRemapConfig(GPIO_Remap_I2C1, ENABLE);
+    gpio.GPIO_Pin = OLED_SCL_PIN | OLED_SDA_PIN;
+    gpio.GPIO_Speed = GPIO_Speed_50MHz;
+    gpio.GPIO_Mode = GPIO_Mode_AF_OD;
+    GPIO_Init(OLED_PORT, &gpio);
+
+    OLED_Hw_Configure();
+    if (I2C_GetFlagStatus(I2C1, I2C_FLAG_BUSY) == SET)
+    {
+        /* 切换复用功能时模拟滤波器可能误锁BUSY：软件复位一次再检查 */
+        I2C_SoftwareResetCmd(I2C1, ENABLE);
+        I2C_SoftwareResetCmd(I2C1, DISABLE);
+        OLED_Hw_Configure();
+        if (I2C_GetFlagStatus(I2C1, I2C_FLAG_BUSY) == SET)
+            return 0;
+    }
+
+    /* DMA1通道6 = I2C1_TX：内存->外设，单次模式，每段由OLED_Hw_Start装载 */
+    DMA_DeInit(DMA1_Channel6);
+    dma.DMA_PeripheralBaseAddr = (uint32_t)&I2C1->DR;
+    dma.DMA_MemoryBaseAddr = (uint32_t)oled_tx;
+    dma.DMA_DIR = DMA_DIR_PeripheralDST;
+    dma.DMA_BufferSize = 1;
+    dma.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    dma.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    dma.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+    dma.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+    dma.DMA_Mode = DMA_Mode_Normal;
+    dma.DMA_Priority = DMA_Priority_Low;      // 低于ADC采样与串口发送
+    dma.DMA_M2M = DMA_M2M_Disable;
+    DMA_Init(DMA1_Channel6, &dma);
+    DMA_ITConfig(DMA1_Channel6, DMA_IT_TC, ENABLE);
+
+    /* 显示传输优先级最低，不影响采样与命令接收 */
+    nvic.NVIC_IRQChannelPreemptionPriority = 3;
+    nvic.NVIC_IRQChannelSubPriority = 2;
+    nvic.NVIC_IRQChannelCmd = ENABLE;
+    nvic.NVIC_IRQChannel = DMA1_Channel6_IRQn;
+    NVIC_Init(&nvic);
+    nvic.NVIC_IRQChannel = I2C1_EV_IRQn;
+    NVIC_Init(&nvic);
+    nvic.NVIC_IRQChannel = I2C1_ER_IRQn;
+    NVIC_Init(&nvic);
+    return 1;
+}
+
+/**
+  * @brief  发起一次传输（oled_tx前len字节），后续由中断推进
+  */
+static void OLED_Hw_Start(uint8_t len)
+{
+    DMA1_Channel6->CCR &= ~DMA_CCR6_EN;
+    DMA1_Channel6->CMAR = (uint32_t)oled_tx;
+    DMA1_Channel6->CNDTR = len;
+    DMA1_Channel6->CCR |= DMA_CCR6_EN;
+
+    hw_start_cycles = Cycle_Now();
+    hw_state = HW_STATE_START;
+    I2C1->CR2 |= I2C_CR2_ITEVTEN | I2C_CR2_ITERREN;
+    I2C1->CR1 |= I2C_CR1_START;
+}
+
+/* 终止当前传输：发停止条件，整屏置脏以便重发 */
+static void OLED_Hw_Abort(void)
+{
+    DMA1_Channel6->CCR &= ~DMA_CCR6_EN;
+    I2C1->CR2 &= (uint16_t)~(I2C_CR2_ITEVTEN | I2C_CR2_ITERREN);
+    I2C1->CR1 |= I2C_CR1_STOP;
+    oled_i2c_errors++;
+    if (hw_errors_in_row < 0xFF)
+        hw_errors_in_row++;
+    OLED_MarkAllDirty();
+    hw_state = HW_STATE_IDLE;
+}
+
+/* 一段传输结束：接续下一段脏块，没有则空闲 */
+static void OLED_Hw_Next(void)
+{
+    uint8_t len;
+    uint16_t wait = 0;
+
+    hw_errors_in_row = 0;
+    len = OLED_NextRun();
+    if (len == 0)
+    {
+        hw_state = HW_STATE_IDLE;
+        return;
+    }
+    /* 停止条件约2.5us@400kHz，发出后才能产生下一个起始条件 */
+    while ((I2C1->CR1 & I2C_CR1_STOP) && ++wait < 1000)
+    {
+    }
+    OLED_Hw_Start(len);
+}
+
+/**
+  * @brief  I2C1事件中断（由I2C1_EV_IRQHandler调用）
+  */
+void OLED_I2C_EV_IRQ(void)
+{
+    uint16_t sr1 = I2C1->SR1;
+
+    if (sr1 & I2C_SR1_SB)
+    {
+        I2C1->DR = OLED_ADDR;                 // 读SR1后写DR清SB
+        hw_state = HW_STATE_ADDR;
+    }
+    else if (sr1 & I2C_SR1_ADDR)
+    {
+        (void)I2C1->SR2;                      // 读SR1后读SR2清ADDR，DMA开始送数据
+        I2C1->CR2 &= (uint16_t)~I2C_CR2_ITEVTEN;
+        hw_state = HW_STATE_DATA;
+    }
+    else if ((sr1 & I2C_SR1_BTF) && hw_state == HW_STATE_LAST)
+    {
+        I2C1->CR1 |= I2C_CR1_STOP;
+        I2C1->CR2 &= (uint16_t)~I2C_CR2_ITEVTEN;
+        OLED_Hw_Next();
+    }
+}
+
+/**
+  * @brief  I2C1错误中断（无应答、总线错误、仲裁丢失）
+  */
+void OLED_I2C_ER_IRQ(void)
+{
+    I2C1->SR1 &= (uint16_t)~(I2C_SR1_AF | I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_OVR);
+    OLED_Hw_Abort();
+}
+
+/**
+  * @brief  DMA1通道6传输完成：数据已全部写入DR，等待最后一字节移出（BTF）
+  */
+void OLED_DMA_IRQ(void)
+{
+    DMA1->IFCR = DMA1_IT_TC6;
+    DMA1_Channel6->CCR &= ~DMA_CCR6_EN;
+    hw_state = HW_STATE_LAST;
+    I2C1->CR2 |= I2C_CR2_ITEVTEN;
+}
+
+/**
+  * @brief  同步发送一次传输（初始化命令用）
+  * @retval 1：成功，0：出错或超时
+  */
+static uint8_t OLED_Hw_WriteBlocking(uint8_t len)
+{
+    flush_page = OLED_PAGES;                  // 不接续帧缓冲
+    OLED_Hw_Start(len);
+    while (hw_state != HW_STATE_IDLE)
+    {
+        if (Cycle_Now() - hw_start_cycles > OLED_HW_TIMEOUT_US * CYCLES_PER_US)
+        {
+            __disable_irq();
+            OLED_Hw_Abort();
+            __enable_irq();
+            return 0;
+        }
+    }
+    return hw_errors_in_row == 0;
+}
+
+/**
+  * @brief  退回软件I2C：关闭I2C1，PB8/PB9恢复为开漏GPIO，整屏重发
+  */
+static void OLED_Hw_Fallback(void)
+{
+    NVIC_DisableIRQ(I2C1_EV_IRQn);
+    NVIC_DisableIRQ(I2C1_ER_IRQn);
+    NVIC_DisableIRQ(DMA1_Channel6_IRQn);
+    DMA1_Channel6->CCR &= ~DMA_CCR6_EN;
+    I2C_Cmd(I2C1, DISABLE);
+    GPIO_PinRemapConfig(GPIO_Remap_I2C1, DISABLE);
+    OLED_I2C_Init();
+    oled_backend = OLED_BACKEND_SOFT;
+    hw_state = HW_STATE_IDLE;
+    OLED_MarkAllDirty();
+}
+
+#endif /* OLED_HW_I2C */
+
 /**
   * @brief  OLED写命令
   * @param  Command 命令
   * @retval 无
+  * @note   同步发送，只用于初始化
   */
 void OLED_WriteCommand(uint8_t Command)
 {
-    OLED_I2C_Start();
-    OLED_I2C_SendByte(0x78);  // 从机地址
-    OLED_I2C_SendByte(0x00);  // 写命令
-    OLED_I2C_SendByte(Command);
-    OLED_I2C_Stop();
+    oled_tx[0] = OLED_CTRL_CMD;
+    oled_tx[1] = Command;
+#if OLED_HW_I2C
+    if (oled_backend == OLED_BACKEND_HW)
+    {
+        if (OLED_Hw_WriteBlocking(2))
+            return;
+        OLED_Hw_Fallback();                   // 无应答：改用软件I2C重发
+        oled_tx[0] = OLED_CTRL_CMD;
+        oled_tx[1] = Command;
+    }
+#endif
+    OLED_Soft_Write(oled_tx, 2);
 }
 
 /**
-  * @brief  OLED写数据
+  * @brief  写帧缓冲一个字节（一列8像素），内容变化时标记所在块为脏
+  * @param  Page 页 (0-7)
+  * @param  X 列 (0-127)
   * @param  Data 数据
   * @retval 无
   */
-void OLED_WriteData(uint8_t Data)
+void OLED_PutByte(uint8_t Page, uint8_t X, uint8_t Data)
 {
-    OLED_I2C_Start();
-    OLED_I2C_SendByte(0x78);  // 从机地址
-    OLED_I2C_SendByte(0x40);  // 写数据
-    OLED_I2C_SendByte(Data);
-    OLED_I2C_Stop();
+    if (oled_fb[Page][X] != Data)
+    {
+        oled_fb[Page][X] = Data;
+        oled_dirty[Page] |= (uint16_t)(1u << (X >> 3));   // 先写数据后置脏，与中断中的拷贝无竞争
+    }
 }
 
 /**
-  * @brief  设置光标位置
-  * @param  Y 行位置 (0-7)
-  * @param  X 列位置 (0-127)
+  * @brief  OLED正在异步刷新
+  * @retval 1：硬件传输进行中
+  */
+uint8_t OLED_Busy(void)
+{
+#if OLED_HW_I2C
+    return hw_state != HW_STATE_IDLE;
+#else
+    return 0;
+#endif
+}
+
+/**
+  * @brief  把帧缓冲中的脏块刷新到面板
+  * @param  无
   * @retval 无
+  * @note   每页内相邻的脏块合并为一段，每段一次传输；未变化的块不发送
+  *         硬件后端：启动第一段后立即返回，其余段在中断中接续；上一轮未完成时本次跳过，
+  *         剩余脏块留到下次；单段超时或连续出错达到OLED_HW_MAX_ERRORS时退回软件I2C
+  *         软件后端：在本函数内逐段同步发送
+  *         oled_flush_cycles_*统计本函数占用主循环的时间
   */
-void OLED_SetCursor(uint8_t Y, uint8_t X)
+void OLED_Flush(void)
 {
-    OLED_WriteCommand(0xB0 + Y);              // 设置页地址
-    OLED_WriteCommand(0x10 + (X >> 4));       // 设置列地址高4位
-    OLED_WriteCommand(0x00 + (X & 0x0F));     // 设置列地址低4位
+    uint32_t start_cycles = OLED_CYCLES();
+    uint32_t cycles;
+    uint8_t len;
+
+#if OLED_HW_I2C
+    if (oled_backend == OLED_BACKEND_HW)
+    {
+        if (hw_state != HW_STATE_IDLE)
+        {
+            if (Cycle_Now() - hw_start_cycles <= OLED_HW_TIMEOUT_US * CYCLES_PER_US)
+                return;
+            __disable_irq();
+            if (hw_state != HW_STATE_IDLE)
+                OLED_Hw_Abort();              // 超时：总线被拉住
+            __enable_irq();
+        }
+        if (hw_errors_in_row >= OLED_HW_MAX_ERRORS)
+        {
+            OLED_Hw_Fallback();
+        }
+        else
+        {
+            flush_page = 0;
+            oled_flush_bytes_last = 0;
+            len = OLED_NextRun();
+            if (len > 0)
+                OLED_Hw_Start(len);
+            cycles = Cycle_Now() - start_cycles;
+            oled_flush_cycles_last = cycles;
+            if (cycles > oled_flush_cycles_max)
+                oled_flush_cycles_max = cycles;
+            return;
+        }
+    }
+#endif
+
+    flush_page = 0;
+    oled_flush_bytes_last = 0;
+    while ((len = OLED_NextRun()) > 0)
+    {
+#if !OLED_BUS_NONE
+        OLED_Soft_Write(oled_tx, len);
+#endif
+    }
+
+    cycles = OLED_CYCLES() - start_cycles;
+    oled_flush_cycles_last = cycles;
+    if (cycles > oled_flush_cycles_max)
+        oled_flush_cycles_max = cycles;
 }
 
 /**
   * @brief  OLED清屏
   * @param  无
   * @retval 无
+  * @note   清空帧缓冲并标记全部为脏（面板内容未知），下次OLED_Flush时整屏写入
   */
 void OLED_Clear(void)
 {
     uint8_t i, j;
-    for (j = 0; j < 8; j++)
+    for (j = 0; j < OLED_PAGES; j++)
     {
-        OLED_SetCursor(j, 0);
-        for (i = 0; i < 128; i++)
+        for (i = 0; i < OLED_WIDTH; i++)
         {
-            OLED_WriteData(0x00);
+            oled_fb[j][i] = 0x00;
         }
     }
+    OLED_MarkAllDirty();
+}
+
+/**
+  * @brief  清空帧缓冲（逐字节比较，只有原来非空的块被置脏）
+  * @param  无
+  * @retval 无
+  * @note   切换界面用；与OLED_Clear不同，不强制整屏重发
+  */
+void OLED_ClearBuffer(void)
+{
+    uint8_t i, j;
+    for (j = 0; j < OLED_PAGES; j++)
+    {
+        for (i = 0; i < OLED_WIDTH; i++)
+        {
+            OLED_PutByte(j, i, 0x00);
+        }
+    }
+}
+
+/**
+  * @brief  画一列自底向上的竖条
+  * @param  X 列 (0-127)
+  * @param  Page 顶部页 (0-7)
+  * @param  Pages 占用页数（高度Pages*8像素）
+  * @param  Height 竖条高度（像素，超出按满高）
+  * @retval 无
+  * @note   整列重写（竖条以上清零），未变化的字节不置脏
+  */
+void OLED_DrawBar(uint8_t X, uint8_t Page, uint8_t Pages, uint8_t Height)
+{
+    uint8_t k;
+    uint16_t top;
+
+    if (Height > Pages * 8u)
+        Height = (uint8_t)(Pages * 8u);
+    top = (uint16_t)(Pages * 8u - Height);            // 竖条最上面一行（自区域顶部起）
+    for (k = 0; k < Pages; k++)
+    {
+        uint16_t row0 = (uint16_t)(k * 8u);
+        uint8_t data;
+
+        if (top <= row0)
+            data = 0xFF;
+        else if (top >= row0 + 8u)
+            data = 0x00;
+        else
+            data = (uint8_t)(0xFFu << (top - row0));  // 低位在上
+        OLED_PutByte((uint8_t)(Page + k), X, data);
+    }
 }
 
 /**
@@ -171,6 +632,7 @@ void OLED_Clear(void)
   * @param  Column 列位置 (1-16)
   * @param  Char 要显示的字符
   * @retval 无
+  * @note   只写帧缓冲，由OLED_Flush发送到面板
   */
 void OLED_ShowChar(uint8_t Line, uint8_t Column, char Char)
 {
@@ -178,18 +640,10 @@ void OLED_ShowChar(uint8_t Line, uint8_t Column, char Char)
     uint8_t page = (Line - 1) * 2;
     uint8_t col = (Column - 1) * 8;
     
-    // 显示上半部分
-    OLED_SetCursor(page, col);
-    for (i = 0; i < 8; i++)
-    {
-        OLED_WriteData(OLED_F8x16[Char - ' '][i]);
-    }
-    
-    // 显示下半部分
-    OLED_SetCursor(page + 1, col);
     for (i = 0; i < 8; i++)
     {
-        OLED_WriteData(OLED_F8x16[Char - ' '][i + 8]);
+        OLED_PutByte(page, col + i, OLED_F8x16[Char - ' '][i]);          // 上半部分
+        OLED_PutByte(page + 1, col + i, OLED_F8x16[Char - ' '][i + 8]);  // 下半部分
     }
 }
 
@@ -288,11 +742,21 @@ void OLED_ShowHexNum(uint8_t Line, uint8_t Column, uint32_t Number, uint8_t Leng
   */
 void OLED_Init(void)
 {
-    // 初始化I2C
+    // 初始化I2C（软件I2C空闲电平；硬件I2C1可用时切换为复用开漏）
     OLED_I2C_Init();
     
     // 延时等待OLED上电稳定
     Delay_ms(100);
+#if OLED_HW_I2C
+    if (OLED_Hw_Init())
+    {
+        oled_backend = OLED_BACKEND_HW;
+    }
+    else
+    {
+        OLED_Hw_Fallback();
+    }
+#endif
     
     // SSD1306初始化序列
     OLED_WriteCommand(0xAE); // 关闭显示
@@ -339,4 +803,5 @@ void OLED_Init(void)
     
     // 清屏
     OLED_Clear();
+    OLED_Flush();
 }
@@ -3,8 +3,51 @@
 
 #include "stm32f10x.h"
 
+/*
+ * SSD1306 128×64 OLED（I2C）
+ *   所有OLED_Show*只写RAM帧缓冲并标记变化的8列块，OLED_Flush把脏块按段连续写入面板
+ *   后端：OLED_HW_I2C=1时用硬件I2C1（PB8/PB9重映射，400kHz）+ DMA1通道6，OLED_Flush只启动
+ *   第一段即返回，其余段在中断中接续；总线忙、无应答或超时则退回软件I2C（同步发送）
+ *   OLED_BUS_NONE=1时不接面板（QEMU基准测试）：OLED_Flush只整理脏块，不发送也不读DWT
+ */
+#ifndef OLED_BUS_NONE
+#define OLED_BUS_NONE   0
+#endif
+#if OLED_BUS_NONE
+#undef OLED_HW_I2C
+#define OLED_HW_I2C     0
+#endif
+#ifndef OLED_HW_I2C
+#define OLED_HW_I2C     1
+#endif
+#define OLED_I2C_SPEED      400000
+#define OLED_HW_TIMEOUT_US  20000        // 单段传输超时（整页135字节@400kHz约3.4ms）
+#define OLED_HW_MAX_ERRORS  3            // 连续出错次数，达到后退回软件I2C
+
+#define OLED_BACKEND_SOFT   0
+#define OLED_BACKEND_HW     1
+
+#define OLED_WIDTH      128
+#define OLED_PAGES      8                // 每页8像素行
+#define OLED_TILE_WIDTH 8                // 脏块宽度（列）
+#define OLED_TILES      (OLED_WIDTH / OLED_TILE_WIDTH)
+
+extern uint32_t oled_flush_cycles_last;  // 最近一次刷新耗时（DWT周期）
+extern uint32_t oled_flush_cycles_max;   // 最大刷新耗时
+extern uint32_t oled_flush_bytes_last;   // 最近一次刷新的I2C字节数（含地址/控制字节）
+extern uint8_t oled_backend;             // 当前后端（OLED_BACKEND_xxx）
+extern uint32_t oled_i2c_errors;         // 硬件I2C出错/超时次数
+
 void OLED_Init(void);
 void OLED_Clear(void);
+void OLED_Flush(void);
+void OLED_PutByte(uint8_t Page, uint8_t X, uint8_t Data);
+void OLED_ClearBuffer(void);
+void OLED_DrawBar(uint8_t X, uint8_t Page, uint8_t Pages, uint8_t Height);
+uint8_t OLED_Busy(void);
+void OLED_I2C_EV_IRQ(void);
+void OLED_I2C_ER_IRQ(void);
+void OLED_DMA_IRQ(void);
 void OLED_ShowChar(uint8_t Line, uint8_t Column, char Char);
 void OLED_ShowString(uint8_t Line, uint8_t Column, char *String);
 void OLED_ShowNum(uint8_t Line, uint8_t Column, uint32_t Number, uint8_t Length);
@@ -0,0 +1,404 @@
+#include "stm32f10x.h"
+#include "Serial.h"
+
+/* 无发送时的优先级标记 */
+#define SERIAL_PRIO_NONE        0xFF
+
+typedef struct
+{
+    uint8_t *buf;
+    uint16_t mask;                       // 大小-1（大小为2的幂）
+    volatile uint16_t head;              // 生产者写入位置（仅生产者修改）
+    volatile uint16_t tail;              // DMA已发送位置（仅DMA完成中断修改）
+} SerialRing;
+
+static uint8_t ring_event_buf[SERIAL_RING_EVENT_SIZE];
+static uint8_t ring_export_buf[SERIAL_RING_EXPORT_SIZE];
+static uint8_t ring_live_buf[SERIAL_RING_LIVE_SIZE];
+
+static SerialRing tx_ring[SERIAL_PRIO_COUNT] =
+{
+    { ring_event_buf,  SERIAL_RING_EVENT_SIZE - 1,  0, 0 },
+    { ring_export_buf, SERIAL_RING_EXPORT_SIZE - 1, 0, 0 },
+    { ring_live_buf,   SERIAL_RING_LIVE_SIZE - 1,   0, 0 },
+};
+
+volatile uint32_t serial_drop_frames[SERIAL_PRIO_COUNT];
+volatile uint32_t serial_drop_bytes[SERIAL_PRIO_COUNT];
+
+/* 接收环形缓冲：RXNE中断写入，主循环读取 */
+static uint8_t rx_buf[SERIAL_RX_SIZE];
+static volatile uint16_t rx_head = 0;
+static volatile uint16_t rx_tail = 0;
+volatile uint32_t serial_rx_overruns = 0;
+
+static volatile uint8_t tx_active_prio = SERIAL_PRIO_NONE;  // 正在DMA发送的优先级
+static volatile uint16_t tx_active_len = 0;                 // 正在DMA发送的字节数
+static volatile uint8_t tx_sticky_prio = SERIAL_PRIO_NONE;  // 上一块在环尾截断，下一块必须继续同一优先级
+static volatile uint8_t tx_open_prio = SERIAL_PRIO_NONE;    // 分段写入中的长帧，帧发完前DMA只发送该优先级
+static volatile uint8_t tx_open_closing = 0;                // 长帧已写完（EndFrame），等待发送到帧尾
+static volatile uint16_t tx_open_end = 0;                   // 长帧帧尾在环中的位置（EndFrame时的head）
+
+static void Serial_Kick(void);
+
+/**
+  * @brief  配置USART1帧格式与波特率（8N1，收发）
+  */
+static void Serial_ConfigUsart(uint32_t baudrate)
+{
+    USART_InitTypeDef usart;
+
+    USART_StructInit(&usart);
+    usart.USART_BaudRate = baudrate;
+    usart.USART_WordLength = USART_WordLength_8b;
+    usart.USART_StopBits = USART_StopBits_1;
+    usart.USART_Parity = USART_Parity_No;
+    usart.USART_Mode = USART_Mode_Tx | USART_Mode_Rx;
+    usart.USART_HardwareFlowControl = USART_HardwareFlowControl_None;
+    USART_Init(USART1, &usart);
+}
+
+/**
+  * @brief  配置USART1（PA9=TX, PA10=RX, 8N1）与DMA1通道4发送
+  * @param  baudrate 波特率
+  * @retval 无
+  */
+void Serial_Init(uint32_t baudrate)
+{
+    GPIO_InitTypeDef gpio;
+    DMA_InitTypeDef dma;
+    NVIC_InitTypeDef nvic;
+
+    /* 开启时钟：GPIOA、USART1、DMA1 */
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA | RCC_APB2Periph_USART1, ENABLE);
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+
+    /* PA9 -> USART1_TX: 复用推挽输出 50MHz（USART1默认映射） */
+    gpio.GPIO_Pin = GPIO_Pin_9;
+    gpio.GPIO_Speed = GPIO_Speed_50MHz;
+    gpio.GPIO_Mode = GPIO_Mode_AF_PP;
+    GPIO_Init(GPIOA, &gpio);
+
+    /* PA10 -> USART1_RX: 上拉输入 */
+    gpio.GPIO_Pin = GPIO_Pin_10;
+    gpio.GPIO_Speed = GPIO_Speed_50MHz;
+    gpio.GPIO_Mode = GPIO_Mode_IPU;
+    GPIO_Init(GPIOA, &gpio);
+
+    Serial_ConfigUsart(baudrate);
+
+    /* DMA1通道4 = USART1_TX：内存->外设，单次模式，每次由Serial_Kick装载一段连续数据 */
+    DMA_DeInit(DMA1_Channel4);
+    dma.DMA_PeripheralBaseAddr = (uint32_t)&USART1->DR;
+    dma.DMA_MemoryBaseAddr = (uint32_t)ring_event_buf;
+    dma.DMA_DIR = DMA_DIR_PeripheralDST;
+    dma.DMA_BufferSize = 1;
+    dma.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    dma.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    dma.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+    dma.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+    dma.DMA_Mode = DMA_Mode_Normal;
+    dma.DMA_Priority = DMA_Priority_Medium;   // 低于ADC采样DMA
+    dma.DMA_M2M = DMA_M2M_Disable;
+    DMA_Init(DMA1_Channel4, &dma);
+    DMA_ITConfig(DMA1_Channel4, DMA_IT_TC, ENABLE);
+
+    /* 发送完成中断优先级低于采样DMA(0)与模拟看门狗(1) */
+    nvic.NVIC_IRQChannel = DMA1_Channel4_IRQn;
+    nvic.NVIC_IRQChannelPreemptionPriority = 2;
+    nvic.NVIC_IRQChannelSubPriority = 0;
+    nvic.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&nvic);
+
+    /* 接收中断：优先级最低，一个字符时间内（115200下约87us）取走即可 */
+    nvic.NVIC_IRQChannel = USART1_IRQn;
+    nvic.NVIC_IRQChannelPreemptionPriority = 3;
+    nvic.NVIC_IRQChannelSubPriority = 0;
+    nvic.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&nvic);
+    USART_ITConfig(USART1, USART_IT_RXNE, ENABLE);
+
+    USART_DMACmd(USART1, USART_DMAReq_Tx, ENABLE);
+    USART_Cmd(USART1, ENABLE);
+}
+
+/**
+  * @brief  切换波特率
+  * @param  baudrate 新波特率（APB2=72MHz，1M/2M可精确分频）
+  * @note   主循环调用；先等待所有环形缓冲发完（115200下最长约60ms，采样不受影响），
+  *         再关闭USART改写分频，避免最后几个字节以错误波特率发出
+  */
+void Serial_SetBaud(uint32_t baudrate)
+{
+    while (!Serial_IsIdle())
+    {
+    }
+    while (USART_GetFlagStatus(USART1, USART_FLAG_TC) == RESET)
+    {
+    }
+    USART_Cmd(USART1, DISABLE);
+    Serial_ConfigUsart(baudrate);
+    USART_Cmd(USART1, ENABLE);
+}
+
+/**
+  * @brief  查询某优先级环形缓冲剩余空间
+  * @param  prio 发送优先级
+  * @retval 可写入字节数
+  */
+uint16_t Serial_Free(uint8_t prio)
+{
+    SerialRing *r = &tx_ring[prio];
+    return (uint16_t)(r->mask - ((r->head - r->tail) & r->mask));
+}
+
+/**
+  * @brief  非阻塞写入一帧
+  * @param  prio 发送优先级（SERIAL_PRIO_xxx）
+  * @param  data 帧数据
+  * @param  len  帧长度
+  * @retval 1：已入队，0：空间不足整帧丢弃（计入serial_drop_xxx）
+  * @note   整帧要么全部入队要么全部丢弃，保证接收端不会看到半帧；
+  *         每个优先级只允许一个生产者（主循环或同一中断）
+  */
+uint8_t Serial_Write(uint8_t prio, const uint8_t *data, uint16_t len)
+{
+    SerialRing *r = &tx_ring[prio];
+    uint16_t head = r->head;
+    uint16_t i;
+
+    if (len == 0)
+    {
+        return 1;
+    }
+    if (len > Serial_Free(prio))
+    {
+        serial_drop_frames[prio]++;
+        serial_drop_bytes[prio] += len;
+        return 0;
+    }
+
+    for (i = 0; i < len; i++)
+    {
+        r->buf[head] = data[i];
+        head = (head + 1) & r->mask;
+    }
+    r->head = head;                      // 数据写完后再发布head，DMA只会看到完整的帧
+
+    Serial_Kick();
+    return 1;
+}
+
+/**
+  * @brief  开始分段写入一个长帧
+  * @param  prio 长帧所在优先级
+  * @retval 1：成功，0：已有其他长帧未发完
+  * @note   超过环形缓冲容量的帧（如快照导出）分多次Serial_Write写入，
+  *         直到Serial_EndFrame之后帧尾发出，DMA不会插入其他优先级的数据，接收端看到的帧保持连续
+  */
+uint8_t Serial_BeginFrame(uint8_t prio)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint8_t ok = 0;
+
+    __disable_irq();
+    if (tx_open_prio == SERIAL_PRIO_NONE)
+    {
+        tx_open_prio = prio;
+        ok = 1;
+    }
+    __set_PRIMASK(primask);
+    return ok;
+}
+
+/**
+  * @brief  结束分段写入的长帧
+  * @note   帧尾可能还在环中排队（在正在发送的DMA块之后），记下帧尾位置，
+  *         发送越过帧尾时才解除锁定、恢复按优先级调度（见Serial_Kick与Serial_TxComplete_IRQ）
+  */
+void Serial_EndFrame(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (tx_open_prio != SERIAL_PRIO_NONE)
+    {
+        tx_open_end = tx_ring[tx_open_prio].head;
+        tx_open_closing = 1;
+    }
+    __set_PRIMASK(primask);
+    Serial_Kick();
+}
+
+/* 解除长帧锁定（关中断调用） */
+static void Serial_ReleaseFrame(void)
+{
+    tx_open_prio = SERIAL_PRIO_NONE;
+    tx_open_closing = 0;
+}
+
+/**
+  * @brief  发送是否全部完成（所有环形缓冲为空且DMA空闲）
+  */
+uint8_t Serial_IsIdle(void)
+{
+    uint8_t p;
+    if (tx_active_prio != SERIAL_PRIO_NONE)
+    {
+        return 0;
+    }
+    for (p = 0; p < SERIAL_PRIO_COUNT; p++)
+    {
+        if (tx_ring[p].head != tx_ring[p].tail)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+  * @brief  DMA空闲时装载下一段待发送数据
+  * @note   选择规则：上一块因环尾回绕被截断时继续同一优先级（帧未发完）；
+  *         有分段长帧未发完（含EndFrame之后帧尾仍在排队）时只发该优先级；否则选有数据的最高优先级。
+  *         一块的结尾若等于head，一定是帧边界，因此优先级切换只发生在帧之间。主循环与中断都会调用，需关中断保护
+  */
+static void Serial_Kick(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint8_t prio = SERIAL_PRIO_NONE;
+    uint8_t p;
+
+    __disable_irq();
+    if (tx_open_closing && tx_active_prio == SERIAL_PRIO_NONE &&
+        tx_ring[tx_open_prio].tail == tx_open_end)
+    {
+        Serial_ReleaseFrame();           // 长帧已全部发出
+    }
+    if (tx_active_prio == SERIAL_PRIO_NONE)
+    {
+        if (tx_sticky_prio != SERIAL_PRIO_NONE &&
+            tx_ring[tx_sticky_prio].head != tx_ring[tx_sticky_prio].tail)
+        {
+            prio = tx_sticky_prio;       // 先把回绕截断的那一帧发完
+        }
+        else if (tx_open_prio != SERIAL_PRIO_NONE)
+        {
+            /* 长帧未发完：即使该环暂时为空也不切换，等待生产者补齐 */
+            if (tx_ring[tx_open_prio].head != tx_ring[tx_open_prio].tail)
+            {
+                prio = tx_open_prio;
+            }
+        }
+        else
+        {
+            for (p = 0; p < SERIAL_PRIO_COUNT; p++)
+            {
+                if (tx_ring[p].head != tx_ring[p].tail)
+                {
+                    prio = p;
+                    break;
+                }
+            }
+        }
+
+        if (prio != SERIAL_PRIO_NONE)
+        {
+            SerialRing *r = &tx_ring[prio];
+            uint16_t head = r->head;
+            uint16_t tail = r->tail;
+            uint16_t len;
+
+            if (head >= tail)
+            {
+                len = head - tail;
+                tx_sticky_prio = SERIAL_PRIO_NONE;
+            }
+            else
+            {
+                len = (uint16_t)(r->mask + 1 - tail);   // 先发到环尾，剩余部分下一块接着发
+                tx_sticky_prio = prio;
+            }
+
+            tx_active_prio = prio;
+            tx_active_len = len;
+            DMA1_Channel4->CCR &= ~DMA_CCR1_EN;
+            DMA1_Channel4->CMAR = (uint32_t)&r->buf[tail];
+            DMA1_Channel4->CNDTR = len;
+            DMA1_Channel4->CCR |= DMA_CCR1_EN;
+        }
+    }
+    __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  DMA1通道4传输完成处理（由DMA1_Channel4_IRQHandler调用）
+  */
+void Serial_TxComplete_IRQ(void)
+{
+    uint8_t prio = tx_active_prio;
+
+    if (prio != SERIAL_PRIO_NONE)
+    {
+        SerialRing *r = &tx_ring[prio];
+
+        /* 本块越过长帧帧尾：帧已完整发出，之后可切换优先级 */
+        if (tx_open_closing && prio == tx_open_prio &&
+            ((tx_open_end - r->tail) & r->mask) <= tx_active_len)
+        {
+            Serial_ReleaseFrame();
+        }
+        r->tail = (r->tail + tx_active_len) & r->mask;
+        tx_active_prio = SERIAL_PRIO_NONE;
+        tx_active_len = 0;
+    }
+    Serial_Kick();
+}
+
+/**
+  * @brief  读取一个接收字节（主循环调用）
+  * @param  b 输出字节
+  * @retval 1：读到，0：接收缓冲为空
+  */
+uint8_t Serial_ReadByte(uint8_t *b)
+{
+    uint16_t tail = rx_tail;
+
+    if (tail == rx_head)
+    {
+        return 0;
+    }
+    *b = rx_buf[tail];
+    rx_tail = (tail + 1) & (SERIAL_RX_SIZE - 1);
+    return 1;
+}
+
+/**
+  * @brief  USART1接收中断处理（在USART1_IRQHandler中调用）
+  * @note   先读SR再读DR同时清除RXNE与ORE；缓冲满或硬件溢出都计入serial_rx_overruns
+  */
+void Serial_Rx_IRQ(void)
+{
+    uint16_t sr = USART1->SR;
+    uint8_t b;
+    uint16_t next;
+
+    if (!(sr & (USART_FLAG_RXNE | USART_FLAG_ORE)))
+    {
+        return;
+    }
+    b = (uint8_t)USART1->DR;
+    if (sr & USART_FLAG_ORE)
+    {
+        serial_rx_overruns++;
+    }
+
+    next = (rx_head + 1) & (SERIAL_RX_SIZE - 1);
+    if (next == rx_tail)
+    {
+        serial_rx_overruns++;
+        return;
+    }
+    rx_buf[rx_head] = b;
+    rx_head = next;
+}
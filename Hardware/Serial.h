@@ -0,0 +1,36 @@
+#ifndef __SERIAL_H
+#define __SERIAL_H
+
+#include "stm32f10x.h"
+
+/* 发送优先级：数值越小越优先。DMA只在帧边界切换优先级，帧不会被拆开交错 */
+#define SERIAL_PRIO_EVENT       0        // 事件帧（有效雨滴峰值等）
+#define SERIAL_PRIO_EXPORT      1        // 快照导出
+#define SERIAL_PRIO_LIVE        2        // 连续示波流
+#define SERIAL_PRIO_COUNT       3
+
+/* 各优先级环形缓冲大小（字节，必须为2的幂） */
+#define SERIAL_RING_EVENT_SIZE  256      // 统计帧含检测漏斗，约100字节
+#define SERIAL_RING_EXPORT_SIZE 256
+#define SERIAL_RING_LIVE_SIZE   256
+#define SERIAL_RX_SIZE          64       // 接收环形缓冲（命令行）
+
+#define SERIAL_BAUDRATE         115200
+
+/* 溢出统计：整帧丢弃的次数与字节数 */
+extern volatile uint32_t serial_drop_frames[SERIAL_PRIO_COUNT];
+extern volatile uint32_t serial_drop_bytes[SERIAL_PRIO_COUNT];
+extern volatile uint32_t serial_rx_overruns;    // 接收溢出（缓冲满或硬件ORE）
+
+void Serial_Init(uint32_t baudrate);
+void Serial_SetBaud(uint32_t baudrate);
+uint8_t Serial_Write(uint8_t prio, const uint8_t *data, uint16_t len);
+uint16_t Serial_Free(uint8_t prio);
+uint8_t Serial_IsIdle(void);
+uint8_t Serial_BeginFrame(uint8_t prio);
+void Serial_EndFrame(void);
+void Serial_TxComplete_IRQ(void);
+uint8_t Serial_ReadByte(uint8_t *b);
+void Serial_Rx_IRQ(void);
+
+#endif
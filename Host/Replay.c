@@ -0,0 +1,252 @@
+#include "Replay.h"
+#include "CoreHal.h"
+#include "Detector.h"
+#include "Threshold.h"
+#include "RainStats.h"
+#include "DropSize.h"
+
+static ReplayStats stats;
+static ReplayEventFn event_fn;
+static void *event_user;
+static uint32_t loop_period_us;
+static uint64_t elapsed_us;              // 已处理样本对应的时间
+static uint64_t next_loop_us;            // 下一次主循环的时间
+
+static uint16_t awd_threshold;           // 模拟看门狗上限（固件AD_SetThreshold）
+static uint32_t last_trigger_tick;       // 当前快照的触发样本
+
+static uint16_t pending[DETECTOR_BLOCK_SAMPLES];  // 未凑满一块的样本
+static uint16_t pending_count;
+
+/* 主循环临时区（固件为arena_work，平滑与噪声窗口不同时使用） */
+static uint16_t scratch[SNAPSHOT_SIZE];
+
+static void Hal_SetThreshold(void *user, uint16_t threshold)
+{
+    (void)user;
+    awd_threshold = threshold;
+    stats.threshold_updates++;
+    if (threshold < stats.threshold_min)
+        stats.threshold_min = threshold;
+    if (threshold > stats.threshold_max)
+        stats.threshold_max = threshold;
+}
+
+static void Hal_Trigger(void *user, uint32_t tick, uint16_t tail)
+{
+    (void)user;
+    (void)tail;
+    last_trigger_tick = tick;
+}
+
+static const CoreHal replay_hal = { 0, 0, Hal_SetThreshold, Hal_Trigger, 0 };
+
+static void Emit(ReplayEvent *ev)
+{
+    ev->trigger_tick = last_trigger_tick;
+    ev->judged_tick = sampling_tick_counter;
+    ev->threshold = dynamic_threshold;
+    if (ev->decision != REPLAY_DEADTIME)
+    {
+        uint32_t latency = ev->judged_tick - ev->trigger_tick;
+
+        stats.judged++;
+        stats.latency_sum_ticks += latency;
+        if (latency > stats.latency_max_ticks)
+            stats.latency_max_ticks = latency;
+    }
+    if (event_fn != 0)
+        event_fn(event_user, ev);
+}
+
+/**
+  * @brief  主循环中与检测有关的部分（顺序与main.c一致）
+  */
+static void Replay_MainLoop(void)
+{
+    SnapshotVerdict verdict;
+    ReplayEvent ev = { 0 };
+    uint8_t state;
+
+    stats.loops++;
+
+    /* 在线峰值只用于显示，这里只统计 */
+    if (last_peak_ready_from_isr)
+    {
+        last_peak_ready_from_isr = 0;
+        stats.isr_peaks++;
+    }
+
+    RainStats_Advance(sampling_tick_counter);
+
+    state = DropCounter_Judge(scratch, &verdict);
+    if (state == DROPCOUNTER_DEADTIME)
+    {
+        ev.decision = REPLAY_DEADTIME;
+        Emit(&ev);
+    }
+    else if (state == DROPCOUNTER_JUDGED)
+    {
+        ev.baseline = verdict.baseline;
+        ev.peak_value = verdict.peak_value;
+        ev.amplitude = (verdict.peak_value > verdict.baseline) ? (uint16_t)(verdict.peak_value - verdict.baseline) : 0;
+        ev.width = (uint16_t)(verdict.end_index - verdict.start_index + 1);
+        ev.reject = verdict.reject;
+        if (verdict.reject == REJECT_NONE)
+        {
+            ev.decision = REPLAY_COUNTED;
+            ev.volume_nl = DropCounter_Count(&verdict);
+        }
+        else
+        {
+            ev.decision = REPLAY_REJECTED;
+        }
+        Emit(&ev);
+        snapshot_ready = 0;
+    }
+
+    Threshold_Update(scratch);
+    DropCounter_Loop();
+}
+
+static void Replay_Block(const uint16_t *block)
+{
+    uint16_t i;
+
+    for (i = 0; i < DETECTOR_BLOCK_SAMPLES; i++)
+    {
+        if (block[i] > awd_threshold)
+        {
+            stats.awd_blocks++;
+            if (snapshot_collecting || snapshot_ready)
+                stats.awd_busy_blocks++;
+            Detector_AwdTrigger();
+            break;
+        }
+    }
+    Detector_ProcessBlock(block, DETECTOR_BLOCK_SAMPLES);
+    stats.blocks++;
+    stats.samples += DETECTOR_BLOCK_SAMPLES;
+
+    elapsed_us += (uint64_t)DETECTOR_BLOCK_SAMPLES * RAINSTATS_TICK_US;
+    while (elapsed_us >= next_loop_us)
+    {
+        Replay_MainLoop();
+        next_loop_us += loop_period_us;
+    }
+}
+
+/**
+  * @brief  复位检测核心并开始一段回放
+  * @param  loop_us  主循环周期（微秒），0取REPLAY_LOOP_US
+  * @param  on_event 每个快照处理结果的回调，可为0
+  * @param  user     原样传给回调
+  * @note   状态与上电一致：冷启动阈值、空基线、累计量为0；同一进程内可多次调用
+  */
+void Replay_Init(uint32_t loop_us, ReplayEventFn on_event, void *user)
+{
+    ReplayStats zero = { 0 };
+
+    Detector_Reset();
+    Threshold_Reset();
+    DropCounter_Reset();
+    DropSize_ClearHistogram();
+    RainStats_Reset(0);
+    CoreHal_Register(&replay_hal);
+
+    stats = zero;
+    stats.threshold_min = dynamic_threshold;
+    stats.threshold_max = dynamic_threshold;
+    event_fn = on_event;
+    event_user = user;
+    loop_period_us = (loop_us != 0) ? loop_us : REPLAY_LOOP_US;
+    elapsed_us = 0;
+    next_loop_us = loop_period_us;
+    awd_threshold = dynamic_threshold;   // 固件上电AD_SetThreshold(dynamic_threshold)
+    last_trigger_tick = 0;
+    pending_count = 0;
+}
+
+/**
+  * @brief  送入一段连续样本（任意长度，内部按块切分）
+  */
+void Replay_Feed(const uint16_t *samples, uint32_t count)
+{
+    while (count > 0)
+    {
+        if (pending_count == 0 && count >= DETECTOR_BLOCK_SAMPLES)
+        {
+            Replay_Block(samples);
+            samples += DETECTOR_BLOCK_SAMPLES;
+            count -= DETECTOR_BLOCK_SAMPLES;
+            continue;
+        }
+        pending[pending_count++] = *samples++;
+        count--;
+        if (pending_count == DETECTOR_BLOCK_SAMPLES)
+        {
+            Replay_Block(pending);
+            pending_count = 0;
+        }
+    }
+}
+
+const ReplayStats *Replay_Stats(void)
+{
+    return &stats;
+}
+
+/**
+  * @brief  把事件与标注的雨滴起点对应起来
+  * @param  events      回放事件（按触发顺序）
+  * @param  labels      标注的雨滴起点采样计数（升序）
+  * @param  tolerance   触发样本与起点相差不超过该值（采样数）视为同一滴
+  * @param  out         比对统计
+  * @param  outcome     每个标注的结果REPLAY_xxx（label_count个），可为0
+  * @note   按时间顺序贪心匹配：每个事件取容差内最早的未匹配标注
+  */
+void Replay_Match(const ReplayEvent *events, uint32_t event_count,
+                  const uint32_t *labels, uint32_t label_count, uint32_t tolerance,
+                  ReplayMatch *out, uint8_t *outcome)
+{
+    ReplayMatch m = { 0 };
+    uint32_t e, l = 0, k;
+
+    m.labels = label_count;
+    if (outcome != 0)
+    {
+        for (k = 0; k < label_count; k++)
+            outcome[k] = REPLAY_MISSED;
+    }
+
+    for (e = 0; e < event_count; e++)
+    {
+        const ReplayEvent *ev = &events[e];
+        uint32_t lo = (ev->trigger_tick > tolerance) ? ev->trigger_tick - tolerance : 0;
+
+        /* 早于本事件容差窗口的标注不会再被后续事件匹配 */
+        while (l < label_count && labels[l] < lo)
+        {
+            m.missed++;
+            l++;
+        }
+        if (l < label_count && labels[l] <= ev->trigger_tick + tolerance)
+        {
+            if (ev->decision == REPLAY_COUNTED)
+                m.counted++;
+            else if (ev->decision == REPLAY_REJECTED)
+                m.rejected++;
+            else
+                m.deadtime++;
+            if (outcome != 0)
+                outcome[l] = ev->decision;
+            l++;
+        }
+        else if (ev->decision == REPLAY_COUNTED)
+        {
+            m.false_counts++;
+        }
+    }
+    m.missed += label_count - l;
+    *out = m;
+}
@@ -0,0 +1,74 @@
+#ifndef __REPLAY_H
+#define __REPLAY_H
+
+#include <stdint.h>
+#include "DropCounter.h"
+
+/*
+ * 主机回放：按固件的中断+主循环时序把采样流送入检测核心
+ *   采样流按DETECTOR_BLOCK_SAMPLES切块（DMA半传输/传输完成），每块：
+ *     块内有样本超过模拟看门狗阈值 → Detector_AwdTrigger()（ADC中断优先级低于DMA，
+ *     越界发生在本块采集期间，DMA中断处理本块时标志已置位）→ Detector_ProcessBlock
+ *   采样时间每越过一个主循环周期（默认10ms）执行一次主循环中与检测有关的部分：
+ *     清在线峰值标志 → RainStats_Advance → DropCounter_Judge/Count → Threshold_Update → DropCounter_Loop
+ *   显示、遥测、日志与导出不参与计数，回放不执行
+ *   不足一块的尾部样本不处理（固件中DMA未完成半缓冲时不会产生中断）
+ */
+#define REPLAY_LOOP_US          10000u   // 主循环周期（Delay_ms(10)）
+
+#define REPLAY_COUNTED          0        // 验证通过并计数
+#define REPLAY_REJECTED         1        // 验证拒绝（reject为原因）
+#define REPLAY_DEADTIME         2        // 事件级死区内丢弃，未判定
+#define REPLAY_MISSED           3        // 标注比对：没有对应的触发
+
+typedef struct
+{
+    uint32_t trigger_tick;               // 触发样本的采样计数
+    uint32_t judged_tick;                // 主循环判定时的采样计数
+    uint8_t decision;                    // REPLAY_xxx
+    uint8_t reject;                      // REJECT_xxx（仅REPLAY_REJECTED）
+    uint16_t threshold;                  // 判定时的动态阈值
+    int32_t baseline;                    // 快照基线（死区丢弃时为0，下同）
+    uint16_t peak_value;                 // 前部峰值
+    uint16_t amplitude;                  // 峰值减基线
+    uint16_t width;                      // 前部样本数
+    uint32_t volume_nl;                  // 单滴体积（仅计数事件）
+} ReplayEvent;
+
+typedef void (*ReplayEventFn)(void *user, const ReplayEvent *ev);
+
+typedef struct
+{
+    uint64_t samples;                    // 已处理样本数
+    uint64_t blocks;                     // 已处理块数
+    uint32_t loops;                      // 主循环次数
+    uint32_t awd_blocks;                 // 含越界样本的块（模拟看门狗中断）
+    uint32_t awd_busy_blocks;            // 其中快照采集中/待判定的块（触发被推迟或合并）
+    uint32_t isr_peaks;                  // 在线峰值检测给出的完整脉冲
+    uint32_t threshold_updates;          // 自适应阈值变化次数
+    uint16_t threshold_min;              // 阈值变化范围
+    uint16_t threshold_max;
+    uint32_t latency_max_ticks;          // 触发到判定的最大采样数
+    uint64_t latency_sum_ticks;          // 触发到判定的采样数之和（除以判定事件数得均值）
+    uint32_t judged;                     // 判定事件数（计数+拒绝）
+} ReplayStats;
+
+/* 与标注的比对结果（每个标注至多对应一个事件） */
+typedef struct
+{
+    uint32_t labels;                     // 标注雨滴数
+    uint32_t counted;                    // 对应事件计数
+    uint32_t rejected;                   // 对应事件被拒绝
+    uint32_t deadtime;                   // 对应快照在事件级死区内丢弃
+    uint32_t missed;                     // 没有对应的触发（漏触发）
+    uint32_t false_counts;               // 没有对应标注的计数事件（误计数）
+} ReplayMatch;
+
+void Replay_Init(uint32_t loop_us, ReplayEventFn on_event, void *user);
+void Replay_Feed(const uint16_t *samples, uint32_t count);
+const ReplayStats *Replay_Stats(void);
+void Replay_Match(const ReplayEvent *events, uint32_t event_count,
+                  const uint32_t *labels, uint32_t label_count, uint32_t tolerance,
+                  ReplayMatch *out, uint8_t *outcome);
+
+#endif
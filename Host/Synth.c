@@ -0,0 +1,303 @@
+#include <math.h>
+#include "Synth.h"
+#include "Detector.h"
+
+#define SYNTH_MAX_PULSES        256      // 同时存在的脉冲上限（暴雨下也远未用满）
+#define SYNTH_PI                3.14159265358979323846
+
+typedef struct
+{
+    double start;                        // 起点（采样计数，可含小数）
+    uint64_t end;                        // 之后贡献可忽略
+    double amp;                          // 峰值（LSB）
+    double tau_r, tau_d;                 // 采样数
+    double norm;                         // 双指数归一化系数
+    double t_peak;                       // 主脉冲峰值时刻（相对起点）
+    double ring_w;                       // 振铃角频率（弧度/样本）
+    double ring_tau;
+} SynthPulse;
+
+static SynthConfig cfg;
+static SynthLabelFn label_fn;
+static void *label_user;
+
+static uint64_t rng;
+static double gauss_spare;
+static uint8_t has_spare;
+
+static double fs;                        // 采样率
+static double mv_to_lsb;
+static uint64_t now;                     // 下一个输出样本的采样计数
+static double next_drop, next_emi;
+static double hum_phase;
+
+static SynthPulse pulses[SYNTH_MAX_PULSES];
+static uint16_t pulse_count;
+static double emi_value;
+static uint8_t emi_left;
+
+/* xorshift64*：与平台和C库无关，同一种子逐位可复现 */
+static uint64_t Rng_Next(void)
+{
+    rng ^= rng >> 12;
+    rng ^= rng << 25;
+    rng ^= rng >> 27;
+    return rng * 2685821657736338717ull;
+}
+
+/* (0, 1)开区间均匀分布 */
+static double Rng_Uniform(void)
+{
+    return ((double)(Rng_Next() >> 11) + 0.5) / 9007199254740992.0;
+}
+
+static double Rng_Gauss(void)
+{
+    double u, v;
+
+    if (has_spare)
+    {
+        has_spare = 0;
+        return gauss_spare;
+    }
+    u = sqrt(-2.0 * log(Rng_Uniform()));
+    v = 2.0 * SYNTH_PI * Rng_Uniform();
+    gauss_spare = u * sin(v);
+    has_spare = 1;
+    return u * cos(v);
+}
+
+/* 泊松过程的下一次到达间隔（采样数） */
+static double Next_Interval(double rate_hz)
+{
+    if (rate_hz <= 0.0)
+        return HUGE_VAL;
+    return -log(Rng_Uniform()) * fs / rate_hz;
+}
+
+/* 按配置的分布取一个雨滴幅度（mV，相对基线） */
+static double Draw_Amplitude(void)
+{
+    double max_mv = SYNTH_ADC_REF_MV - cfg.baseline_mv;
+    double a;
+    uint8_t dist = cfg.amp_dist;
+
+    if (dist == SYNTH_AMP_MIX)
+        dist = (Rng_Uniform() < cfg.amp_mix) ? SYNTH_AMP_SMALL : SYNTH_AMP_EXP;
+
+    switch (dist)
+    {
+        case SYNTH_AMP_UNIFORM:
+            a = cfg.amp_a + (cfg.amp_b - cfg.amp_a) * Rng_Uniform();
+            break;
+        case SYNTH_AMP_SMALL:
+            a = SYNTH_SMALL_MIN_MV + (SYNTH_SMALL_MAX_MV - SYNTH_SMALL_MIN_MV) * Rng_Uniform() - cfg.baseline_mv;
+            break;
+        default:
+            a = -cfg.amp_a * log(Rng_Uniform());
+            if (a < cfg.amp_b)
+                a = cfg.amp_b;
+            break;
+    }
+    if (a > max_mv)
+        a = max_mv;
+    if (a < 1.0)
+        a = 1.0;
+    return a;
+}
+
+static void Start_Drop(double start)
+{
+    SynthPulse *p;
+    SynthLabel label;
+    double jr = 1.0 + cfg.shape_jitter * (2.0 * Rng_Uniform() - 1.0);
+    double jd = 1.0 + cfg.shape_jitter * (2.0 * Rng_Uniform() - 1.0);
+    double amp_mv = Draw_Amplitude();
+    double life;
+    uint16_t i;
+
+    label.overlap = 0;
+    for (i = 0; i < pulse_count; i++)
+    {
+        if (start < pulses[i].start + pulses[i].t_peak + 3.0 * pulses[i].tau_d)
+            label.overlap = 1;
+    }
+
+    /* 满员时顶替最早的脉冲（此时它的贡献早已很小） */
+    if (pulse_count == SYNTH_MAX_PULSES)
+    {
+        for (i = 1; i < pulse_count; i++)
+            pulses[i - 1] = pulses[i];
+        pulse_count--;
+    }
+    p = &pulses[pulse_count++];
+
+    p->start = start;
+    p->amp = amp_mv * mv_to_lsb;
+    p->tau_r = cfg.rise_us * jr * fs / 1e6;
+    p->tau_d = cfg.decay_us * jd * fs / 1e6;
+    if (p->tau_r < 0.05)
+        p->tau_r = 0.05;
+    if (p->tau_d < p->tau_r * 1.05)
+        p->tau_d = p->tau_r * 1.05;
+    p->t_peak = log(p->tau_d / p->tau_r) * p->tau_r * p->tau_d / (p->tau_d - p->tau_r);
+    p->norm = 1.0 / (exp(-p->t_peak / p->tau_d) - exp(-p->t_peak / p->tau_r));
+    p->ring_w = 2.0 * SYNTH_PI * cfg.ring_hz / fs;
+    p->ring_tau = cfg.ring_us * fs / 1e6;
+    life = p->t_peak + 8.0 * ((p->tau_d > p->ring_tau) ? p->tau_d : p->ring_tau);
+    p->end = (uint64_t)(start + life) + 1;
+
+    label.tick = (uint32_t)start;
+    label.kind = SYNTH_LABEL_DROP;
+    label.amplitude_mv = (float)amp_mv;
+    label.rise_us = (float)(p->tau_r * 1e6 / fs);
+    label.decay_us = (float)(p->tau_d * 1e6 / fs);
+    label.peak_tick = (uint32_t)(start + p->t_peak + 0.5);
+    if (label_fn != 0)
+        label_fn(label_user, &label);
+}
+
+static void Start_Emi(double start)
+{
+    SynthLabel label = { 0 };
+    double amp_mv = cfg.emi_mv * (0.5 + 0.5 * Rng_Uniform());
+
+    if (Rng_Uniform() < 0.5)
+        amp_mv = -amp_mv;
+    emi_value = amp_mv * mv_to_lsb;
+    emi_left = (uint8_t)(1 + (Rng_Next() & 1));
+
+    label.tick = (uint32_t)start;
+    label.kind = SYNTH_LABEL_EMI;
+    label.amplitude_mv = (float)amp_mv;
+    label.peak_tick = label.tick;
+    if (label_fn != 0)
+        label_fn(label_user, &label);
+}
+
+/* 单个脉冲在相对时刻t（采样数）的值（LSB） */
+static double Pulse_Value(const SynthPulse *p, double t)
+{
+    double v = p->amp * p->norm * (exp(-t / p->tau_d) - exp(-t / p->tau_r));
+
+    if (t > p->t_peak && cfg.ring_ratio > 0.0f)
+    {
+        double tr = t - p->t_peak;
+        v -= p->amp * cfg.ring_ratio * exp(-tr / p->ring_tau) * sin(p->ring_w * tr);
+    }
+    return v;
+}
+
+/**
+  * @brief  默认参数：约300LSB基线、2滴/秒、小雨滴带与指数分布各半、τr 250us/τd 800us
+  */
+void Synth_Defaults(SynthConfig *c)
+{
+    c->baseline_mv = 242.0f;             // 约300LSB
+    c->drift_mv = 5.0f;
+    c->drift_period_s = 60.0f;
+    c->hum_mv = 3.0f;
+    c->hum_hz = 50.0f;
+    c->emi_rate_hz = 0.2f;
+    c->emi_mv = 400.0f;
+    c->noise_lsb = 1.5f;
+    c->drop_rate_hz = 2.0f;
+    c->amp_dist = SYNTH_AMP_MIX;
+    c->amp_a = 500.0f;
+    c->amp_b = 150.0f;
+    c->amp_mix = 0.5f;
+    c->rise_us = 250.0f;
+    c->decay_us = 800.0f;
+    c->shape_jitter = 0.2f;
+    c->ring_ratio = 0.3f;
+    c->ring_hz = 1500.0f;
+    c->ring_us = 1000.0f;
+    c->seed = 1;
+}
+
+/**
+  * @brief  按配置开始一段新信号（采样计数从0起）
+  * @param  on_label 每个雨滴/干扰生成时的标注回调，可为0
+  */
+void Synth_Init(const SynthConfig *c, SynthLabelFn on_label, void *user)
+{
+    cfg = *c;
+    label_fn = on_label;
+    label_user = user;
+
+    rng = 0x9E3779B97F4A7C15ull ^ ((uint64_t)cfg.seed * 0xD1B54A32D192ED03ull);
+    if (rng == 0)
+        rng = 1;
+    has_spare = 0;
+
+    fs = 1e6 / ADC_SAMPLE_INTERVAL_US;
+    mv_to_lsb = SYNTH_ADC_FULL_SCALE / SYNTH_ADC_REF_MV;
+    now = 0;
+    pulse_count = 0;
+    emi_left = 0;
+    hum_phase = 2.0 * SYNTH_PI * Rng_Uniform();
+    next_drop = Next_Interval(cfg.drop_rate_hz);
+    next_emi = Next_Interval(cfg.emi_rate_hz);
+}
+
+/**
+  * @brief  生成后续count个样本（12位，可分段多次调用，结果与一次生成相同）
+  */
+void Synth_Generate(uint16_t *out, uint32_t count)
+{
+    double drift_w = (cfg.drift_period_s > 0.0f) ? 2.0 * SYNTH_PI / (cfg.drift_period_s * fs) : 0.0;
+    double hum_w = 2.0 * SYNTH_PI * cfg.hum_hz / fs;
+    uint32_t n;
+
+    for (n = 0; n < count; n++, now++)
+    {
+        double t = (double)now;
+        double v;
+        uint16_t i;
+
+        while (next_drop <= t)
+        {
+            Start_Drop(next_drop);
+            next_drop += Next_Interval(cfg.drop_rate_hz);
+        }
+        while (next_emi <= t)
+        {
+            Start_Emi(next_emi);
+            next_emi += Next_Interval(cfg.emi_rate_hz);
+        }
+
+        v = cfg.baseline_mv * mv_to_lsb
+          + cfg.drift_mv * mv_to_lsb * sin(drift_w * t)
+          + cfg.hum_mv * mv_to_lsb * sin(hum_w * t + hum_phase);
+
+        for (i = 0; i < pulse_count; )
+        {
+            if (now >= pulses[i].end)
+            {
+                pulses[i] = pulses[--pulse_count];
+                continue;
+            }
+            v += Pulse_Value(&pulses[i], t - pulses[i].start);
+            i++;
+        }
+        if (emi_left > 0)
+        {
+            v += emi_value;
+            emi_left--;
+        }
+
+        /* ADC噪声后量化：四舍五入到整数LSB并限幅到12位 */
+        v += cfg.noise_lsb * Rng_Gauss();
+        v = floor(v + 0.5);
+        if (v < 0.0)
+            v = 0.0;
+        if (v > SYNTH_ADC_FULL_SCALE)
+            v = SYNTH_ADC_FULL_SCALE;
+        out[n] = (uint16_t)v;
+    }
+}
+
+double Synth_SampleRate(void)
+{
+    return 1e6 / ADC_SAMPLE_INTERVAL_US;
+}
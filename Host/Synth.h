@@ -0,0 +1,72 @@
+#ifndef __SYNTH_H
+#define __SYNTH_H
+
+#include <stdint.h>
+
+/*
+ * 合成雨滴信号（主机基准测试的信号源）
+ *   按ADC采样率（1/ADC_SAMPLE_INTERVAL_US）输出12位样本，电压按3.3V满量程量化：
+ *     基线 + 慢漂移（正弦）+ 工频（默认50Hz）+ Σ雨滴脉冲 + 脉冲干扰 + ADC噪声（高斯，LSB）→ 四舍五入、限幅
+ *   雨滴：泊松到达（速率可到暴雨量级，脉冲自然重叠并线性叠加），
+ *     主脉冲为双指数 A*(e^(-t/τd) - e^(-t/τr))，归一化到峰值A；τr/τd按比例随机抖动；
+ *     峰值之后叠加衰减正弦振铃（先负向），幅度为A的ring_ratio倍
+ *   幅度分布（峰值相对基线，mV）：均匀、指数（小滴多、大滴少）、420-540mV小雨滴带（绝对峰值）及两者混合
+ *   每个雨滴/干扰在生成时经回调给出标注（起点采样计数与参数），随机数为固定算法，同一种子结果逐位相同
+ */
+#define SYNTH_ADC_FULL_SCALE    4095.0
+#define SYNTH_ADC_REF_MV        3300.0
+
+#define SYNTH_AMP_UNIFORM       0        // [amp_a, amp_b]均匀
+#define SYNTH_AMP_EXP           1        // 均值amp_a的指数分布，限幅到[amp_b, 满量程]
+#define SYNTH_AMP_SMALL         2        // 绝对峰值420-540mV（相对幅度 = 峰值 - 基线）
+#define SYNTH_AMP_MIX           3        // 以amp_mix的概率取小雨滴带，否则取指数分布
+
+#define SYNTH_SMALL_MIN_MV      420.0f
+#define SYNTH_SMALL_MAX_MV      540.0f
+
+#define SYNTH_LABEL_DROP        0
+#define SYNTH_LABEL_EMI         1
+
+typedef struct
+{
+    float baseline_mv;                   // 基线电压
+    float drift_mv;                      // 基线慢漂移幅度
+    float drift_period_s;                // 漂移周期
+    float hum_mv;                        // 工频幅度
+    float hum_hz;                        // 工频频率
+    float emi_rate_hz;                   // 脉冲干扰平均速率（泊松）
+    float emi_mv;                        // 脉冲干扰幅度上限（随机正负，宽1~2个样本）
+    float noise_lsb;                     // ADC噪声标准差（LSB）
+    float drop_rate_hz;                  // 雨滴平均速率（泊松）
+    uint8_t amp_dist;                    // SYNTH_AMP_xxx
+    float amp_a;                         // 分布参数，见SYNTH_AMP_xxx
+    float amp_b;
+    float amp_mix;
+    float rise_us;                       // 上升时间常数τr
+    float decay_us;                      // 衰减时间常数τd
+    float shape_jitter;                  // τr/τd的随机抖动比例（0.2表示±20%）
+    float ring_ratio;                    // 振铃幅度/主脉冲幅度
+    float ring_hz;                       // 振铃频率
+    float ring_us;                       // 振铃衰减时间常数
+    uint32_t seed;
+} SynthConfig;
+
+typedef struct
+{
+    uint32_t tick;                       // 起点采样计数（从0起）
+    uint8_t kind;                        // SYNTH_LABEL_xxx
+    uint8_t overlap;                     // 1：上一个雨滴的脉冲尚未结束
+    float amplitude_mv;                  // 峰值相对基线（干扰为带符号幅度）
+    float rise_us;                       // 本滴τr
+    float decay_us;                      // 本滴τd
+    uint32_t peak_tick;                  // 主脉冲峰值所在采样计数（不含振铃与叠加）
+} SynthLabel;
+
+typedef void (*SynthLabelFn)(void *user, const SynthLabel *label);
+
+void Synth_Defaults(SynthConfig *cfg);
+void Synth_Init(const SynthConfig *cfg, SynthLabelFn on_label, void *user);
+void Synth_Generate(uint16_t *out, uint32_t count);
+double Synth_SampleRate(void);
+
+#endif
@@ -0,0 +1,290 @@
+/*
+ * 采样流回放工具：把录制（Tools/rain_capture.py的.u16）或合成的PA0采样按固件时序送入检测核心
+ *
+ * 用法：
+ *   rain_replay [-e events.csv] [-l labels.csv] [-t 容差] [-p 主循环微秒] [-m 最低倍速] a.u16 [b.u16 ...]
+ *     多个文件按顺序拼接为一段连续采样流
+ *     -e  每个快照的处理结果（CSV）
+ *     -l  标注文件：每行首列为雨滴起点的采样计数（从0起，相对拼接后的流），非数字行跳过
+ *     -t  标注匹配容差（采样数，默认120，约5ms）
+ *     -p  主循环周期（微秒，默认10000）
+ *     -m  回放速度低于实时的该倍数时返回2（吞吐回归门限）
+ *   汇总以key=value逐行输出到标准输出
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Replay.h"
+#include "Detector.h"
+#include "Threshold.h"
+#include "RainStats.h"
+
+#define READ_SAMPLES            8192     // 每次读文件的样本数
+#define DEFAULT_TOLERANCE       120      // 标注匹配容差（采样数）
+
+static const char *const reject_names[REJECT_COUNT] =
+{
+    "none", "range", "threshold", "margin", "amplitude", "samples", "narrow",
+    "width", "rise_time", "fall_time", "duration", "rise_continuity",
+    "fall_continuity", "rise_smoothness", "fall_smoothness", "stability"
+};
+
+static const char *const decision_names[] = { "count", "reject", "deadtime", "missed" };
+
+typedef struct
+{
+    ReplayEvent *items;
+    uint32_t count;
+    uint32_t capacity;
+    FILE *csv;
+} EventList;
+
+static void On_Event(void *user, const ReplayEvent *ev)
+{
+    EventList *list = (EventList *)user;
+
+    if (list->count == list->capacity)
+    {
+        uint32_t cap = list->capacity ? list->capacity * 2 : 1024;
+        ReplayEvent *p = (ReplayEvent *)realloc(list->items, cap * sizeof(ReplayEvent));
+
+        if (p == NULL)
+        {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+        list->items = p;
+        list->capacity = cap;
+    }
+    list->items[list->count++] = *ev;
+
+    if (list->csv != NULL)
+    {
+        fprintf(list->csv, "%lu,%.4f,%s,%s,%u,%ld,%u,%u,%u,%u,%lu\n",
+                (unsigned long)ev->trigger_tick,
+                (double)ev->trigger_tick * RAINSTATS_TICK_US / 1e6,
+                decision_names[ev->decision],
+                (ev->decision == REPLAY_DEADTIME) ? "" : reject_names[ev->reject],
+                ev->threshold, (long)ev->baseline, ev->peak_value, ev->amplitude, ev->width,
+                ev->volume_nl, (unsigned long)(ev->judged_tick - ev->trigger_tick));
+    }
+}
+
+static int Compare_U32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/* 读取标注：每行首列为采样计数，返回条数，失败返回-1 */
+static long Load_Labels(const char *path, uint32_t **out)
+{
+    FILE *f = fopen(path, "r");
+    char line[256];
+    uint32_t *labels = NULL;
+    uint32_t count = 0, capacity = 0;
+
+    if (f == NULL)
+        return -1;
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        char *end;
+        unsigned long tick;
+
+        if (line[0] < '0' || line[0] > '9')
+            continue;
+        tick = strtoul(line, &end, 10);
+        if (count == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 1024;
+            labels = (uint32_t *)realloc(labels, capacity * sizeof(uint32_t));
+            if (labels == NULL)
+            {
+                fclose(f);
+                return -1;
+            }
+        }
+        labels[count++] = (uint32_t)tick;
+    }
+    fclose(f);
+    qsort(labels, count, sizeof(uint32_t), Compare_U32);
+    *out = labels;
+    return (long)count;
+}
+
+/* 读取一个.u16文件（小端）送入回放，返回样本数，失败返回-1 */
+static long Replay_File(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    static uint8_t raw[READ_SAMPLES * 2];
+    static uint16_t samples[READ_SAMPLES];
+    long total = 0;
+    size_t n;
+
+    if (f == NULL)
+        return -1;
+    while ((n = fread(raw, 2, READ_SAMPLES, f)) > 0)
+    {
+        size_t i;
+
+        for (i = 0; i < n; i++)
+            samples[i] = (uint16_t)((raw[2 * i] | (raw[2 * i + 1] << 8)) & 0x0FFF);
+        Replay_Feed(samples, (uint32_t)n);
+        total += (long)n;
+    }
+    fclose(f);
+    return total;
+}
+
+static double Now_Seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void Usage(void)
+{
+    fprintf(stderr, "usage: rain_replay [-e events.csv] [-l labels.csv] [-t tolerance] "
+                    "[-p loop_us] [-m min_speed] samples.u16 [...]\n");
+}
+
+int main(int argc, char **argv)
+{
+    EventList list = { NULL, 0, 0, NULL };
+    const char *events_path = NULL, *labels_path = NULL;
+    uint32_t tolerance = DEFAULT_TOLERANCE, loop_us = REPLAY_LOOP_US;
+    double min_speed = 0.0;
+    const ReplayStats *st;
+    double t0, wall, duration, speed;
+    uint32_t counted = 0, rejected = 0, deadtime = 0;
+    uint32_t i;
+    int arg;
+
+    for (arg = 1; arg < argc && argv[arg][0] == '-'; arg++)
+    {
+        if (arg + 1 >= argc || argv[arg][2] != '\0')
+        {
+            Usage();
+            return 1;
+        }
+        switch (argv[arg][1])
+        {
+            case 'e': events_path = argv[++arg]; break;
+            case 'l': labels_path = argv[++arg]; break;
+            case 't': tolerance = (uint32_t)strtoul(argv[++arg], NULL, 10); break;
+            case 'p': loop_us = (uint32_t)strtoul(argv[++arg], NULL, 10); break;
+            case 'm': min_speed = strtod(argv[++arg], NULL); break;
+            default: Usage(); return 1;
+        }
+    }
+    if (arg >= argc)
+    {
+        Usage();
+        return 1;
+    }
+    if (events_path != NULL)
+    {
+        list.csv = fopen(events_path, "w");
+        if (list.csv == NULL)
+        {
+            perror(events_path);
+            return 1;
+        }
+        fprintf(list.csv, "trigger_tick,time_s,decision,reason,threshold,baseline,peak,amplitude,width,volume_nl,latency_ticks\n");
+    }
+
+    Replay_Init(loop_us, On_Event, &list);
+    t0 = Now_Seconds();
+    for (; arg < argc; arg++)
+    {
+        if (Replay_File(argv[arg]) < 0)
+        {
+            perror(argv[arg]);
+            return 1;
+        }
+    }
+    wall = Now_Seconds() - t0;
+    st = Replay_Stats();
+    duration = (double)st->samples * RAINSTATS_TICK_US / 1e6;
+    speed = (wall > 0.0) ? duration / wall : 0.0;
+
+    for (i = 0; i < list.count; i++)
+    {
+        if (list.items[i].decision == REPLAY_COUNTED)
+            counted++;
+        else if (list.items[i].decision == REPLAY_REJECTED)
+            rejected++;
+        else
+            deadtime++;
+    }
+
+    printf("samples=%llu\n", (unsigned long long)st->samples);
+    printf("duration_s=%.3f\n", duration);
+    printf("wall_s=%.3f\n", wall);
+    printf("speed_x=%.1f\n", speed);
+    printf("loops=%lu\n", (unsigned long)st->loops);
+    printf("awd_blocks=%lu\n", (unsigned long)st->awd_blocks);
+    printf("awd_busy_blocks=%lu\n", (unsigned long)st->awd_busy_blocks);
+    printf("diff_triggers=%lu\n", (unsigned long)diff_trigger_count);
+    printf("snapshots=%lu\n", (unsigned long)snapshot_capture_count);
+    printf("deadtime_drops=%lu\n", (unsigned long)deadtime);
+    printf("rejected=%lu\n", (unsigned long)rejected);
+    for (i = 1; i < REJECT_COUNT; i++)
+    {
+        if (reject_counts[i] != 0)
+            printf("reject.%s=%u\n", reject_names[i], reject_counts[i]);
+    }
+    printf("counted=%lu\n", (unsigned long)counted);
+    printf("isr_peaks=%lu\n", (unsigned long)st->isr_peaks);
+    printf("rain_um=%lu\n", (unsigned long)total_rain_um);
+    printf("intensity_60min_cmh=%u\n", RainStats_Intensity60Min());
+    printf("peak_intensity_1min_cmh=%u\n", RainStats_PeakIntensity(RAIN_LEVEL_DAY));
+    printf("threshold=%u\n", dynamic_threshold);
+    printf("threshold_min=%u\n", st->threshold_min);
+    printf("threshold_max=%u\n", st->threshold_max);
+    printf("threshold_updates=%lu\n", (unsigned long)st->threshold_updates);
+    printf("latency_ms_avg=%.2f\n", st->judged ?
+           (double)st->latency_sum_ticks / st->judged * RAINSTATS_TICK_US / 1000.0 : 0.0);
+    printf("latency_ms_max=%.2f\n", (double)st->latency_max_ticks * RAINSTATS_TICK_US / 1000.0);
+
+    if (labels_path != NULL)
+    {
+        uint32_t *labels = NULL;
+        long n = Load_Labels(labels_path, &labels);
+        ReplayMatch m;
+
+        if (n < 0)
+        {
+            perror(labels_path);
+            return 1;
+        }
+        Replay_Match(list.items, list.count, labels, (uint32_t)n, tolerance, &m, NULL);
+        printf("labels=%lu\n", (unsigned long)m.labels);
+        printf("label_counted=%lu\n", (unsigned long)m.counted);
+        printf("label_rejected=%lu\n", (unsigned long)m.rejected);
+        printf("label_deadtime=%lu\n", (unsigned long)m.deadtime);
+        printf("label_missed=%lu\n", (unsigned long)m.missed);
+        printf("false_counts=%lu\n", (unsigned long)m.false_counts);
+        printf("recall=%.4f\n", m.labels ? (double)m.counted / m.labels : 0.0);
+        printf("precision=%.4f\n", counted ? (double)(counted - m.false_counts) / counted : 0.0);
+        free(labels);
+    }
+
+    if (list.csv != NULL)
+        fclose(list.csv);
+    free(list.items);
+
+    if (min_speed > 0.0 && speed < min_speed)
+    {
+        fprintf(stderr, "speed %.1fx below %.1fx\n", speed, min_speed);
+        return 2;
+    }
+    return 0;
+}
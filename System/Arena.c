@@ -0,0 +1,5 @@
+#include "stm32f10x.h"
+#include "Arena.h"
+
+ArenaWork arena_work;
+ArenaLink arena_link;
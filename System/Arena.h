@@ -0,0 +1,47 @@
+#ifndef __ARENA_H
+#define __ARENA_H
+
+#include <stdint.h>
+#include "AD.h"
+#include "Export.h"
+#include "Capture.h"
+#include "UI.h"
+#include "Threshold.h"
+
+/*
+ * 静态内存规划（STM32F103C8：20KB SRAM，无堆）
+ *   所有大块缓冲均为静态分配，按生命周期分为三类：
+ *     常驻：中断持续读写，不能与其他缓冲共用
+ *       AD_Value             200B  ADC DMA双缓冲（AD.c）
+ *       adc_ring_packed_ch0 1020B  通道0环形缓冲，680个12位打包样本，预触发样本来源（Detector.c）
+ *       snapshot_buffer_high 1000B 快照：中断写入，主循环处理完才释放（Detector.c）
+ *       ram_records         4096B  事件日志RAM段（EventLog.c）
+ *       oled_fb             1024B  OLED帧缓冲（OLED.c）
+ *     主循环临时区 arena_work：只在一次同步调用内有效，调用之间不保留内容，
+ *       同一时刻只有一个使用者（各使用者互不嵌套调用）
+ *     链路独占区 arena_link：快照导出帧与原始捕获帧，二者互斥
+ *       （导出进行中不能开始捕获，捕获期间不接受导出）
+ *   调试用的Keil Array Visualization数组默认不编译（ADC_VISUALIZE，见AD.h）
+ *   链接后用Tools/ram_budget.py读取map文件输出RAM预算报告（工程已设为编译后自动运行）
+ */
+typedef union
+{
+    uint16_t smoothed[SNAPSHOT_SIZE];    // Validate_Snapshot：平滑后的快照
+    uint16_t window[SNAPSHOT_SIZE];      // Threshold_Update：从环形缓冲解包的噪声窗口
+    uint32_t trend_cmh[UI_TREND_MINUTES]; // UI_RenderTrend：每分钟雨强
+} ArenaWork;
+
+typedef union
+{
+    uint8_t export_frame[EXPORT_FRAME_BYTES];   // Export：导出帧（提交到发送完毕）
+    uint8_t capture_frame[CAPTURE_FRAME_BYTES]; // Capture：RAW帧（采样中断内组帧）
+} ArenaLink;
+
+#if NOISE_WINDOW > SNAPSHOT_SIZE
+#error "噪声窗口超出主循环临时区"
+#endif
+
+extern ArenaWork arena_work;
+extern ArenaLink arena_link;
+
+#endif
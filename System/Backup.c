@@ -0,0 +1,147 @@
+#include "stm32f10x.h"
+#include "Backup.h"
+
+/* 热启动记录：DR1=标记 DR2=基线 DR3=阈值 DR4=噪声MAD DR5=校验 */
+#define WARM_REG_MAGIC      BKP_DR1
+#define WARM_REG_BASELINE   BKP_DR2
+#define WARM_REG_THRESHOLD  BKP_DR3
+#define WARM_REG_NOISE      BKP_DR4
+#define WARM_REG_CHECK      BKP_DR5
+
+/* 日志增量影子：DR6=滴数增量 DR7=雨量增量 DR8=tag<<12|电压增量 */
+#define SHADOW_REG_DROPS    BKP_DR6
+#define SHADOW_REG_RAIN     BKP_DR7
+#define SHADOW_REG_TAG_VOLT BKP_DR8
+
+/* RTC时钟配置：DR9=标记<<8|标志 DR10=日界<<8|时区 */
+#define CLOCK_REG_FLAGS     BKP_DR9
+#define CLOCK_REG_ZONE      BKP_DR10
+
+static uint16_t Warm_Check(uint16_t baseline, uint16_t threshold, uint16_t noise_mad)
+{
+    /* 简单校验：防止写入过程中掉电导致的半条记录被当作有效状态 */
+    return (uint16_t)~(BACKUP_WARM_MAGIC ^ baseline ^ (uint16_t)(threshold << 3) ^ (uint16_t)(noise_mad << 7));
+}
+
+/**
+  * @brief  使能BKP域访问
+  * @param  无
+  * @retval 无
+  * @note   需在读写任何BKP寄存器之前调用
+  */
+void Backup_Init(void)
+{
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_PWR | RCC_APB1Periph_BKP, ENABLE);
+    PWR_BackupAccessCmd(ENABLE);
+}
+
+/**
+  * @brief  读取热启动状态
+  * @param  state 输出：上一次保存的基线/阈值/噪声
+  * @retval 1：记录有效，0：无记录或校验失败（冷启动）
+  */
+uint8_t Backup_LoadWarmState(WarmState *state)
+{
+    uint16_t baseline, threshold, noise_mad;
+
+    if (BKP_ReadBackupRegister(WARM_REG_MAGIC) != BACKUP_WARM_MAGIC)
+    {
+        return 0;
+    }
+
+    baseline = BKP_ReadBackupRegister(WARM_REG_BASELINE);
+    threshold = BKP_ReadBackupRegister(WARM_REG_THRESHOLD);
+    noise_mad = BKP_ReadBackupRegister(WARM_REG_NOISE);
+    if (BKP_ReadBackupRegister(WARM_REG_CHECK) != Warm_Check(baseline, threshold, noise_mad))
+    {
+        return 0;
+    }
+
+    state->baseline = baseline;
+    state->threshold = threshold;
+    state->noise_mad = noise_mad;
+    return 1;
+}
+
+/**
+  * @brief  保存热启动状态
+  * @param  state 当前基线/阈值/噪声
+  * @retval 无
+  * @note   先清标记再写数据、最后写标记，任何时刻掉电都不会留下“有效但不完整”的记录
+  */
+void Backup_SaveWarmState(const WarmState *state)
+{
+    BKP_WriteBackupRegister(WARM_REG_MAGIC, 0);
+    BKP_WriteBackupRegister(WARM_REG_BASELINE, state->baseline);
+    BKP_WriteBackupRegister(WARM_REG_THRESHOLD, state->threshold);
+    BKP_WriteBackupRegister(WARM_REG_NOISE, state->noise_mad);
+    BKP_WriteBackupRegister(WARM_REG_CHECK, Warm_Check(state->baseline, state->threshold, state->noise_mad));
+    BKP_WriteBackupRegister(WARM_REG_MAGIC, BACKUP_WARM_MAGIC);
+}
+
+/**
+  * @brief  作废热启动记录（下次上电走冷启动）
+  */
+void Backup_ClearWarmState(void)
+{
+    BKP_WriteBackupRegister(WARM_REG_MAGIC, 0);
+}
+
+/**
+  * @brief  读取日志增量影子
+  * @param  shadow 输出：增量与所属记录标签
+  * @note   BKP域复位后全为0：增量为0，叠加后不影响结果
+  */
+void Backup_LoadJournalShadow(JournalShadow *shadow)
+{
+    uint16_t tag_volt = BKP_ReadBackupRegister(SHADOW_REG_TAG_VOLT);
+
+    shadow->drops = BKP_ReadBackupRegister(SHADOW_REG_DROPS);
+    shadow->rain_um = BKP_ReadBackupRegister(SHADOW_REG_RAIN);
+    shadow->voltage_dv = tag_volt & BACKUP_SHADOW_VOLT_MAX;
+    shadow->tag = (uint8_t)(tag_volt >> 12);
+}
+
+/**
+  * @brief  保存日志增量影子
+  * @param  shadow 当前增量与所属记录标签
+  * @note   每个寄存器单独写入；中途掉电最多丢失最后一滴的部分增量
+  */
+void Backup_SaveJournalShadow(const JournalShadow *shadow)
+{
+    BKP_WriteBackupRegister(SHADOW_REG_DROPS, shadow->drops);
+    BKP_WriteBackupRegister(SHADOW_REG_RAIN, shadow->rain_um);
+    BKP_WriteBackupRegister(SHADOW_REG_TAG_VOLT,
+        (uint16_t)(((uint16_t)(shadow->tag & 0x0F) << 12) | (shadow->voltage_dv & BACKUP_SHADOW_VOLT_MAX)));
+}
+
+/**
+  * @brief  读取RTC时钟配置
+  * @param  config 输出：标志/时区/日界
+  * @retval 1：配置有效（RTC已在运行），0：备份域已复位
+  */
+uint8_t Backup_LoadClockConfig(ClockConfig *config)
+{
+    uint16_t flags = BKP_ReadBackupRegister(CLOCK_REG_FLAGS);
+    uint16_t zone = BKP_ReadBackupRegister(CLOCK_REG_ZONE);
+
+    if ((flags >> 8) != BACKUP_CLOCK_MAGIC)
+    {
+        return 0;
+    }
+    config->flags = (uint8_t)flags;
+    config->tz_quarters = (int8_t)(zone & 0xFF);
+    config->day_start_hour = (uint8_t)(zone >> 8);
+    return 1;
+}
+
+/**
+  * @brief  保存RTC时钟配置
+  * @param  config 标志/时区/日界
+  */
+void Backup_SaveClockConfig(const ClockConfig *config)
+{
+    BKP_WriteBackupRegister(CLOCK_REG_ZONE,
+        (uint16_t)(((uint16_t)config->day_start_hour << 8) | (uint8_t)config->tz_quarters));
+    BKP_WriteBackupRegister(CLOCK_REG_FLAGS, (uint16_t)((BACKUP_CLOCK_MAGIC << 8) | config->flags));
+}
@@ -0,0 +1,48 @@
+#ifndef __BACKUP_H
+#define __BACKUP_H
+
+#include <stdint.h>
+
+/* BKP数据寄存器分配（F103C8共DR1~DR10，每个16位，VDD或VBAT在即可保持） */
+/* DR1~DR5：热启动状态（基线/阈值/噪声） */
+/* DR6~DR8：累计量日志增量影子（见Journal.h），DR9~DR10：RTC时钟配置（见Clock.h） */
+#define BACKUP_WARM_MAGIC       0x5244   // 'RD'：热启动记录有效标记
+
+typedef struct
+{
+    uint16_t baseline;                   // 峰值检测基线（ADC单位）
+    uint16_t threshold;                  // 动态阈值（ADC单位）
+    uint16_t noise_mad;                  // 噪声平均绝对偏差（ADC单位）
+} WarmState;
+
+/* 日志增量影子：相对最新一条Flash日志记录的增量，tag为该记录序号低4位 */
+#define BACKUP_SHADOW_VOLT_MAX  0x0FFFu  // 电压增量12位（0.1V）
+
+typedef struct
+{
+    uint16_t drops;                      // 滴数增量
+    uint16_t rain_um;                    // 雨量增量（微米）
+    uint16_t voltage_dv;                 // 累计电压增量（0.1V，12位）
+    uint8_t tag;                         // 所属日志记录序号低4位
+} JournalShadow;
+
+/* RTC时钟配置：与RTC同在备份域，备份域复位时一并失效 */
+#define BACKUP_CLOCK_MAGIC      0xC7     // DR9高字节
+
+typedef struct
+{
+    uint8_t flags;                       // CLOCK_FLAG_xxx
+    int8_t tz_quarters;                  // 时区偏移（15分钟为单位，东正西负）
+    uint8_t day_start_hour;              // 日界（本地时，0~23）
+} ClockConfig;
+
+void Backup_Init(void);
+uint8_t Backup_LoadWarmState(WarmState *state);
+void Backup_SaveWarmState(const WarmState *state);
+void Backup_ClearWarmState(void);
+void Backup_LoadJournalShadow(JournalShadow *shadow);
+void Backup_SaveJournalShadow(const JournalShadow *shadow);
+uint8_t Backup_LoadClockConfig(ClockConfig *config);
+void Backup_SaveClockConfig(const ClockConfig *config);
+
+#endif
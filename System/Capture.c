@@ -0,0 +1,92 @@
+#include "stm32f10x.h"
+#include "Capture.h"
+#include "Serial.h"
+#include "Telemetry.h"
+#include "Export.h"
+#include "Arena.h"
+#include "Pack12.h"
+
+volatile uint8_t capture_active = 0;
+volatile uint32_t capture_sent_blocks = 0;
+volatile uint32_t capture_lost_blocks = 0;
+
+static uint16_t capture_seq = 0;         // RAW帧独立序号
+static uint16_t capture_pending_lost = 0; // 上一个成功入队的块之后丢失的块数
+
+/**
+  * @brief  开始捕获
+  * @param  baudrate 捕获期间的波特率
+  * @retval 1：已开始（或已在捕获），0：快照导出未完成（组帧缓冲被导出帧占用）
+  * @note   主循环调用；先排空发送缓冲再切换波特率，之后由采样中断直接组帧
+  */
+uint8_t Capture_Start(uint32_t baudrate)
+{
+    if (capture_active)
+        return 1;
+    if (Export_IsBusy())
+        return 0;
+
+    Serial_SetBaud(baudrate);
+    capture_seq = 0;
+    capture_pending_lost = 0;
+    capture_sent_blocks = 0;
+    capture_lost_blocks = 0;
+    capture_active = 1;
+    return 1;
+}
+
+/**
+  * @brief  停止捕获并恢复默认波特率
+  */
+void Capture_Stop(void)
+{
+    if (!capture_active)
+        return;
+
+    capture_active = 0;
+    Serial_SetBaud(SERIAL_BAUDRATE);
+}
+
+/**
+  * @brief  打包并发送一个半缓冲的样本（DMA半传输/传输完成中断中调用）
+  * @param  samples    DMA半缓冲起始地址（CAPTURE_BLOCK_SAMPLES个样本）
+  * @param  first_tick 首样本采样序号
+  * @note   捕获期间是SERIAL_PRIO_LIVE的唯一生产者
+  */
+void Capture_Block(volatile uint16_t *samples, uint32_t first_tick)
+{
+    uint8_t *frame = arena_link.capture_frame;
+    uint8_t *p = frame;
+    uint32_t crc;
+
+    if (!capture_active)
+        return;
+
+    if (Serial_Free(SERIAL_PRIO_LIVE) < CAPTURE_FRAME_BYTES)
+    {
+        capture_lost_blocks++;
+        if (capture_pending_lost < 0xFFFF)
+            capture_pending_lost++;
+        capture_seq++;
+        return;
+    }
+
+    *p++ = TELEMETRY_SYNC0;
+    *p++ = TELEMETRY_SYNC1;
+    *p++ = TELEMETRY_VERSION;
+    *p++ = TLM_TYPE_RAW;
+    p = Telemetry_PutU16(p, CAPTURE_PAYLOAD_BYTES);
+    p = Telemetry_PutU16(p, capture_seq);
+    p = Telemetry_PutU32(p, first_tick);
+    p = Telemetry_PutU16(p, capture_pending_lost);
+    p = Telemetry_PutU8(p, CAPTURE_BLOCK_SAMPLES);
+    Pack12_Pack(p, 0, (const uint16_t *)samples, CAPTURE_BLOCK_SAMPLES);
+    p += CAPTURE_PACKED_BYTES;
+    crc = Telemetry_SoftCrc(frame, (uint16_t)(p - frame));
+    p = Telemetry_PutU32(p, crc);
+
+    Serial_Write(SERIAL_PRIO_LIVE, frame, (uint16_t)(p - frame));
+    capture_seq++;
+    capture_pending_lost = 0;
+    capture_sent_blocks++;
+}
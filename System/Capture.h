@@ -0,0 +1,34 @@
+#ifndef __CAPTURE_H
+#define __CAPTURE_H
+
+#include <stdint.h>
+#include "Telemetry.h"
+
+/*
+ * 全速原始采样捕获（用于录制离线调参数据集）
+ *   每个DMA半缓冲（50个样本）在采样中断中直接打包为一个TLM_TYPE_RAW遥测帧：
+ *     负载：首样本采样序号(u32) + 本帧之前丢失的块数(u16) + 样本数(u8) + 12位打包样本
+ *     打包：每2个样本3字节，b0=a[7:0]，b1=a[11:8]|b[3:0]<<4，b2=b[11:4]
+ *   帧头序号使用独立计数（每块加1，丢弃的块同样占用序号），CRC用软件计算
+ *   链路跟不上时整块丢弃并在下一帧显式报告丢失块数，不会静默跳过
+ *   捕获期间示波流与快照导出暂停，USART1切换到CAPTURE_BAUDRATE；组帧缓冲与导出帧共用，
+ *   快照导出未发送完时不能开始捕获
+ */
+#define CAPTURE_BLOCK_SAMPLES   50                          // 与DMA半缓冲一致
+#define CAPTURE_PACKED_BYTES    (CAPTURE_BLOCK_SAMPLES * 3 / 2)
+#define CAPTURE_PAYLOAD_BYTES   (4 + 2 + 1 + CAPTURE_PACKED_BYTES)
+#define CAPTURE_FRAME_BYTES     (TELEMETRY_HEADER_SIZE + CAPTURE_PAYLOAD_BYTES + TELEMETRY_CRC_SIZE)
+
+#ifndef CAPTURE_BAUDRATE
+#define CAPTURE_BAUDRATE        1000000  // 23.8kS/s*12bit约需450kbaud，1M留足余量
+#endif
+
+extern volatile uint8_t capture_active;
+extern volatile uint32_t capture_sent_blocks;   // 已入队的块数
+extern volatile uint32_t capture_lost_blocks;   // 因发送缓冲满丢弃的块数
+
+uint8_t Capture_Start(uint32_t baudrate);
+void Capture_Stop(void);
+void Capture_Block(volatile uint16_t *samples, uint32_t first_tick);
+
+#endif
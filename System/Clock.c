@@ -0,0 +1,313 @@
+#include "stm32f10x.h"
+#include "Clock.h"
+#include "Backup.h"
+#include "AD.h"
+
+#define LSE_TIMEOUT_TICKS   (CLOCK_LSE_TIMEOUT_MS * 1000u / CLOCK_TICK_US)
+#define LSI_DIVIDER_MIN     30000u       // LSI数据手册范围30~60kHz
+#define LSI_DIVIDER_MAX     60000u
+
+static ClockConfig config;
+static uint8_t clock_source = CLOCK_SRC_NONE;
+static uint32_t lse_start_tick = 0;      // 开始等待LSE起振时的采样计数
+
+/* RTC运行前收到的设置：运行后按经过的采样计数补偿写入 */
+static uint8_t pending_set = 0;
+static uint32_t pending_unix = 0;
+static uint32_t pending_tick = 0;
+
+/* 秒中断锚点：RTC计数刚跳变时的（秒, 采样计数） */
+static volatile uint32_t anchor_unix = 0;
+static volatile uint32_t anchor_tick = 0;
+static volatile uint8_t anchor_valid = 0;
+
+/* LSI校准：当前分频值与校准起点 */
+static uint32_t lsi_divider = CLOCK_LSI_HZ;
+static uint8_t cal_started = 0;
+static uint32_t cal_unix = 0;
+static uint32_t cal_tick = 0;
+
+static void Rtc_EnableSecondIrq(void)
+{
+    NVIC_InitTypeDef nvic;
+
+    RTC_ClearITPendingBit(RTC_IT_SEC);
+    RTC_WaitForLastTask();
+    RTC_ITConfig(RTC_IT_SEC, ENABLE);
+    RTC_WaitForLastTask();
+
+    nvic.NVIC_IRQChannel = RTC_IRQn;
+    nvic.NVIC_IRQChannelPreemptionPriority = 3;
+    nvic.NVIC_IRQChannelSubPriority = 1;
+    nvic.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&nvic);
+}
+
+static void Lsi_Start(void)
+{
+    RCC_LSICmd(ENABLE);                  // LSI不在备份域，每次复位后都需重新开启
+    while (RCC_GetFlagStatus(RCC_FLAG_LSIRDY) == RESET)
+    {
+    }
+}
+
+/**
+  * @brief  首次配置RTC（备份域复位后）
+  * @param  source CLOCK_SRC_LSE / CLOCK_SRC_LSI
+  * @note   RTCSEL在备份域复位前只能写一次；不调用BKP_DeInit，以免清掉DR1~DR8
+  */
+static void Rtc_Configure(uint8_t source)
+{
+    if (source == CLOCK_SRC_LSE)
+    {
+        RCC_RTCCLKConfig(RCC_RTCCLKSource_LSE);
+        config.flags |= CLOCK_FLAG_LSE;
+    }
+    else
+    {
+        RCC_LSEConfig(RCC_LSE_OFF);
+        Lsi_Start();
+        RCC_RTCCLKConfig(RCC_RTCCLKSource_LSI);
+        config.flags &= (uint8_t)~CLOCK_FLAG_LSE;
+    }
+    RCC_RTCCLKCmd(ENABLE);
+    RTC_WaitForSynchro();
+    RTC_WaitForLastTask();
+    RTC_SetPrescaler(source == CLOCK_SRC_LSE ? 32767u : lsi_divider - 1u);
+    RTC_WaitForLastTask();
+
+    if (pending_set)
+    {
+        RTC_SetCounter(pending_unix +
+            (uint32_t)((uint64_t)(sampling_tick_counter - pending_tick) * CLOCK_TICK_US / 1000000u));
+        RTC_WaitForLastTask();
+        config.flags |= CLOCK_FLAG_SET;
+        pending_set = 0;
+    }
+    Backup_SaveClockConfig(&config);
+    clock_source = source;
+    Rtc_EnableSecondIrq();
+}
+
+/**
+  * @brief  按采样计数校准LSI分频（每CLOCK_CAL_SECONDS个RTC秒）
+  * @note   采样计数来自HSE派生的ADC时钟，比LSI（±25%）准确得多；
+  *         锚点分辨率为一个DMA半缓冲（50点，2.1ms），64秒周期对应约30ppm
+  */
+static void Lsi_Calibrate(void)
+{
+    uint32_t unix_now, tick_now, seconds, ticks, divider;
+
+    if (!anchor_valid)
+        return;
+    __disable_irq();
+    unix_now = anchor_unix;
+    tick_now = anchor_tick;
+    __enable_irq();
+
+    if (!cal_started)
+    {
+        cal_unix = unix_now;
+        cal_tick = tick_now;
+        cal_started = 1;
+        return;
+    }
+    seconds = unix_now - cal_unix;
+    if (seconds < CLOCK_CAL_SECONDS)
+        return;
+
+    ticks = tick_now - cal_tick;
+    divider = (uint32_t)(((uint64_t)lsi_divider * seconds * (1000000u / 2u) / (CLOCK_TICK_US / 2u) + ticks / 2u) / ticks);
+    if (divider >= LSI_DIVIDER_MIN && divider <= LSI_DIVIDER_MAX)
+    {
+        lsi_divider = divider;
+        RTC_WaitForLastTask();
+        RTC_SetPrescaler(lsi_divider - 1u);
+        RTC_WaitForLastTask();
+    }
+    cal_unix = unix_now;
+    cal_tick = tick_now;
+}
+
+/**
+  * @brief  时钟初始化
+  * @param  无
+  * @retval 无
+  * @note   需在Backup_Init与AD_Init之后调用；RTC已在运行时直接沿用，
+  *         否则开启LSE后立即返回，由Clock_Task等待起振（不阻塞采样与主循环）
+  */
+void Clock_Init(void)
+{
+    if (Backup_LoadClockConfig(&config) && (RCC->BDCR & RCC_BDCR_RTCEN))
+    {
+        if (config.flags & CLOCK_FLAG_LSE)
+        {
+            clock_source = CLOCK_SRC_LSE;
+        }
+        else
+        {
+            Lsi_Start();
+            clock_source = CLOCK_SRC_LSI;
+        }
+        RTC_WaitForSynchro();
+        if (clock_source == CLOCK_SRC_LSI)
+        {
+            RTC_WaitForLastTask();
+            RTC_SetPrescaler(lsi_divider - 1u);  // PRL只写，从标称值重新校准
+            RTC_WaitForLastTask();
+        }
+        Rtc_EnableSecondIrq();
+        return;
+    }
+
+    config.flags = 0;
+    config.tz_quarters = (int8_t)(CLOCK_DEFAULT_TZ_MINUTES / 15);
+    config.day_start_hour = CLOCK_DEFAULT_DAY_START;
+    RCC_LSEConfig(RCC_LSE_ON);
+    lse_start_tick = sampling_tick_counter;
+}
+
+/**
+  * @brief  时钟维护（每次主循环调用一次）
+  * @note   等待LSE起振（超时改用LSI）；LSI运行时周期校准分频
+  */
+void Clock_Task(void)
+{
+    if (clock_source == CLOCK_SRC_NONE)
+    {
+        if (RCC_GetFlagStatus(RCC_FLAG_LSERDY) == SET)
+        {
+            Rtc_Configure(CLOCK_SRC_LSE);
+        }
+        else if (sampling_tick_counter - lse_start_tick >= LSE_TIMEOUT_TICKS)
+        {
+            Rtc_Configure(CLOCK_SRC_LSI);
+        }
+        return;
+    }
+    if (clock_source == CLOCK_SRC_LSI)
+    {
+        Lsi_Calibrate();
+    }
+}
+
+/**
+  * @brief  RTC秒中断：记录秒与采样计数的对应关系
+  * @note   在RTC_IRQHandler中调用
+  */
+void Clock_Second_IRQ(void)
+{
+    if (RTC_GetITStatus(RTC_IT_SEC) != RESET)
+    {
+        anchor_tick = sampling_tick_counter;
+        anchor_unix = RTC_GetCounter();
+        anchor_valid = 1;
+        RTC_ClearITPendingBit(RTC_IT_SEC);
+        RTC_WaitForLastTask();
+    }
+}
+
+/**
+  * @brief  设置当前时间
+  * @param  unix_seconds Unix秒（UTC）
+  * @note   RTC尚未运行时暂存，运行后补偿等待时间再写入
+  */
+void Clock_Set(uint32_t unix_seconds)
+{
+    if (clock_source == CLOCK_SRC_NONE)
+    {
+        pending_unix = unix_seconds;
+        pending_tick = sampling_tick_counter;
+        pending_set = 1;
+        return;
+    }
+    RTC_WaitForLastTask();
+    RTC_SetCounter(unix_seconds);
+    RTC_WaitForLastTask();
+    anchor_valid = 0;                    // 旧锚点作废，等下一个秒中断
+    cal_started = 0;
+    config.flags |= CLOCK_FLAG_SET;
+    Backup_SaveClockConfig(&config);
+}
+
+uint32_t Clock_Now(void)
+{
+    return Clock_IsSet() ? RTC_GetCounter() : 0;
+}
+
+uint8_t Clock_IsSet(void)
+{
+    return (clock_source != CLOCK_SRC_NONE && (config.flags & CLOCK_FLAG_SET)) ? 1 : 0;
+}
+
+uint8_t Clock_Source(void)
+{
+    return clock_source;
+}
+
+/**
+  * @brief  采样计数换算为Unix时间
+  * @param  tick 采样计数（sampling_tick_counter的某次取值）
+  * @param  ms   输出：秒内毫秒（可为0）
+  * @retval Unix秒；时钟未设置或尚无锚点时返回0
+  * @note   以最近一次秒中断锚点为基准线性外推，锚点每秒刷新，外推误差不累积
+  */
+uint32_t Clock_TickToUnix(uint32_t tick, uint16_t *ms)
+{
+    uint32_t base_unix, base_tick;
+    int32_t offset_ms, seconds, rem;
+
+    if (ms != 0)
+        *ms = 0;
+    if (!Clock_IsSet() || !anchor_valid)
+        return 0;
+
+    __disable_irq();
+    base_unix = anchor_unix;
+    base_tick = anchor_tick;
+    __enable_irq();
+
+    offset_ms = (int32_t)(tick - base_tick) * (int32_t)CLOCK_TICK_US / 1000;
+    seconds = offset_ms / 1000;
+    rem = offset_ms % 1000;
+    if (rem < 0)
+    {
+        rem += 1000;
+        seconds--;
+    }
+    if (ms != 0)
+        *ms = (uint16_t)rem;
+    return base_unix + (uint32_t)seconds;
+}
+
+int16_t Clock_TzMinutes(void)
+{
+    return (int16_t)(config.tz_quarters * 15);
+}
+
+/**
+  * @brief  设置时区
+  * @param  minutes 东正西负，须为15分钟整数倍，-720~+840
+  * @retval 1：成功，0：超出范围
+  */
+uint8_t Clock_SetTzMinutes(int16_t minutes)
+{
+    if (minutes % 15 != 0 || minutes < -720 || minutes > 840)
+        return 0;
+    config.tz_quarters = (int8_t)(minutes / 15);
+    if (clock_source != CLOCK_SRC_NONE)
+        Backup_SaveClockConfig(&config);
+    return 1;
+}
+
+uint8_t Clock_DayStartHour(void)
+{
+    return config.day_start_hour;
+}
+
+void Clock_SetDayStartHour(uint8_t hour)
+{
+    config.day_start_hour = (uint8_t)(hour % 24);
+    if (clock_source != CLOCK_SRC_NONE)
+        Backup_SaveClockConfig(&config);
+}
@@ -0,0 +1,43 @@
+#ifndef __CLOCK_H
+#define __CLOCK_H
+
+#include <stdint.h>
+
+/*
+ * 墙上时钟（Unix秒，RTC计数器直接计UTC秒）
+ *   时钟源：优先LSE（32.768kHz晶振），起振超时则改用LSI（约40kHz，按采样计数周期校准分频）
+ *   RTC与配置（BKP DR9~DR10）同在备份域，有VBAT时复位/掉电后继续走时
+ *   经命令"time <unix> [tz分钟]"设置；未设置时Clock_Now返回0
+ *   与采样计数关联：RTC秒中断记录（秒, 采样计数）锚点，任意采样计数可换算为Unix时间
+ */
+#define CLOCK_SRC_NONE          0        // 尚未运行（LSE起振中）
+#define CLOCK_SRC_LSE           1
+#define CLOCK_SRC_LSI           2
+
+#define CLOCK_FLAG_SET          0x01     // 已由主机设置时间
+#define CLOCK_FLAG_LSE          0x02     // RTC时钟源为LSE
+
+#define CLOCK_LSE_TIMEOUT_MS    2000     // LSE起振等待（超时改用LSI）
+#define CLOCK_LSI_HZ            40000u   // LSI标称频率
+#define CLOCK_CAL_SECONDS       64       // LSI校准周期（RTC秒）
+#define CLOCK_TICK_US           42u      // 每个采样计数的微秒数（与ADC_SAMPLE_INTERVAL_US一致）
+
+#define CLOCK_DEFAULT_TZ_MINUTES 480     // 默认东八区
+#define CLOCK_DEFAULT_DAY_START  20      // 默认日界20时（气象日：前日20时至当日20时）
+
+void Clock_Init(void);
+void Clock_Task(void);
+void Clock_Second_IRQ(void);
+
+void Clock_Set(uint32_t unix_seconds);
+uint32_t Clock_Now(void);
+uint8_t Clock_IsSet(void);
+uint8_t Clock_Source(void);
+uint32_t Clock_TickToUnix(uint32_t tick, uint16_t *ms);
+
+int16_t Clock_TzMinutes(void);
+uint8_t Clock_SetTzMinutes(int16_t minutes);
+uint8_t Clock_DayStartHour(void);
+void Clock_SetDayStartHour(uint8_t hour);
+
+#endif
@@ -0,0 +1,213 @@
+#include "Codec.h"
+
+typedef struct
+{
+    uint8_t *out;
+    uint16_t pos;                        // 已输出字节数
+    uint32_t acc;                        // 位累加器
+    uint8_t bits;                        // 累加器内有效位数
+} BitWriter;
+
+typedef struct
+{
+    const uint8_t *in;
+    uint16_t len;
+    uint16_t pos;
+    uint32_t acc;
+    uint8_t bits;
+    uint8_t overrun;                     // 1：读越界（数据损坏）
+} BitReader;
+
+static void Bits_Put(BitWriter *w, uint32_t value, uint8_t count)
+{
+    /* count不超过16，累加器最多残留7位，不会溢出32位 */
+    w->acc = (w->acc << count) | (value & ((1u << count) - 1u));
+    w->bits += count;
+    while (w->bits >= 8)
+    {
+        w->bits -= 8;
+        w->out[w->pos++] = (uint8_t)(w->acc >> w->bits);
+    }
+}
+
+static void Bits_Flush(BitWriter *w)
+{
+    if (w->bits > 0)
+    {
+        w->out[w->pos++] = (uint8_t)(w->acc << (8 - w->bits));
+        w->bits = 0;
+    }
+}
+
+static uint32_t Bits_Get(BitReader *r, uint8_t count)
+{
+    while (r->bits < count)
+    {
+        uint8_t b = 0;
+        if (r->pos < r->len)
+            b = r->in[r->pos++];
+        else
+            r->overrun = 1;
+        r->acc = (r->acc << 8) | b;
+        r->bits += 8;
+    }
+    r->bits -= count;
+    return (r->acc >> r->bits) & ((1u << count) - 1u);
+}
+
+static uint32_t Zigzag(int32_t r)
+{
+    return (r >= 0) ? ((uint32_t)r << 1) : (((uint32_t)(-r) << 1) - 1u);
+}
+
+static int32_t Unzigzag(uint32_t z)
+{
+    return (z & 1u) ? -(int32_t)((z + 1u) >> 1) : (int32_t)(z >> 1);
+}
+
+static int32_t Predict(const uint16_t *x, uint16_t i, uint8_t mode)
+{
+    if (mode == CODEC_MODE_LPC2 && i >= 2)
+        return 2 * (int32_t)x[i - 1] - (int32_t)x[i - 2];
+    return x[i - 1];
+}
+
+static uint32_t Rice_Bits(uint32_t z, uint8_t k)
+{
+    uint32_t q = z >> k;
+    return (q < CODEC_RICE_ESCAPE) ? (q + 1u + k) : (CODEC_RICE_ESCAPE + CODEC_ESCAPE_BITS);
+}
+
+/**
+  * @brief  压缩一块12位样本
+  * @param  samples 输入样本（0~4095）
+  * @param  n       样本数（>=1）
+  * @param  out     输出缓冲，至少CODEC_BLOCK_BOUND(n)字节
+  * @retval 输出字节数
+  */
+uint16_t Codec_EncodeBlock(const uint16_t *samples, uint16_t n, uint8_t *out)
+{
+    BitWriter w;
+    uint32_t sum1 = 0, sum2 = 0, sum, bits;
+    uint32_t raw_bits = 12u * n;
+    uint8_t mode, k;
+    uint16_t i;
+
+    w.out = out;
+    w.pos = 0;
+    w.acc = 0;
+    w.bits = 0;
+
+    /* 第1遍：两种预测器的残差和，选残差小的预测器并按均值选k */
+    for (i = 1; i < n; i++)
+    {
+        sum1 += Zigzag((int32_t)samples[i] - Predict(samples, i, CODEC_MODE_DELTA));
+        sum2 += Zigzag((int32_t)samples[i] - Predict(samples, i, CODEC_MODE_LPC2));
+    }
+    mode = (sum2 < sum1) ? CODEC_MODE_LPC2 : CODEC_MODE_DELTA;
+    sum = (mode == CODEC_MODE_LPC2) ? sum2 : sum1;
+    k = 0;
+    while (k < 13 && ((uint32_t)(n - 1) << (k + 1)) <= sum)
+    {
+        k++;
+    }
+
+    /* 第2遍：精确位数，超过原始打包则回退 */
+    bits = 4 + 12;
+    for (i = 1; i < n && bits < raw_bits; i++)
+    {
+        bits += Rice_Bits(Zigzag((int32_t)samples[i] - Predict(samples, i, mode)), k);
+    }
+    if (n < 2 || bits >= raw_bits)
+    {
+        mode = CODEC_MODE_RAW;
+    }
+
+    /* 第3遍：输出 */
+    Bits_Put(&w, mode, 2);
+    if (mode == CODEC_MODE_RAW)
+    {
+        for (i = 0; i < n; i++)
+        {
+            Bits_Put(&w, samples[i] & 0x0FFFu, 12);
+        }
+    }
+    else
+    {
+        Bits_Put(&w, k, 4);
+        Bits_Put(&w, samples[0] & 0x0FFFu, 12);
+        for (i = 1; i < n; i++)
+        {
+            uint32_t z = Zigzag((int32_t)samples[i] - Predict(samples, i, mode));
+            uint32_t q = z >> k;
+            if (q < CODEC_RICE_ESCAPE)
+            {
+                Bits_Put(&w, ((1u << q) - 1u) << 1, (uint8_t)(q + 1));   // q个1加一个0
+                if (k > 0)
+                    Bits_Put(&w, z, k);
+            }
+            else
+            {
+                Bits_Put(&w, (1u << CODEC_RICE_ESCAPE) - 1u, CODEC_RICE_ESCAPE);
+                Bits_Put(&w, z, CODEC_ESCAPE_BITS);
+            }
+        }
+    }
+    Bits_Flush(&w);
+    return w.pos;
+}
+
+/**
+  * @brief  解压一块
+  * @param  in      压缩数据
+  * @param  in_len  可用字节数
+  * @param  samples 输出样本
+  * @param  n       样本数（与编码时一致）
+  * @retval 消耗的字节数，数据损坏时返回0
+  */
+uint16_t Codec_DecodeBlock(const uint8_t *in, uint16_t in_len, uint16_t *samples, uint16_t n)
+{
+    BitReader r;
+    uint8_t mode, k;
+    uint16_t i;
+
+    r.in = in;
+    r.len = in_len;
+    r.pos = 0;
+    r.acc = 0;
+    r.bits = 0;
+    r.overrun = 0;
+
+    mode = (uint8_t)Bits_Get(&r, 2);
+    if (mode == CODEC_MODE_RAW)
+    {
+        for (i = 0; i < n; i++)
+        {
+            samples[i] = (uint16_t)Bits_Get(&r, 12);
+        }
+    }
+    else if (mode == CODEC_MODE_DELTA || mode == CODEC_MODE_LPC2)
+    {
+        k = (uint8_t)Bits_Get(&r, 4);
+        samples[0] = (uint16_t)Bits_Get(&r, 12);
+        for (i = 1; i < n && !r.overrun; i++)
+        {
+            uint32_t q = 0, z;
+            while (q < CODEC_RICE_ESCAPE && Bits_Get(&r, 1))
+            {
+                q++;
+            }
+            if (q >= CODEC_RICE_ESCAPE)
+                z = Bits_Get(&r, CODEC_ESCAPE_BITS);
+            else
+                z = (q << k) | (k ? Bits_Get(&r, k) : 0u);
+            samples[i] = (uint16_t)(Predict(samples, i, mode) + Unzigzag(z));
+        }
+    }
+    else
+    {
+        return 0;
+    }
+
+    return r.overrun ? 0 : r.pos;
+}
@@ -0,0 +1,31 @@
+#ifndef __CODEC_H
+#define __CODEC_H
+
+#include <stdint.h>
+
+/*
+ * 12位波形无损压缩（块编码，每块字节对齐，可独立解码）
+ *   位流（高位在前）：
+ *     mode(2)  0=原始12位  1=一阶预测(差分)+Rice  2=二阶线性预测+Rice
+ *     mode=0：n个12位样本
+ *     mode=1/2：k(4) + 首样本(12) + n-1个Rice码残差
+ *       残差先zigzag映射为非负数z；q=z>>k<16时输出q个1、一个0、k位余数，
+ *       否则输出16个1后跟14位z（转义）
+ *   编码器先精确计算Rice位数，超过原始12位打包时回退mode=0，
+ *   因此每块输出不超过 CODEC_BLOCK_BOUND(n) 字节，耗时与n成线性
+ *   块样本数n由外层帧给出，不写入块内
+ */
+#define CODEC_MODE_RAW          0
+#define CODEC_MODE_DELTA        1
+#define CODEC_MODE_LPC2         2
+
+#define CODEC_RICE_ESCAPE       16       // 商达到该值时转义为原始14位
+#define CODEC_ESCAPE_BITS       14       // 二阶残差zigzag后最大14位
+#define CODEC_SNAPSHOT_BLOCK    50       // 快照导出分块长度（与DMA半缓冲一致）
+
+#define CODEC_BLOCK_BOUND(n)    ((uint16_t)((2 + 12 * (uint32_t)(n) + 7) / 8))
+
+uint16_t Codec_EncodeBlock(const uint16_t *samples, uint16_t n, uint8_t *out);
+uint16_t Codec_DecodeBlock(const uint8_t *in, uint16_t in_len, uint16_t *samples, uint16_t n);
+
+#endif
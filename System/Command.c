@@ -0,0 +1,620 @@
+#include "stm32f10x.h"
+#include "Command.h"
+#include "Serial.h"
+#include "Telemetry.h"
+#include "Export.h"
+#include "Decimator.h"
+#include "Capture.h"
+#include "Clock.h"
+#include "Rollover.h"
+#include "EventLog.h"
+#include "Latency.h"
+#include "OLED.h"
+#include "Cycle.h"
+#include "AD.h"
+#include "Pack12.h"
+#include "StackMon.h"
+
+volatile uint32_t command_count = 0;
+volatile uint32_t command_error_count = 0;
+
+/* 主程序中的运行变量 */
+extern volatile uint16_t dynamic_threshold;
+extern volatile uint16_t noise_mad_estimate;
+extern volatile uint32_t drop_count;
+extern volatile uint32_t total_rain_um;
+extern volatile uint32_t snapshot_valid_count;
+extern volatile uint32_t watchdog_trigger_count;
+extern volatile uint8_t snapshot_ready;
+extern volatile uint8_t snapshot_collecting;
+extern volatile uint16_t snapshot_buffer_high[SNAPSHOT_SIZE];
+
+typedef struct
+{
+    const char *name;
+    volatile void *ptr;                  // 变量地址（为0时使用get/set）
+    uint8_t size;                        // 1/2/4字节
+    uint8_t writable;
+    uint32_t min;
+    uint32_t max;
+    uint32_t (*get)(void);
+    void (*set)(uint32_t v);
+} CommandParam;
+
+static uint32_t Param_GetDecim(void)
+{
+    return Decimator_GetShift();
+}
+
+static void Param_SetDecim(uint32_t v)
+{
+    Decimator_SetRatio((uint8_t)v);
+}
+
+static uint32_t Param_GetDayStart(void)
+{
+    return Clock_DayStartHour();
+}
+
+/* 日界改变后当前日周期不再对齐，重新开始跟踪（首个周期complete=0） */
+static void Param_SetDayStart(uint32_t v)
+{
+    if ((uint8_t)v == Clock_DayStartHour())
+        return;
+    Clock_SetDayStartHour((uint8_t)v);
+    Rollover_Restart();
+}
+
+static const CommandParam command_params[] =
+{
+    { "export",  &export_mode,          1, 1, 0, EXPORT_MODE_ALL,     0, 0 },
+    { "format",  &export_format,        1, 1, 0, EXPORT_FORMAT_CODEC, 0, 0 },
+    { "vofa",    &telemetry_vofa_mode,  1, 1, 0, 1,                   0, 0 },
+    { "codec",   &telemetry_live_codec, 1, 1, 0, 1,                   0, 0 },
+    { "live",    &telemetry_live_enabled, 1, 1, 0, 1,                 0, 0 },
+    { "decim",   0,                     0, 1, 0, DECIM_SHIFT_MAX,     Param_GetDecim, Param_SetDecim },
+    { "daystart", 0,                    0, 1, 0, 23,                  Param_GetDayStart, Param_SetDayStart },
+    { "thr",     &dynamic_threshold,    2, 0, 0, 0,                   0, 0 },
+    { "mad",     &noise_mad_estimate,   2, 0, 0, 0,                   0, 0 },
+    { "drops",   &drop_count,           4, 0, 0, 0,                   0, 0 },
+    { "rain",    &total_rain_um,        4, 0, 0, 0,                   0, 0 },
+    { "valid",   &snapshot_valid_count, 4, 0, 0, 0,                   0, 0 },
+    { "awd",     &watchdog_trigger_count, 4, 0, 0, 0,                 0, 0 },
+};
+#define COMMAND_PARAM_COUNT (sizeof(command_params) / sizeof(command_params[0]))
+
+static char line_buf[COMMAND_LINE_MAX + 1];
+static uint8_t line_len = 0;
+static uint8_t line_overflow = 0;        // 1：当前行超长，丢弃到行尾
+
+#if COMMAND_REPLY_MAX > TELEMETRY_MAX_PAYLOAD
+#error "应答超出遥测帧负载，Telemetry_Send会整帧丢弃"
+#endif
+
+static char reply_buf[COMMAND_REPLY_MAX + 2];   // VOFA模式另加\r\n
+static uint8_t reply_len = 0;
+
+/* ---------------- 应答拼接 ---------------- */
+
+static void Reply_Str(const char *s)
+{
+    while (*s && reply_len < COMMAND_REPLY_MAX)
+    {
+        reply_buf[reply_len++] = *s++;
+    }
+}
+
+static void Reply_U32(uint32_t v)
+{
+    char tmp[10];
+    uint8_t n = 0;
+
+    do
+    {
+        tmp[n++] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v > 0);
+    while (n > 0 && reply_len < COMMAND_REPLY_MAX)
+    {
+        reply_buf[reply_len++] = tmp[--n];
+    }
+}
+
+static void Reply_I32(int32_t v)
+{
+    if (v < 0)
+    {
+        Reply_Str("-");
+        Reply_U32((uint32_t)(-v));
+    }
+    else
+    {
+        Reply_U32((uint32_t)v);
+    }
+}
+
+static void Reply_Send(void)
+{
+    if (telemetry_vofa_mode)
+    {
+        reply_buf[reply_len++] = '\r';
+        reply_buf[reply_len++] = '\n';
+        Serial_Write(SERIAL_PRIO_EVENT, (const uint8_t *)reply_buf, reply_len);
+    }
+    else
+    {
+        Telemetry_Send(SERIAL_PRIO_EVENT, TLM_TYPE_REPLY, (const uint8_t *)reply_buf, reply_len);
+    }
+    reply_len = 0;
+}
+
+/* 当前帧放不下need个字节时先发出，下一帧以"OK"续写 */
+static void Reply_Break(uint8_t need)
+{
+    if (reply_len + need > COMMAND_REPLY_MAX)
+    {
+        Reply_Send();
+        Reply_Str("OK");
+    }
+}
+
+static void Reply_Error(const char *reason)
+{
+    command_error_count++;
+    Reply_Str("ERR ");
+    Reply_Str(reason);
+}
+
+/* ---------------- 解析辅助 ---------------- */
+
+static uint8_t Str_Equal(const char *a, const char *b)
+{
+    while (*a && *a == *b)
+    {
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+/* 取下一个空格分隔的词，原地以'\0'截断；没有更多词时返回0 */
+static char *Next_Token(char **cursor)
+{
+    char *p = *cursor;
+    char *start;
+
+    while (*p == ' ')
+        p++;
+    if (*p == '\0')
+        return 0;
+    start = p;
+    while (*p && *p != ' ')
+        p++;
+    if (*p)
+        *p++ = '\0';
+    *cursor = p;
+    return start;
+}
+
+static uint8_t Parse_U32(const char *s, uint32_t *out)
+{
+    uint32_t v = 0;
+
+    if (s == 0 || *s == '\0')
+        return 0;
+    while (*s)
+    {
+        uint32_t d = (uint32_t)(*s - '0');
+
+        if (*s < '0' || *s > '9' || v > (0xFFFFFFFFu - d) / 10u)
+            return 0;                    // 非数字或超出32位
+        v = v * 10 + d;
+        s++;
+    }
+    *out = v;
+    return 1;
+}
+
+static uint8_t Parse_I32(const char *s, int32_t *out)
+{
+    uint32_t v;
+    uint8_t negative = 0;
+
+    if (s != 0 && (*s == '-' || *s == '+'))
+    {
+        negative = (*s == '-');
+        s++;
+    }
+    if (!Parse_U32(s, &v) || v > 0x7FFFFFFFu)
+        return 0;
+    *out = negative ? -(int32_t)v : (int32_t)v;
+    return 1;
+}
+
+static const CommandParam *Find_Param(const char *name)
+{
+    uint8_t i;
+
+    for (i = 0; i < COMMAND_PARAM_COUNT; i++)
+    {
+        if (Str_Equal(command_params[i].name, name))
+            return &command_params[i];
+    }
+    return 0;
+}
+
+static uint32_t Param_Read(const CommandParam *p)
+{
+    if (p->get)
+        return p->get();
+    if (p->size == 1)
+        return *(volatile uint8_t *)p->ptr;
+    if (p->size == 2)
+        return *(volatile uint16_t *)p->ptr;
+    return *(volatile uint32_t *)p->ptr;
+}
+
+static void Param_Write(const CommandParam *p, uint32_t v)
+{
+    if (p->set)
+        p->set(v);
+    else if (p->size == 1)
+        *(volatile uint8_t *)p->ptr = (uint8_t)v;
+    else if (p->size == 2)
+        *(volatile uint16_t *)p->ptr = (uint16_t)v;
+    else
+        *(volatile uint32_t *)p->ptr = v;
+}
+
+/* ---------------- 命令 ---------------- */
+
+static void Cmd_Param(const char *verb, char *args)
+{
+    char *name = Next_Token(&args);
+    const CommandParam *p;
+    uint32_t v;
+
+    if (name == 0 || (p = Find_Param(name)) == 0)
+    {
+        Reply_Error("param");
+        return;
+    }
+    if (Str_Equal(verb, "set"))
+    {
+        if (!p->writable)
+        {
+            Reply_Error("readonly");
+            return;
+        }
+        if (!Parse_U32(Next_Token(&args), &v) || v < p->min || v > p->max)
+        {
+            Reply_Error("value");
+            return;
+        }
+        Param_Write(p, v);
+    }
+    Reply_Str("OK ");
+    Reply_Str(p->name);
+    Reply_Str("=");
+    Reply_U32(Param_Read(p));
+}
+
+static void Cmd_List(void)
+{
+    uint8_t i;
+
+    Reply_Str("OK");
+    for (i = 0; i < COMMAND_PARAM_COUNT; i++)
+    {
+        uint8_t name_len = 0;
+
+        while (command_params[i].name[name_len] != '\0')
+            name_len++;
+        Reply_Break((uint8_t)(name_len + 12));   // 空格 + 名称 + '='/':' + 最多10位数
+        Reply_Str(" ");
+        Reply_Str(command_params[i].name);
+        Reply_Str(command_params[i].writable ? "=" : ":");
+        Reply_U32(Param_Read(&command_params[i]));
+    }
+}
+
+static void Cmd_Reset(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint8_t i;
+
+    Rain_ResetCounters();
+
+    /* 与中断共享的计数器成组清零 */
+    __disable_irq();
+    for (i = 0; i < SERIAL_PRIO_COUNT; i++)
+    {
+        serial_drop_frames[i] = 0;
+        serial_drop_bytes[i] = 0;
+    }
+    serial_rx_overruns = 0;
+    decim_overrun_count = 0;
+    capture_lost_blocks = 0;
+    __set_PRIMASK(primask);
+
+    export_sent_count = 0;
+    export_skipped_count = 0;
+    codec_block_cycles_max = 0;
+    oled_flush_cycles_max = 0;
+    pack12_block_cycles_max = 0;
+    command_error_count = 0;
+    Latency_Reset();
+    StackMon_Reset();
+    Reply_Str("OK reset");
+}
+
+static void Cmd_Stream(char *args)
+{
+    char *which = Next_Token(&args);
+    char *state = Next_Token(&args);
+    uint8_t on;
+
+    if (state == 0 || !(Str_Equal(state, "on") || Str_Equal(state, "off")))
+    {
+        Reply_Error("usage: stream live|capture on|off");
+        return;
+    }
+    on = Str_Equal(state, "on");
+
+    if (Str_Equal(which, "live"))
+    {
+        telemetry_live_enabled = on;
+    }
+    else if (Str_Equal(which, "capture"))
+    {
+        if (on && !capture_active && Export_IsBusy())
+        {
+            Reply_Error("export busy");
+            return;
+        }
+        /* 先发应答：开始捕获后链路切换到CAPTURE_BAUDRATE */
+        Reply_Str("OK capture ");
+        Reply_Str(state);
+        Reply_Send();
+        if (on)
+            Capture_Start(CAPTURE_BAUDRATE);
+        else
+            Capture_Stop();
+        return;
+    }
+    else
+    {
+        Reply_Error("stream");
+        return;
+    }
+    Reply_Str("OK ");
+    Reply_Str(which);
+    Reply_Str(" ");
+    Reply_Str(state);
+}
+
+static void Cmd_Dump(void)
+{
+    /* 快照缓冲在采集中或等待主循环处理时不可用，避免导出半新半旧的数据 */
+    if (capture_active || snapshot_collecting || snapshot_ready)
+    {
+        Reply_Error("busy");
+        return;
+    }
+    if (!Export_Submit(snapshot_buffer_high, SNAPSHOT_SIZE))
+    {
+        Reply_Error("export busy");
+        return;
+    }
+    Reply_Str("OK dump ");
+    Reply_U32(export_last_bytes);
+}
+
+/* 分四帧：编码/抽取、链路、显示/解包、栈/中断嵌套（每帧数值全为10位时也不超过COMMAND_REPLY_MAX） */
+static void Cmd_Prof(void)
+{
+    Reply_Str("OK codec_cyc=");
+    Reply_U32(codec_block_cycles_last);
+    Reply_Str(" codec_max=");
+    Reply_U32(codec_block_cycles_max);
+    Reply_Str(" decim_ovr=");
+    Reply_U32(decim_overrun_count);
+    Reply_Send();
+
+    Reply_Str("OK tx_drop=");
+    Reply_U32(serial_drop_frames[SERIAL_PRIO_EVENT]);
+    Reply_Str("/");
+    Reply_U32(serial_drop_frames[SERIAL_PRIO_EXPORT]);
+    Reply_Str("/");
+    Reply_U32(serial_drop_frames[SERIAL_PRIO_LIVE]);
+    Reply_Str(" rx_ovr=");
+    Reply_U32(serial_rx_overruns);
+    Reply_Str(" cap_lost=");
+    Reply_U32(capture_lost_blocks);
+    Reply_Str(" cmd_err=");
+    Reply_U32(command_error_count);
+    Reply_Send();
+
+    Reply_Str("OK oled_us=");
+    Reply_U32(oled_flush_cycles_last / CYCLES_PER_US);
+    Reply_Str("/");
+    Reply_U32(oled_flush_cycles_max / CYCLES_PER_US);
+    Reply_Str(oled_backend == OLED_BACKEND_HW ? " i2c=hw/" : " i2c=sw/");
+    Reply_U32(oled_i2c_errors);
+    Reply_Str(" unpack_cyc=");
+    Reply_U32(pack12_block_cycles_last);
+    Reply_Str("/");
+    Reply_U32(pack12_block_cycles_max);
+    Reply_Send();
+
+    Reply_Str("OK stk=");
+    Reply_U32(StackMon_Scan());
+    Reply_Str("/");
+    Reply_U32(StackMon_Size());
+    Reply_Str(" nest=");
+    Reply_U32(isr_depth_max);
+}
+
+static void Cmd_Time(char *args)
+{
+    static const char *const source_names[] = { "none", "lse", "lsi" };
+    char *arg = Next_Token(&args);
+    char *tz_arg = Next_Token(&args);
+    uint32_t v;
+    int32_t tz;
+
+    if (arg != 0)
+    {
+        if (!Parse_U32(arg, &v) || (tz_arg != 0 && !Parse_I32(tz_arg, &tz)))
+        {
+            Reply_Error("value");
+            return;
+        }
+        if (tz_arg != 0 && (tz < -720 || tz > 840 || !Clock_SetTzMinutes((int16_t)tz)))
+        {
+            Reply_Error("range");
+            return;
+        }
+        Clock_Set(v);
+        Rollover_Restart();              // 时钟跳变：丢弃当前部分周期，新周期complete=0
+    }
+    Reply_Str("OK time=");
+    Reply_U32(Clock_Now());
+    Reply_Str(" tz=");
+    Reply_I32(Clock_TzMinutes());
+    Reply_Str(" src=");
+    Reply_Str(source_names[Clock_Source()]);
+}
+
+static void Cmd_Log(char *args)
+{
+    char *seq_arg = Next_Token(&args);
+    char *pages_arg = Next_Token(&args);
+    uint32_t seq, pages = 1;
+
+    if (seq_arg == 0)
+    {
+        Reply_Str("OK log oldest=");
+        Reply_U32(EventLog_OldestSeq());
+        Reply_Str(" next=");
+        Reply_U32(eventlog_next_seq);
+        Reply_Str(" spill_lost=");
+        Reply_U32(eventlog_spill_lost);
+        Reply_Str(" erases=");
+        Reply_U32(eventlog_flash_erases);
+        Reply_Str("/");
+        Reply_U32(eventlog_forced_erases);
+        Reply_Str(" err=");
+        Reply_U32(eventlog_flash_errors);
+        return;
+    }
+    if (!Parse_U32(seq_arg, &seq) ||
+        (pages_arg != 0 && (!Parse_U32(pages_arg, &pages) || pages == 0 || pages > EVENTLOG_MAX_PAGES)))
+    {
+        Reply_Error("value");
+        return;
+    }
+    Reply_Str("OK log from=");
+    Reply_U32(EventLog_StartDownload(seq, (uint8_t)pages));
+    Reply_Str(" next=");
+    Reply_U32(eventlog_next_seq);
+}
+
+static void Cmd_Latency(char *args)
+{
+    char *arg = Next_Token(&args);
+
+    if (arg != 0)
+    {
+        if (!Str_Equal(arg, "reset"))
+        {
+            Reply_Error("usage: lat [reset]");
+            return;
+        }
+        Latency_Reset();
+    }
+    Reply_Str("OK lat n=");
+    Reply_U32(latency_count);
+    Reply_Str(" last=");
+    Reply_U32(latency_last_us);
+    Reply_Str(" p50=");
+    Reply_U32(Latency_Percentile(50));
+    Reply_Str(" p90=");
+    Reply_U32(Latency_Percentile(90));
+    Reply_Str(" p99=");
+    Reply_U32(Latency_Percentile(99));
+    Reply_Str(" max=");
+    Reply_U32(latency_max_us);
+    Reply_Str(" us");
+}
+
+static void Command_Execute(char *line)
+{
+    char *cursor = line;
+    char *verb = Next_Token(&cursor);
+
+    if (verb == 0)
+        return;                          // 空行不应答
+
+    command_count++;
+    if (Str_Equal(verb, "get") || Str_Equal(verb, "set"))
+        Cmd_Param(verb, cursor);
+    else if (Str_Equal(verb, "list"))
+        Cmd_List();
+    else if (Str_Equal(verb, "reset"))
+        Cmd_Reset();
+    else if (Str_Equal(verb, "stream"))
+        Cmd_Stream(cursor);
+    else if (Str_Equal(verb, "dump"))
+        Cmd_Dump();
+    else if (Str_Equal(verb, "prof"))
+        Cmd_Prof();
+    else if (Str_Equal(verb, "time"))
+        Cmd_Time(cursor);
+    else if (Str_Equal(verb, "log"))
+        Cmd_Log(cursor);
+    else if (Str_Equal(verb, "lat"))
+        Cmd_Latency(cursor);
+    else if (Str_Equal(verb, "help"))
+        Reply_Str("OK help list get set reset stream dump prof time log lat");
+    else
+        Reply_Error("unknown");
+
+    if (reply_len > 0)
+        Reply_Send();
+}
+
+/**
+  * @brief  命令任务（每次主循环调用一次）
+  * @note   取出接收缓冲中的全部字节，遇到行尾执行一条命令
+  */
+void Command_Task(void)
+{
+    uint8_t b;
+
+    while (Serial_ReadByte(&b))
+    {
+        if (b == '\r' || b == '\n')
+        {
+            if (line_overflow)
+            {
+                command_error_count++;
+            }
+            else
+            {
+                line_buf[line_len] = '\0';
+                Command_Execute(line_buf);
+            }
+            line_len = 0;
+            line_overflow = 0;
+        }
+        else if (line_len < COMMAND_LINE_MAX)
+        {
+            line_buf[line_len++] = (char)b;
+        }
+        else
+        {
+            line_overflow = 1;
+        }
+    }
+}
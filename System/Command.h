@@ -0,0 +1,33 @@
+#ifndef __COMMAND_H
+#define __COMMAND_H
+
+#include <stdint.h>
+
+/*
+ * USART1命令接口（ASCII行命令，以\r或\n结束，空格分隔）
+ *   help                       列出命令
+ *   list                       列出参数
+ *   get <name> / set <name> <v> 读写参数
+ *   reset                      清零计数器（雨滴、雨量、丢帧等）
+ *   stream live|capture on|off 开关示波流 / 全速原始捕获
+ *   dump                       导出最近一个快照波形
+ *   prof                       读取性能计数
+ *   time [unix [tz]]           读取/设置RTC时钟（UTC秒，tz为时区分钟，东正西负）
+ *   log [seq [pages]]          事件日志概况 / 从seq起批量下载pages个LOG帧（默认1）
+ *   lat [reset]                触发到计数延迟（us）：次数、最近、p50/p90/p99、最大
+ * 应答为TLM_TYPE_REPLY帧（ASCII，"OK ..."或"ERR ..."）；VOFA模式下直接输出文本行
+ *   每帧不超过COMMAND_REPLY_MAX字节，较长的应答（list、prof）分为多帧，每帧均以"OK"开头
+ * 字节由RXNE中断收入接收缓冲，Command_Task在主循环中解析执行，不影响采样
+ */
+#define COMMAND_LINE_MAX        48       // 单行最大长度（超长行整行丢弃）
+#define COMMAND_REPLY_MAX       128      // 单帧应答最大长度（一个REPLY帧，不超过TELEMETRY_MAX_PAYLOAD）
+
+extern volatile uint32_t command_count;        // 已执行命令数
+extern volatile uint32_t command_error_count;  // 解析失败/参数错误数
+
+void Command_Task(void);
+
+/* 由主程序实现：清零雨滴/雨量统计 */
+void Rain_ResetCounters(void);
+
+#endif
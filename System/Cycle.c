@@ -0,0 +1,14 @@
+#include "Cycle.h"
+
+/**
+  * @brief  使能DWT周期计数器
+  * @param  无
+  * @retval 无
+  * @note   CYCCNT从0开始计数，上电后尽早调用即可作为启动计时基准
+  */
+void Cycle_Init(void)
+{
+    CYCLE_DEMCR |= (1u << 24);            // TRCENA：使能DWT/ITM
+    CYCLE_DWT_CYCCNT = 0;                 // 清零计数值
+    CYCLE_DWT_CTRL |= 1u;                 // CYCCNTENA：启动计数
+}
@@ -0,0 +1,18 @@
+#ifndef __CYCLE_H
+#define __CYCLE_H
+
+#include <stdint.h>
+
+/* DWT周期计数器（72MHz下约59.6s回绕一次，只用于测量短区间） */
+#define CYCLE_DEMCR      (*(volatile uint32_t *)0xE000EDFC)
+#define CYCLE_DWT_CTRL   (*(volatile uint32_t *)0xE0001000)
+#define CYCLE_DWT_CYCCNT (*(volatile uint32_t *)0xE0001004)
+
+#define CYCLES_PER_US    72u            // SYSCLK = 72MHz
+
+void Cycle_Init(void);
+
+/* 读取当前周期计数 */
+#define Cycle_Now()      (CYCLE_DWT_CYCCNT)
+
+#endif
@@ -0,0 +1,124 @@
+#include "stm32f10x.h"
+#include "Decimator.h"
+#include "AD.h"
+
+volatile uint32_t decim_overrun_count = 0;
+
+static uint8_t decim_shift = DECIM_DEFAULT_SHIFT;
+static uint32_t decim_base_tick = 0;     // 第0个桶的首样本采样序号
+
+/* CIC积分器/梳状器状态（模2^32运算，回绕不影响结果） */
+static uint32_t cic_i1 = 0, cic_i2 = 0;
+static uint32_t cic_c1_prev = 0, cic_i2_prev = 0;
+
+/* 当前桶 */
+static uint8_t bucket_count = 0;
+static uint16_t bucket_min = 0xFFFF;
+static uint16_t bucket_max = 0;
+static uint16_t bucket_seq = 0;
+
+static DecimBucket decim_fifo[DECIM_FIFO_SIZE];
+static volatile uint16_t fifo_head = 0;  // 中断写
+static volatile uint16_t fifo_tail = 0;  // 主循环读
+
+/**
+  * @brief  设置抽取比并复位抽取器（主循环调用）
+  * @param  shift 抽取比为2^shift，0~DECIM_SHIFT_MAX
+  */
+void Decimator_SetRatio(uint8_t shift)
+{
+    uint32_t primask;
+
+    if (shift > DECIM_SHIFT_MAX)
+        shift = DECIM_SHIFT_MAX;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    decim_shift = shift;
+    decim_base_tick = sampling_tick_counter;
+    cic_i1 = cic_i2 = cic_c1_prev = cic_i2_prev = 0;
+    bucket_count = 0;
+    bucket_min = 0xFFFF;
+    bucket_max = 0;
+    bucket_seq = 0;
+    fifo_tail = fifo_head;
+    __set_PRIMASK(primask);
+}
+
+uint8_t Decimator_GetShift(void)
+{
+    return decim_shift;
+}
+
+uint32_t Decimator_BaseTick(void)
+{
+    return decim_base_tick;
+}
+
+/**
+  * @brief  输入一个样本（DMA中断中调用，与sampling_tick_counter同步推进）
+  */
+void Decimator_Push(uint16_t value)
+{
+    uint16_t next;
+
+    cic_i1 += value;
+    cic_i2 += cic_i1;
+    if (value < bucket_min)
+        bucket_min = value;
+    if (value > bucket_max)
+        bucket_max = value;
+
+    if (++bucket_count < (1u << decim_shift))
+        return;
+
+    /* 抽取点：两级梳状器，除以增益R^2 */
+    {
+        uint32_t c1 = cic_i2 - cic_i2_prev;
+        uint32_t y = c1 - cic_c1_prev;
+        cic_i2_prev = cic_i2;
+        cic_c1_prev = c1;
+
+        next = (fifo_head + 1) & (DECIM_FIFO_SIZE - 1);
+        if (next != fifo_tail)
+        {
+            DecimBucket *b = &decim_fifo[fifo_head];
+            b->mean = (uint16_t)(y >> (2 * decim_shift));
+            b->min = bucket_min;
+            b->max = bucket_max;
+            b->seq = bucket_seq;
+            fifo_head = next;
+        }
+        else
+        {
+            decim_overrun_count++;
+        }
+    }
+
+    bucket_seq++;
+    bucket_count = 0;
+    bucket_min = 0xFFFF;
+    bucket_max = 0;
+}
+
+/**
+  * @brief  查看FIFO中最早的桶（主循环调用）
+  * @retval 桶指针，FIFO为空时返回0；在Decimator_Advance之前有效
+  */
+const DecimBucket *Decimator_Peek(void)
+{
+    uint16_t tail = fifo_tail;
+
+    if (tail == fifo_head)
+        return 0;
+    return &decim_fifo[tail];
+}
+
+/**
+  * @brief  释放Decimator_Peek返回的桶
+  */
+void Decimator_Advance(void)
+{
+    if (fifo_tail != fifo_head)
+        fifo_tail = (fifo_tail + 1) & (DECIM_FIFO_SIZE - 1);
+}
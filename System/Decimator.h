@@ -0,0 +1,36 @@
+#ifndef __DECIMATOR_H
+#define __DECIMATOR_H
+
+#include <stdint.h>
+
+/*
+ * 示波流抽取器（在DMA中断中逐样本调用）
+ *   每R=2^shift个样本输出一个桶：二阶CIC抗混叠均值 + 桶内最小/最大值（峰值检测模式），
+ *   短时雨滴尖峰即使被均值平滑也会保留在max包络中
+ *   桶写入单生产者/单消费者FIFO，主循环取出后组帧发送
+ *   第b个桶覆盖采样序号 [base_tick + b*R, base_tick + (b+1)*R)
+ */
+#define DECIM_SHIFT_MAX         6        // 最大抽取比64（CIC增益R^2，12位样本累加不超过24位）
+#ifndef DECIM_DEFAULT_SHIFT
+#define DECIM_DEFAULT_SHIFT     5        // 默认抽取比32：约744桶/秒，占115200链路约一半
+#endif
+#define DECIM_FIFO_SIZE         64       // 2的幂，约86ms@默认抽取比
+
+typedef struct
+{
+    uint16_t mean;                       // CIC滤波值
+    uint16_t min;                        // 桶内最小值
+    uint16_t max;                        // 桶内最大值
+    uint16_t seq;                        // 桶序号低16位（用于检测FIFO溢出缺口）
+} DecimBucket;
+
+extern volatile uint32_t decim_overrun_count;   // FIFO满丢弃的桶数
+
+void Decimator_SetRatio(uint8_t shift);
+uint8_t Decimator_GetShift(void);
+uint32_t Decimator_BaseTick(void);
+void Decimator_Push(uint16_t value);
+const DecimBucket *Decimator_Peek(void);
+void Decimator_Advance(void);
+
+#endif
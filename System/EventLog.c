@@ -0,0 +1,379 @@
+#include "stm32f10x.h"
+#include "EventLog.h"
+#include "Telemetry.h"
+#include "Serial.h"
+#include "Export.h"
+
+#define RAM_MASK                (EVENTLOG_RAM_RECORDS - 1u)
+#define LOG_HEADER_SIZE         9
+#define LOG_FRAME_BYTES         (TELEMETRY_HEADER_SIZE + LOG_HEADER_SIZE + EVENTLOG_PAGE_RECORDS * 8 + TELEMETRY_CRC_SIZE)
+#define SPILL_FORCE_BACKLOG     (EVENTLOG_RAM_RECORDS - 32u)  // 积压到此即在降雨中也擦页
+
+uint32_t eventlog_next_seq = 0;
+uint32_t eventlog_spill_lost = 0;
+uint32_t eventlog_flash_erases = 0;
+uint32_t eventlog_forced_erases = 0;
+uint32_t eventlog_flash_errors = 0;
+
+static EventRecord ram_records[EVENTLOG_RAM_RECORDS];
+static uint32_t ram_first_seq = 0;       // 本次上电第一条记录的序号（更早的只在Flash中）
+
+/* 批量下载 */
+static uint32_t download_seq = 0;
+static uint8_t download_pages = 0;
+
+#if EVENTLOG_FLASH_SPILL
+static uint32_t spill_seq = 0;           // 下一条待溢写记录的序号
+static uint8_t flash_page = 0;           // 当前溢写页
+static uint8_t flash_slot = EVENTLOG_FLASH_SLOTS;  // 当前页下一个空槽（满表示需要换页）
+static uint8_t next_page_ready = 0;      // 1：下一页已确认为空
+
+static const uint32_t *Flash_Page(uint8_t page)
+{
+    return (const uint32_t *)(EVENTLOG_FLASH_BASE + page * JOURNAL_PAGE_SIZE);
+}
+
+static uint8_t Flash_PageValid(uint8_t page)
+{
+    return Flash_Page(page)[0] == EVENTLOG_FLASH_MAGIC;
+}
+
+static uint8_t Flash_SlotBlank(uint8_t page, uint8_t slot)
+{
+    const uint32_t *w = Flash_Page(page) + 2 + slot * 2;
+    return (w[0] == 0xFFFFFFFFu && w[1] == 0xFFFFFFFFu);
+}
+
+static uint8_t Flash_PageBlank(uint8_t page)
+{
+    const uint32_t *w = Flash_Page(page);
+    uint16_t i;
+
+    for (i = 0; i < JOURNAL_PAGE_SIZE / 4u; i++)
+    {
+        if (w[i] != 0xFFFFFFFFu)
+            return 0;
+    }
+    return 1;
+}
+
+/**
+  * @brief  按半字编程count个字
+  * @retval 1：成功（回读最后一字一致），0：失败（计入eventlog_flash_errors）
+  */
+static uint8_t Flash_Program(uint32_t addr, const uint32_t *words, uint8_t count)
+{
+    FLASH_Status status = FLASH_COMPLETE;
+    uint8_t i;
+
+    FLASH_Unlock();
+    FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPRTERR);
+    for (i = 0; i < count * 2 && status == FLASH_COMPLETE; i++)
+    {
+        status = FLASH_ProgramHalfWord(addr + i * 2u, (uint16_t)(words[i >> 1] >> ((i & 1) * 16)));
+    }
+    FLASH_Lock();
+
+    if (status != FLASH_COMPLETE || ((const uint32_t *)addr)[count - 1] != words[count - 1])
+    {
+        eventlog_flash_errors++;
+        return 0;
+    }
+    return 1;
+}
+
+/**
+  * @brief  擦除溢写页
+  * @retval 1：成功，0：失败（计入eventlog_flash_errors）
+  */
+static uint8_t Flash_Erase(uint8_t page, uint8_t quiet)
+{
+    FLASH_Status status;
+
+    FLASH_Unlock();
+    FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPRTERR);
+    status = FLASH_ErasePage((uint32_t)Flash_Page(page));
+    FLASH_Lock();
+    eventlog_flash_erases++;
+    if (!quiet)
+        eventlog_forced_erases++;
+    if (status != FLASH_COMPLETE)
+    {
+        eventlog_flash_errors++;
+        return 0;
+    }
+    return 1;
+}
+
+/**
+  * @brief  在Flash溢写区查找序号对应的记录
+  * @retval 1：找到
+  */
+static uint8_t Flash_Read(uint32_t seq, EventRecord *record)
+{
+    uint8_t page;
+
+    for (page = 0; page < EVENTLOG_FLASH_PAGES; page++)
+    {
+        uint32_t offset = seq - Flash_Page(page)[1];
+
+        if (Flash_PageValid(page) && offset < EVENTLOG_FLASH_SLOTS && !Flash_SlotBlank(page, (uint8_t)offset))
+        {
+            const uint32_t *w = Flash_Page(page) + 2 + offset * 2;
+            record->time = w[0];
+            record->info = w[1];
+            return 1;
+        }
+    }
+    return 0;
+}
+#endif
+
+/**
+  * @brief  面积压缩为8位对数码
+  */
+static uint8_t Area_Code(uint32_t v)
+{
+    uint8_t msb = 4;
+
+    if (v < 16u)
+        return (uint8_t)v;
+    while (msb < 31 && (v >> (msb + 1)) != 0)
+        msb++;
+    if (msb > 18)
+        return 0xFF;                     // 饱和
+    return (uint8_t)(((msb - 3) << 4) | ((v >> (msb - 4)) & 0x0F));
+}
+
+/**
+  * @brief  日志初始化
+  * @note   Flash溢写开启时扫描溢写区，序号从上次最后一条之后继续
+  */
+void EventLog_Init(void)
+{
+#if EVENTLOG_FLASH_SPILL
+    uint8_t page;
+    uint8_t found = 0;
+
+    for (page = 0; page < EVENTLOG_FLASH_PAGES; page++)
+    {
+        uint32_t base = Flash_Page(page)[1];
+
+        if (Flash_PageValid(page) && (!found || (int32_t)(base - Flash_Page(flash_page)[1]) > 0))
+        {
+            flash_page = page;
+            found = 1;
+        }
+    }
+    if (found)
+    {
+        flash_slot = 0;
+        while (flash_slot < EVENTLOG_FLASH_SLOTS && !Flash_SlotBlank(flash_page, flash_slot))
+        {
+            flash_slot++;
+        }
+        eventlog_next_seq = Flash_Page(flash_page)[1] + flash_slot;
+    }
+    else
+    {
+        flash_page = EVENTLOG_FLASH_PAGES - 1;   // 首条记录写入第0页
+        flash_slot = EVENTLOG_FLASH_SLOTS;
+    }
+    next_page_ready = Flash_PageBlank((uint8_t)((flash_page + 1) % EVENTLOG_FLASH_PAGES));
+    spill_seq = eventlog_next_seq;
+#endif
+    ram_first_seq = eventlog_next_seq;
+}
+
+/**
+  * @brief  追加一条事件记录（主循环调用）
+  * @param  unix_seconds   墙上时间（0表示时钟未设置）
+  * @param  uptime_seconds 运行秒（时钟未设置时使用）
+  * @param  amplitude      峰值幅度（ADC单位，相对基线）
+  * @param  width          前部宽度（样本）
+  * @param  area           前部面积（ADC单位×样本）
+  * @param  reason         EVENTLOG_REASON_xxx
+  * @param  cls            EVENTLOG_CLASS_xxx
+  */
+void EventLog_Append(uint32_t unix_seconds, uint32_t uptime_seconds, uint16_t amplitude,
+                     uint16_t width, uint32_t area, uint8_t reason, uint8_t cls)
+{
+    EventRecord *r = &ram_records[eventlog_next_seq & RAM_MASK];
+
+    if (unix_seconds >= EVENTLOG_TIME_EPOCH)
+        r->time = unix_seconds - EVENTLOG_TIME_EPOCH;
+    else
+        r->time = (uptime_seconds & ~EVENTLOG_TIME_UPTIME) | EVENTLOG_TIME_UPTIME;
+
+    r->info = ((uint32_t)(amplitude >> 2) & 0x3FFu) |
+              ((uint32_t)(width > 255u ? 255u : width) << 10) |
+              ((uint32_t)Area_Code(area >> 2) << 18) |
+              ((uint32_t)(reason & 0x0F) << 26) |
+              ((uint32_t)(cls & 0x03) << 30);
+    eventlog_next_seq++;
+}
+
+/**
+  * @brief  当前可读的最早序号
+  */
+uint32_t EventLog_OldestSeq(void)
+{
+    uint32_t oldest = ram_first_seq;
+
+    if (eventlog_next_seq - ram_first_seq > EVENTLOG_RAM_RECORDS)
+        oldest = eventlog_next_seq - EVENTLOG_RAM_RECORDS;
+#if EVENTLOG_FLASH_SPILL
+    {
+        uint8_t page;
+
+        for (page = 0; page < EVENTLOG_FLASH_PAGES; page++)
+        {
+            uint32_t base = Flash_Page(page)[1];
+
+            if (Flash_PageValid(page) && (int32_t)(base - oldest) < 0)
+                oldest = base;
+        }
+    }
+#endif
+    return oldest;
+}
+
+/**
+  * @brief  按序号读取记录（先查RAM，再查Flash溢写区）
+  * @retval 1：找到，0：已被覆盖或尚未产生
+  */
+uint8_t EventLog_Read(uint32_t seq, EventRecord *record)
+{
+    if ((int32_t)(seq - eventlog_next_seq) >= 0)
+        return 0;
+    if ((int32_t)(seq - ram_first_seq) >= 0 && eventlog_next_seq - seq <= EVENTLOG_RAM_RECORDS)
+    {
+        *record = ram_records[seq & RAM_MASK];
+        return 1;
+    }
+#if EVENTLOG_FLASH_SPILL
+    return Flash_Read(seq, record);
+#else
+    return 0;
+#endif
+}
+
+/**
+  * @brief  开始批量下载
+  * @param  seq   起始序号（早于最早可读记录时从最早记录开始）
+  * @param  pages 本批最多帧数
+  * @retval 实际起始序号
+  */
+uint32_t EventLog_StartDownload(uint32_t seq, uint8_t pages)
+{
+    uint32_t oldest = EventLog_OldestSeq();
+
+    if ((int32_t)(seq - oldest) < 0)
+        seq = oldest;
+    download_seq = seq;
+    download_pages = (pages > EVENTLOG_MAX_PAGES) ? EVENTLOG_MAX_PAGES : pages;
+    return seq;
+}
+
+/**
+  * @brief  下载发送（每次主循环调用一次，最多发送一帧）
+  * @note   LOG帧负载：起始序号u32 | 最新序号+1 u32 | 条数u8 | 条数×8字节记录；
+  *         起始序号大于请求序号说明中间记录已丢失；Flash中缺失的记录跳过
+  *         快照导出进行中暂停，导出帧写完后继续
+  */
+void EventLog_Task(void)
+{
+    uint8_t payload[LOG_HEADER_SIZE + EVENTLOG_PAGE_RECORDS * 8];
+    uint8_t *p = payload + LOG_HEADER_SIZE;
+    uint32_t first;
+    uint8_t count = 0;
+    EventRecord record;
+
+    /* 与导出共用EXPORT环：导出长帧分段写入期间不插入LOG帧，否则两帧的字节交错 */
+    if (download_pages == 0 || Export_IsBusy() || Serial_Free(SERIAL_PRIO_EXPORT) < LOG_FRAME_BYTES)
+        return;
+
+    /* 跳过读不到的记录（Flash换页间隙） */
+    while ((int32_t)(download_seq - eventlog_next_seq) < 0 && !EventLog_Read(download_seq, &record))
+    {
+        download_seq++;
+    }
+    first = download_seq;
+    while (count < EVENTLOG_PAGE_RECORDS && EventLog_Read(download_seq, &record))
+    {
+        p = Telemetry_PutU32(p, record.time);
+        p = Telemetry_PutU32(p, record.info);
+        download_seq++;
+        count++;
+    }
+
+    Telemetry_PutU32(payload, first);
+    Telemetry_PutU32(payload + 4, eventlog_next_seq);
+    Telemetry_PutU8(payload + 8, count);
+    Telemetry_Send(SERIAL_PRIO_EXPORT, TLM_TYPE_LOG, payload, (uint16_t)(p - payload));
+
+    download_pages--;
+    if (download_seq == eventlog_next_seq)
+        download_pages = 0;              // 已追上最新记录
+}
+
+/**
+  * @brief  溢写到Flash（主循环每秒调用一次）
+  * @param  quiet 1：安静期，允许擦页
+  * @note   写满当前页前在安静期预擦下一页；积压将被RAM覆盖时才在降雨中擦页（约20ms停顿）；
+  *         擦页或页头失败时记录留在RAM中稍后重试，单条记录编程失败则该槽作废（与Journal相同）
+  */
+void EventLog_Spill(uint8_t quiet)
+{
+#if EVENTLOG_FLASH_SPILL
+    uint8_t next = (uint8_t)((flash_page + 1) % EVENTLOG_FLASH_PAGES);
+    uint8_t n;
+
+    if (!next_page_ready && quiet)
+    {
+        next_page_ready = (Flash_PageBlank(next) || Flash_Erase(next, 1)) ? 1 : 0;
+    }
+
+    /* 积压超过RAM容量：丢失的记录计数，在新页重新开始（页内序号必须连续） */
+    if (eventlog_next_seq - spill_seq > EVENTLOG_RAM_RECORDS)
+    {
+        eventlog_spill_lost += eventlog_next_seq - EVENTLOG_RAM_RECORDS - spill_seq;
+        spill_seq = eventlog_next_seq - EVENTLOG_RAM_RECORDS;
+        flash_slot = EVENTLOG_FLASH_SLOTS;
+    }
+
+    for (n = 0; n < EVENTLOG_SPILL_PER_CALL && spill_seq != eventlog_next_seq; n++)
+    {
+        if (flash_slot >= EVENTLOG_FLASH_SLOTS)
+        {
+            uint32_t header[2];
+
+            if (!next_page_ready)
+            {
+                if (!quiet && eventlog_next_seq - spill_seq < SPILL_FORCE_BACKLOG)
+                    return;              // 推迟到安静期，记录仍在RAM中
+                if (!Flash_Erase(next, quiet))
+                    return;              // 擦除失败：记录仍在RAM中，下次重试
+            }
+            flash_page = next;
+            flash_slot = 0;
+            next_page_ready = 0;
+            next = (uint8_t)((flash_page + 1) % EVENTLOG_FLASH_PAGES);
+            header[0] = EVENTLOG_FLASH_MAGIC;
+            header[1] = spill_seq;
+            if (!Flash_Program((uint32_t)Flash_Page(flash_page), header, 2))
+            {
+                flash_slot = EVENTLOG_FLASH_SLOTS;   // 页头无效，本页作废，下次换页
+                return;
+            }
+        }
+        /* 失败的槽作废（已计数），序号仍按槽连续，RAM中的记录不受影响 */
+        (void)Flash_Program((uint32_t)(Flash_Page(flash_page) + 2 + flash_slot * 2),
+                            (const uint32_t *)&ram_records[spill_seq & RAM_MASK], 2);
+        flash_slot++;
+        spill_seq++;
+    }
+#else
+    (void)quiet;
+#endif
+}
@@ -0,0 +1,64 @@
+#ifndef __EVENTLOG_H
+#define __EVENTLOG_H
+
+#include <stdint.h>
+#include "Journal.h"
+
+/*
+ * 紧凑事件日志
+ *   每个处理过的快照（通过或被拒绝）记一条8字节记录：
+ *     time = 时钟已设置：2020-01-01起的UTC秒；未设置：运行秒|EVENTLOG_TIME_UPTIME
+ *     info = [0:9]幅度>>2  [10:17]前部宽度（样本，饱和255）  [18:25]面积码  [26:29]原因  [30:31]分类
+ *   面积码：前部区间内(样本-基线)之和/4，v<16时码=v，否则码=(e<<4)|m，v≈(16+m)<<(e-1)
+ *   每条记录有全局序号（Flash溢写时跨复位延续）；RAM保留最近EVENTLOG_RAM_RECORDS条，
+ *   EVENTLOG_FLASH_SPILL=1时同时溢写到Journal区之前的EVENTLOG_FLASH_PAGES页（每页头8字节+127条）
+ *   批量下载："log <seq> [pages]"，从seq起每帧EVENTLOG_PAGE_RECORDS条，发满pages帧或追上最新记录为止
+ *   （追上时最后一帧可能为空），主机收到后再请求下一批（拉取式流控）；只在导出优先级缓冲
+ *   有整帧余量时发送，不挤占事件帧，链路中断后按序号续传即可补齐
+ */
+#define EVENTLOG_RAM_RECORDS    512      // RAM记录数（2的幂），4KB；降雨中积压到480条才被迫擦页
+#define EVENTLOG_PAGE_RECORDS   14       // 每个LOG帧的记录数（负载9+112字节）
+#define EVENTLOG_MAX_PAGES      16       // 单次请求最多帧数
+
+#ifndef EVENTLOG_FLASH_SPILL
+#define EVENTLOG_FLASH_SPILL    1
+#endif
+#define EVENTLOG_FLASH_PAGES    4
+#define EVENTLOG_FLASH_BASE     (JOURNAL_BASE - EVENTLOG_FLASH_PAGES * JOURNAL_PAGE_SIZE)  // 0x0800E000
+#define EVENTLOG_FLASH_SLOTS    ((JOURNAL_PAGE_SIZE - 8u) / 8u)                           // 127
+#define EVENTLOG_FLASH_MAGIC    0x474F4C45u  // "ELOG"
+#define EVENTLOG_SPILL_PER_CALL 8        // 每次溢写最多条数（每条4个半字，约0.2ms）
+
+#define EVENTLOG_TIME_EPOCH     1577836800u  // 2020-01-01T00:00:00Z
+#define EVENTLOG_TIME_UPTIME    0x80000000u  // 时间字最高位：运行秒（时钟未设置）
+
+/* 分类 */
+#define EVENTLOG_CLASS_REJECTED 0        // 被拒绝的快照
+#define EVENTLOG_CLASS_DROP     1        // 计数的雨滴
+#define EVENTLOG_CLASS_CLIPPED  2        // 计数的雨滴，峰值达到ADC满量程（幅度被截顶）
+
+/* 原因：0为通过，被拒绝的快照填写验证失败的阶段（main.c中的REJECT_xxx，1~15） */
+#define EVENTLOG_REASON_NONE    0
+
+typedef struct
+{
+    uint32_t time;
+    uint32_t info;
+} EventRecord;
+
+extern uint32_t eventlog_next_seq;       // 下一条记录的序号（=累计记录数）
+extern uint32_t eventlog_spill_lost;     // 未及溢写即被RAM覆盖的记录数
+extern uint32_t eventlog_flash_erases;   // 溢写区擦页次数
+extern uint32_t eventlog_forced_erases;  // 其中在非安静期被迫擦除的次数
+extern uint32_t eventlog_flash_errors;   // 溢写区编程/擦除失败次数
+
+void EventLog_Init(void);
+void EventLog_Append(uint32_t unix_seconds, uint32_t uptime_seconds, uint16_t amplitude,
+                     uint16_t width, uint32_t area, uint8_t reason, uint8_t cls);
+uint32_t EventLog_OldestSeq(void);
+uint8_t EventLog_Read(uint32_t seq, EventRecord *record);
+uint32_t EventLog_StartDownload(uint32_t seq, uint8_t pages);
+void EventLog_Task(void);
+void EventLog_Spill(uint8_t quiet);
+
+#endif
@@ -0,0 +1,170 @@
+#include "stm32f10x.h"
+#include "Export.h"
+#include "Serial.h"
+#include "Cycle.h"
+#include "Capture.h"
+#include "Arena.h"
+
+#define EXPORT_HEADER0      0xAA
+#define EXPORT_HEADER1_ATOP 0x55
+#define EXPORT_HEADER1_CODEC 0x56
+
+volatile uint8_t export_mode = EXPORT_DEFAULT_MODE;
+volatile uint8_t export_format = EXPORT_DEFAULT_FORMAT;
+volatile uint32_t export_sent_count = 0;
+volatile uint32_t export_skipped_count = 0;
+volatile uint16_t export_last_bytes = 0;
+volatile uint32_t codec_block_cycles_last = 0;
+volatile uint32_t codec_block_cycles_max = 0;
+
+/* 导出帧在arena_link.export_frame：导出期间独占，新快照不会覆盖正在发送的数据 */
+#define export_frame            (arena_link.export_frame)
+static uint16_t export_total = 0;        // 本次导出帧总字节数
+static uint16_t export_pos = 0;          // 已入队字节数
+static uint8_t export_busy = 0;          // 1：正在导出
+static uint8_t export_open = 0;          // 1：长帧已打开（BeginFrame成功，尚未EndFrame）
+static uint16_t export_cooldown = 0;     // 距下一次允许导出的剩余主循环数
+
+/**
+  * @brief  当前模式下是否需要导出该快照
+  * @param  valid 快照是否验证通过
+  */
+uint8_t Export_Wants(uint8_t valid)
+{
+    if (capture_active)
+        return 0;                        // 原始捕获独占链路
+    if (export_mode == EXPORT_MODE_ALL)
+        return 1;
+    if (export_mode == EXPORT_MODE_VALID)
+        return valid;
+    return 0;
+}
+
+/**
+  * @brief  生成压缩导出帧，并统计每块压缩耗时
+  */
+static uint16_t Export_BuildCodec(const uint16_t *samples, uint16_t len)
+{
+    uint16_t pos = 6;
+    uint16_t off, n, blocks = 0;
+    uint32_t total_cycles = 0;
+
+    for (off = 0; off < len; off += n)
+    {
+        uint32_t t0 = Cycle_Now();
+        uint32_t dt;
+        n = (len - off > CODEC_SNAPSHOT_BLOCK) ? CODEC_SNAPSHOT_BLOCK : (len - off);
+        pos += Codec_EncodeBlock(&samples[off], n, &export_frame[pos]);
+        dt = Cycle_Now() - t0;
+        total_cycles += dt;
+        if (dt > codec_block_cycles_max)
+            codec_block_cycles_max = dt;
+        blocks++;
+    }
+    if (blocks > 0)
+        codec_block_cycles_last = total_cycles / blocks;
+
+    export_frame[0] = EXPORT_HEADER0;
+    export_frame[1] = EXPORT_HEADER1_CODEC;
+    export_frame[2] = (uint8_t)len;
+    export_frame[3] = (uint8_t)(len >> 8);
+    export_frame[4] = (uint8_t)(pos - 6);
+    export_frame[5] = (uint8_t)((pos - 6) >> 8);
+    return pos;
+}
+
+/**
+  * @brief  生成AtopSerial原始导出帧
+  */
+static uint16_t Export_BuildAtop(const uint16_t *samples, uint16_t len)
+{
+    uint16_t i;
+
+    export_frame[0] = EXPORT_HEADER0;
+    export_frame[1] = EXPORT_HEADER1_ATOP;
+    export_frame[2] = (uint8_t)len;
+    export_frame[3] = (uint8_t)(len >> 8);
+    for (i = 0; i < len; i++)
+    {
+        export_frame[4 + 2 * i] = (uint8_t)samples[i];
+        export_frame[5 + 2 * i] = (uint8_t)(samples[i] >> 8);
+    }
+    return 4 + len * 2;
+}
+
+/**
+  * @brief  提交一个快照导出
+  * @param  samples 快照样本（调用期间中断不得改写，即snapshot_ready尚未清零）
+  * @param  len     样本数（不超过SNAPSHOT_SIZE）
+  * @retval 1：已接收，0：上一次导出未完成、间隔未到或正在原始捕获，本次跳过
+  */
+uint8_t Export_Submit(volatile uint16_t *samples, uint16_t len)
+{
+    if (export_busy || export_cooldown > 0 || capture_active || len > SNAPSHOT_SIZE)
+    {
+        export_skipped_count++;
+        return 0;
+    }
+
+    if (export_format == EXPORT_FORMAT_CODEC)
+        export_total = Export_BuildCodec((const uint16_t *)samples, len);
+    else
+        export_total = Export_BuildAtop((const uint16_t *)samples, len);
+
+    export_last_bytes = export_total;
+    export_pos = 0;
+    export_busy = 1;
+    return 1;
+}
+
+uint8_t Export_IsBusy(void)
+{
+    return export_busy;
+}
+
+/**
+  * @brief  导出任务（每次主循环调用一次）
+  * @note   首次调用时打开长帧（由export_open记录），之后每次最多入队EXPORT_BYTES_PER_LOOP字节，
+  *         全部写入后结束长帧并进入冷却
+  */
+void Export_Task(void)
+{
+    uint16_t n, room;
+
+    if (export_cooldown > 0)
+    {
+        export_cooldown--;
+    }
+    if (!export_busy)
+    {
+        return;
+    }
+
+    if (!export_open)
+    {
+        if (!Serial_BeginFrame(SERIAL_PRIO_EXPORT))
+            return;
+        export_open = 1;                 // 首次可能一个字节也写不进，不能用export_pos==0判断
+    }
+
+    n = export_total - export_pos;
+    if (n > EXPORT_BYTES_PER_LOOP)
+        n = EXPORT_BYTES_PER_LOOP;
+    room = Serial_Free(SERIAL_PRIO_EXPORT);
+    if (n > room)
+        n = room;
+
+    if (n > 0 && Serial_Write(SERIAL_PRIO_EXPORT, &export_frame[export_pos], n))
+    {
+        export_pos += n;
+    }
+
+    if (export_pos >= export_total)
+    {
+        Serial_EndFrame();
+        export_open = 0;
+        export_busy = 0;
+        export_cooldown = EXPORT_MIN_INTERVAL_LOOPS;
+        export_sent_count++;
+    }
+}
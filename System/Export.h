@@ -0,0 +1,51 @@
+#ifndef __EXPORT_H
+#define __EXPORT_H
+
+#include <stdint.h>
+#include "AD.h"
+#include "Codec.h"
+
+/*
+ * 快照波形导出
+ *   EXPORT_FORMAT_ATOP （与AtopSerial_Raindrop_Receiver.lua一致）：
+ *     0xAA 0x55 len_lo len_hi + len个uint16小端样本
+ *   EXPORT_FORMAT_CODEC（压缩，主机用Tools/rain_codec.py解码）：
+ *     0xAA 0x56 len(u16) bytes(u16) + 每CODEC_SNAPSHOT_BLOCK个样本一个压缩块
+ * 导出在主循环中分段写入USART1导出优先级，每次循环限量，不阻塞采样
+ */
+#define EXPORT_MODE_OFF             0    // 不导出
+#define EXPORT_MODE_VALID           1    // 仅导出验证通过的快照
+#define EXPORT_MODE_ALL             2    // 验证通过与被拒绝的快照都导出
+
+#define EXPORT_FORMAT_ATOP          0    // 原始uint16
+#define EXPORT_FORMAT_CODEC         1    // 无损压缩
+
+#ifndef EXPORT_DEFAULT_MODE
+#define EXPORT_DEFAULT_MODE         EXPORT_MODE_VALID
+#endif
+#ifndef EXPORT_DEFAULT_FORMAT
+#define EXPORT_DEFAULT_FORMAT       EXPORT_FORMAT_ATOP
+#endif
+
+#define EXPORT_BYTES_PER_LOOP       96   // 每次主循环(10ms)最多入队字节数（约占115200链路的80%）
+#define EXPORT_MIN_INTERVAL_LOOPS   20   // 两次导出之间的最小间隔（主循环次数，约200ms）
+
+/* 导出帧缓冲：两种格式取大者 */
+#define EXPORT_ATOP_BYTES           (4 + SNAPSHOT_SIZE * 2)
+#define EXPORT_CODEC_BYTES          (6 + ((SNAPSHOT_SIZE + CODEC_SNAPSHOT_BLOCK - 1) / CODEC_SNAPSHOT_BLOCK) * CODEC_BLOCK_BOUND(CODEC_SNAPSHOT_BLOCK))
+#define EXPORT_FRAME_BYTES          ((EXPORT_ATOP_BYTES > EXPORT_CODEC_BYTES) ? EXPORT_ATOP_BYTES : EXPORT_CODEC_BYTES)
+
+extern volatile uint8_t export_mode;
+extern volatile uint8_t export_format;
+extern volatile uint32_t export_sent_count;     // 完整导出的快照数
+extern volatile uint32_t export_skipped_count;  // 导出忙或间隔未到而跳过的快照数
+extern volatile uint16_t export_last_bytes;     // 最近一次导出帧字节数
+extern volatile uint32_t codec_block_cycles_last; // 最近一次快照平均每块压缩周期数
+extern volatile uint32_t codec_block_cycles_max;  // 单块压缩最大周期数
+
+uint8_t Export_Wants(uint8_t valid);
+uint8_t Export_Submit(volatile uint16_t *samples, uint16_t len);
+uint8_t Export_IsBusy(void);
+void Export_Task(void);
+
+#endif
@@ -0,0 +1,285 @@
+#include "stm32f10x.h"
+#include "Journal.h"
+#include "Backup.h"
+
+/* BKP增量超过上限的3/4即尽快落盘，留出余量给落盘前到达的雨滴 */
+#define SHADOW_FORCE_DROPS      0xC000u
+#define SHADOW_FORCE_RAIN_UM    0xC000u
+#define SHADOW_FORCE_VOLT_DV    (BACKUP_SHADOW_VOLT_MAX * 3u / 4u)
+
+uint32_t journal_writes = 0;
+uint32_t journal_erases = 0;
+uint32_t journal_forced_erases = 0;
+uint32_t journal_errors = 0;
+uint16_t journal_seq = 0;
+
+static uint8_t cur_page = 0;             // 当前追加页
+static uint8_t cur_slot = 0;             // 当前页下一个空槽，JOURNAL_SLOTS_PER_PAGE表示已满
+static uint8_t next_page_ready = 0;      // 1：下一页已确认为空，可直接切换
+static uint8_t force_write = 0;          // 1：BKP增量将溢出或计数倒退，尽快写记录
+static uint16_t seconds_since_write = 0;
+static JournalTotals base;               // 最新一条记录的内容（BKP增量的基准）
+
+static uint32_t Slot_Address(uint8_t page, uint8_t slot)
+{
+    return JOURNAL_BASE + page * JOURNAL_PAGE_SIZE + slot * (JOURNAL_RECORD_WORDS * 4u);
+}
+
+static uint32_t Record_Crc(const uint32_t *words)
+{
+    CRC_ResetDR();
+    return CRC_CalcBlockCRC((uint32_t *)words, JOURNAL_RECORD_WORDS - 1);
+}
+
+static uint8_t Slot_IsBlank(uint8_t page, uint8_t slot)
+{
+    const uint32_t *w = (const uint32_t *)Slot_Address(page, slot);
+    uint8_t i;
+
+    for (i = 0; i < JOURNAL_RECORD_WORDS; i++)
+    {
+        if (w[i] != 0xFFFFFFFFu)
+            return 0;
+    }
+    return 1;
+}
+
+static uint8_t Page_IsBlank(uint8_t page)
+{
+    const uint32_t *w = (const uint32_t *)Slot_Address(page, 0);
+    uint16_t i;
+
+    for (i = 0; i < JOURNAL_PAGE_SIZE / 4u; i++)
+    {
+        if (w[i] != 0xFFFFFFFFu)
+            return 0;
+    }
+    return 1;
+}
+
+static void Page_Erase(uint8_t page, uint8_t quiet)
+{
+    FLASH_Unlock();
+    FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPRTERR);
+    if (FLASH_ErasePage(Slot_Address(page, 0)) != FLASH_COMPLETE)
+    {
+        journal_errors++;
+    }
+    FLASH_Lock();
+    journal_erases++;
+    if (!quiet)
+    {
+        journal_forced_erases++;
+    }
+}
+
+/**
+  * @brief  写一条日志记录到当前槽
+  * @retval 1：成功（回读CRC一致），0：失败（槽作废，下次写下一槽）
+  * @note   按半字编程，每半字约50us；CRC字最后写入，中途掉电的半条记录校验不过
+  */
+static uint8_t Record_Write(const JournalTotals *t, uint16_t seq)
+{
+    uint32_t words[JOURNAL_RECORD_WORDS];
+    uint32_t addr = Slot_Address(cur_page, cur_slot);
+    FLASH_Status status = FLASH_COMPLETE;
+    uint8_t i;
+
+    words[0] = JOURNAL_MAGIC | ((uint32_t)seq << 16);
+    words[1] = t->drops;
+    words[2] = t->rain_um;
+    words[3] = t->residual_nm;
+    words[4] = t->voltage_cv;
+    words[5] = Record_Crc(words);
+
+    FLASH_Unlock();
+    FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPRTERR);
+    for (i = 0; i < JOURNAL_RECORD_WORDS * 2 && status == FLASH_COMPLETE; i++)
+    {
+        uint16_t half = (uint16_t)(words[i >> 1] >> ((i & 1) * 16));
+        status = FLASH_ProgramHalfWord(addr + i * 2u, half);
+    }
+    FLASH_Lock();
+    cur_slot++;
+
+    if (status != FLASH_COMPLETE || ((const uint32_t *)addr)[JOURNAL_RECORD_WORDS - 1] != words[5])
+    {
+        journal_errors++;
+        return 0;
+    }
+    return 1;
+}
+
+/**
+  * @brief  上电扫描日志并恢复累计量
+  * @param  restored 输出：最新记录叠加BKP增量后的累计量（无记录时全0）
+  * @retval 1：找到有效记录，0：日志为空（首次上电或全部校验失败）
+  * @note   需在Backup_Init之后调用；扫描JOURNAL_PAGES*JOURNAL_SLOTS_PER_PAGE条记录，耗时<1ms
+  */
+uint8_t Journal_Init(JournalTotals *restored)
+{
+    JournalShadow shadow;
+    uint8_t page, slot;
+    uint8_t found = 0;
+    uint8_t best_page = 0, best_slot = 0;
+
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_CRC, ENABLE);
+
+    for (page = 0; page < JOURNAL_PAGES; page++)
+    {
+        for (slot = 0; slot < JOURNAL_SLOTS_PER_PAGE; slot++)
+        {
+            const uint32_t *w = (const uint32_t *)Slot_Address(page, slot);
+            uint16_t seq;
+
+            if ((w[0] & 0xFFFFu) != JOURNAL_MAGIC || w[JOURNAL_RECORD_WORDS - 1] != Record_Crc(w))
+                continue;
+            seq = (uint16_t)(w[0] >> 16);
+            /* 序号按16位环绕比较：日志总容量远小于32768条，不会误判 */
+            if (!found || (int16_t)(seq - journal_seq) > 0)
+            {
+                found = 1;
+                journal_seq = seq;
+                best_page = page;
+                best_slot = slot;
+            }
+        }
+    }
+
+    if (found)
+    {
+        const uint32_t *w = (const uint32_t *)Slot_Address(best_page, best_slot);
+
+        base.drops = w[1];
+        base.rain_um = w[2];
+        base.residual_nm = (uint16_t)w[3];
+        base.voltage_cv = w[4];
+
+        /* 追加位置：最新记录之后的第一个空槽（跳过掉电留下的半条记录） */
+        cur_page = best_page;
+        cur_slot = (uint8_t)(best_slot + 1);
+        while (cur_slot < JOURNAL_SLOTS_PER_PAGE && !Slot_IsBlank(cur_page, cur_slot))
+        {
+            cur_slot++;
+        }
+    }
+    else
+    {
+        base.drops = 0;
+        base.rain_um = 0;
+        base.residual_nm = 0;
+        base.voltage_cv = 0;
+        /* 视为停在最后一页末尾：首条记录写入第0页（非空则先擦除） */
+        cur_page = JOURNAL_PAGES - 1;
+        cur_slot = JOURNAL_SLOTS_PER_PAGE;
+    }
+    next_page_ready = Page_IsBlank((uint8_t)((cur_page + 1) % JOURNAL_PAGES));
+
+    *restored = base;
+    Backup_LoadJournalShadow(&shadow);
+    if (found && shadow.tag == (journal_seq & 0x0F))
+    {
+        restored->drops += shadow.drops;
+        restored->rain_um += shadow.rain_um;
+        restored->voltage_cv += (uint32_t)shadow.voltage_dv * 10u;
+    }
+    return found;
+}
+
+/**
+  * @brief  把当前累计量相对最新记录的增量写入BKP
+  * @param  totals 当前累计量
+  * @note   每次计数后调用，只写3个BKP寄存器；增量将溢出或计数倒退（命令清零）时置强制写标志
+  */
+void Journal_Shadow(const JournalTotals *totals)
+{
+    JournalShadow shadow;
+    uint32_t d_drops, d_rain, d_volt;
+
+    shadow.tag = (uint8_t)(journal_seq & 0x0F);
+    if (totals->drops < base.drops || totals->rain_um < base.rain_um || totals->voltage_cv < base.voltage_cv)
+    {
+        /* 计数被清零：增量无法表示，保持零增量并尽快写新记录 */
+        shadow.drops = 0;
+        shadow.rain_um = 0;
+        shadow.voltage_dv = 0;
+        force_write = 1;
+        Backup_SaveJournalShadow(&shadow);
+        return;
+    }
+
+    d_drops = totals->drops - base.drops;
+    d_rain = totals->rain_um - base.rain_um;
+    d_volt = (totals->voltage_cv - base.voltage_cv) / 10u;
+    if (d_drops >= SHADOW_FORCE_DROPS || d_rain >= SHADOW_FORCE_RAIN_UM || d_volt >= SHADOW_FORCE_VOLT_DV)
+    {
+        force_write = 1;
+    }
+    shadow.drops = (uint16_t)(d_drops > 0xFFFFu ? 0xFFFFu : d_drops);
+    shadow.rain_um = (uint16_t)(d_rain > 0xFFFFu ? 0xFFFFu : d_rain);
+    shadow.voltage_dv = (uint16_t)(d_volt > BACKUP_SHADOW_VOLT_MAX ? BACKUP_SHADOW_VOLT_MAX : d_volt);
+    Backup_SaveJournalShadow(&shadow);
+}
+
+/**
+  * @brief  日志维护（主循环每秒调用一次）
+  * @param  totals 当前累计量
+  * @param  quiet  1：安静期（无快照/捕获、最近1分钟无雨），允许擦页
+  * @note   只在主循环调用（与Telemetry_Send共用CRC单元）
+  */
+void Journal_Task(const JournalTotals *totals, uint8_t quiet)
+{
+    uint8_t next = (uint8_t)((cur_page + 1) % JOURNAL_PAGES);
+
+    if (seconds_since_write < 0xFFFFu)
+    {
+        seconds_since_write++;
+    }
+    Journal_Shadow(totals);
+
+    /* 安静期预擦下一页，写满当前页时可直接切换 */
+    if (!next_page_ready && quiet)
+    {
+        if (!Page_IsBlank(next))
+        {
+            Page_Erase(next, 1);
+        }
+        next_page_ready = 1;
+    }
+
+    if (totals->drops == base.drops && totals->rain_um == base.rain_um &&
+        totals->residual_nm == base.residual_nm && totals->voltage_cv == base.voltage_cv)
+    {
+        force_write = 0;
+        return;
+    }
+    if (!force_write && seconds_since_write < JOURNAL_PERIOD_S)
+    {
+        return;
+    }
+
+    if (cur_slot >= JOURNAL_SLOTS_PER_PAGE)
+    {
+        if (!next_page_ready)
+        {
+            if (!quiet && !force_write)
+            {
+                return;              // 降雨中且不紧急：推迟到安静期，增量仍在BKP中
+            }
+            Page_Erase(next, quiet);
+        }
+        cur_page = next;
+        cur_slot = 0;
+        next_page_ready = 0;
+    }
+
+    if (Record_Write(totals, (uint16_t)(journal_seq + 1)))
+    {
+        journal_seq++;
+        journal_writes++;
+        base = *totals;
+        force_write = 0;
+        seconds_since_write = 0;
+        Journal_Shadow(totals);      // 新记录已含全部增量：BKP归零并换标签
+    }
+}
@@ -0,0 +1,43 @@
+#ifndef __JOURNAL_H
+#define __JOURNAL_H
+
+#include <stdint.h>
+
+/*
+ * 累计量掉电保持（Flash追加日志 + BKP增量影子）
+ *   保留片内Flash最后JOURNAL_PAGES页（工程IROM相应缩小），按页轮转只追加写记录：
+ *     word0 = JOURNAL_MAGIC | seq<<16   word1 = 滴数   word2 = 雨量(um)
+ *     word3 = 不足1um余量(nm)           word4 = 累计电压(0.01V)   word5 = CRC32(word0~4)
+ *   上电扫描全部记录，取CRC有效且序号最新的一条，再叠加BKP DR6~DR8中的增量
+ *   （两次写日志之间的每滴增量只写BKP，不消耗Flash寿命）
+ *   写入节奏：计数变化后每JOURNAL_PERIOD_S秒批量写一条；BKP增量将溢出或计数被清零时尽快写
+ *   擦除：写满当前页前，在安静期（无快照、无捕获、最近1分钟无雨）预擦下一页；
+ *   擦页约20ms期间CPU取指停顿、ADC中断被推迟，仅在无法避免时（BKP增量溢出）才在降雨中擦除
+ */
+#define JOURNAL_PAGES           4
+#define JOURNAL_PAGE_SIZE       1024u
+#define JOURNAL_BASE            (0x08010000u - JOURNAL_PAGES * JOURNAL_PAGE_SIZE)  // 0x0800F000
+#define JOURNAL_RECORD_WORDS    6
+#define JOURNAL_SLOTS_PER_PAGE  (JOURNAL_PAGE_SIZE / (JOURNAL_RECORD_WORDS * 4u))  // 42
+#define JOURNAL_MAGIC           0x4A52u  // 'JR'
+#define JOURNAL_PERIOD_S        60       // 计数变化后的批量写入周期（秒）
+
+typedef struct
+{
+    uint32_t drops;                      // 雨滴计数
+    uint32_t rain_um;                    // 累计雨量（微米）
+    uint16_t residual_nm;                // 不足1um的余量（纳米）
+    uint32_t voltage_cv;                 // 累计电压（0.01V）
+} JournalTotals;
+
+extern uint32_t journal_writes;          // 已写记录数（本次上电）
+extern uint32_t journal_erases;          // 擦页次数（本次上电）
+extern uint32_t journal_forced_erases;   // 其中在非安静期被迫擦除的次数
+extern uint32_t journal_errors;          // 编程/擦除失败次数
+extern uint16_t journal_seq;             // 最新记录序号
+
+uint8_t Journal_Init(JournalTotals *restored);
+void Journal_Shadow(const JournalTotals *totals);
+void Journal_Task(const JournalTotals *totals, uint8_t quiet);
+
+#endif
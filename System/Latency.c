@@ -0,0 +1,134 @@
+#include "stm32f10x.h"
+#include "Latency.h"
+#include "Cycle.h"
+
+#define TICK_CYCLES             (LATENCY_TICK_US * CYCLES_PER_US)
+
+uint32_t latency_count = 0;
+uint32_t latency_last_us = 0;
+uint32_t latency_max_us = 0;
+
+static uint16_t latency_hist[LATENCY_BINS];
+
+/* 当前快照的触发时刻（一次只有一个快照在采集/等待处理，中断写、主循环读） */
+static volatile uint32_t trigger_tick = 0;
+static volatile uint32_t trigger_cycles = 0;
+static volatile uint8_t trigger_valid = 0;
+
+static uint8_t Latency_Bin(uint32_t us)
+{
+    uint8_t e = 2;
+    uint32_t bin;
+
+    if (us < 4u)
+        return (uint8_t)us;
+    while (e < 31 && (us >> (e + 1)) != 0)
+    {
+        e++;
+    }
+    bin = (uint32_t)(e - 1) * 4u + ((us >> (e - 2)) & 3u);
+    return (uint8_t)(bin < LATENCY_BINS ? bin : LATENCY_BINS - 1);
+}
+
+/* 第bin箱的上限（含） */
+static uint32_t Latency_BinUpper(uint8_t bin)
+{
+    uint8_t next = (uint8_t)(bin + 1);
+
+    if (next < 4)
+        return bin;
+    return ((4u + (next & 3u)) << (next / 4u - 1u)) - 1u;
+}
+
+/**
+  * @brief  记录快照触发时刻
+  * @param  tick            触发样本的采样计数
+  * @param  pending_samples 本DMA块中触发样本之后、尚未处理的样本数
+  * @note   在DMA中断中调用；块末样本约在中断时刻采集，较早的样本按42us/样本回推
+  */
+void Latency_MarkTrigger(uint32_t tick, uint16_t pending_samples)
+{
+    trigger_cycles = Cycle_Now() - (uint32_t)pending_samples * TICK_CYCLES;
+    trigger_tick = tick;
+    trigger_valid = 1;
+}
+
+/**
+  * @brief  雨滴计数时记录一次触发到计数的延迟
+  * @param  tick 当前采样计数
+  * @note   在主循环中调用；同一触发只记录一次
+  */
+void Latency_RecordCount(uint32_t tick)
+{
+    uint32_t now = Cycle_Now();
+    uint32_t us;
+    uint8_t bin, i;
+
+    if (!trigger_valid)
+        return;
+    trigger_valid = 0;
+
+    us = (tick - trigger_tick) * LATENCY_TICK_US;
+    if (us < LATENCY_DWT_MAX_US)
+    {
+        us = (now - trigger_cycles) / CYCLES_PER_US;
+    }
+
+    latency_count++;
+    latency_last_us = us;
+    if (us > latency_max_us)
+        latency_max_us = us;
+
+    bin = Latency_Bin(us);
+    if (latency_hist[bin] == 0xFFFFu)
+    {
+        for (i = 0; i < LATENCY_BINS; i++)
+        {
+            latency_hist[i] >>= 1;
+        }
+    }
+    latency_hist[bin]++;
+}
+
+/**
+  * @brief  延迟分位数
+  * @param  percent 1~100
+  * @retval 分位数所在箱的上限（us，不超过实测最大值）；尚无记录时返回0
+  */
+uint32_t Latency_Percentile(uint8_t percent)
+{
+    uint32_t total = 0, rank, acc = 0, upper;
+    uint8_t i;
+
+    for (i = 0; i < LATENCY_BINS; i++)
+    {
+        total += latency_hist[i];
+    }
+    if (total == 0)
+        return 0;
+
+    rank = (total * percent + 99u) / 100u;
+    if (rank == 0)
+        rank = 1;
+    for (i = 0; i < LATENCY_BINS - 1; i++)
+    {
+        acc += latency_hist[i];
+        if (acc >= rank)
+            break;
+    }
+    upper = Latency_BinUpper(i);
+    return (i == LATENCY_BINS - 1 || upper > latency_max_us) ? latency_max_us : upper;
+}
+
+void Latency_Reset(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < LATENCY_BINS; i++)
+    {
+        latency_hist[i] = 0;
+    }
+    latency_count = 0;
+    latency_last_us = 0;
+    latency_max_us = 0;
+}
@@ -0,0 +1,28 @@
+#ifndef __LATENCY_H
+#define __LATENCY_H
+
+#include <stdint.h>
+
+/*
+ * 触发到计数延迟统计
+ *   起点：触发快照的样本的采集时刻（DMA中断中按块内尚未处理的样本数回推DWT时间戳）
+ *   终点：主循环验证通过、雨滴计入drop_count的时刻
+ *   包含后触发采集（SNAPSHOT_POST_SAMPLES点）、等待主循环、验证处理及其间的死区/擦页等延迟
+ *   区间短于DWT回绕（59.6s）时用周期计数（us精度），否则退回采样计数（42us/样本）
+ *   对数分箱：每倍频程4箱，第b箱（b>=4）下限为(4+b%4)<<(b/4-1)us，相对分辨率12.5%~25%；
+ *   任一箱计数将饱和时全部减半，保持分布形状
+ */
+#define LATENCY_TICK_US         42u      // 每个采样计数的微秒数（与ADC_SAMPLE_INTERVAL_US一致）
+#define LATENCY_BINS            80       // 0us ~ 约2s，超出计入末箱
+#define LATENCY_DWT_MAX_US      50000000u  // 采样计数换算超过该值时不用DWT差值
+
+extern uint32_t latency_count;           // 已记录的雨滴数
+extern uint32_t latency_last_us;         // 最近一次延迟
+extern uint32_t latency_max_us;          // 最大延迟
+
+void Latency_MarkTrigger(uint32_t tick, uint16_t pending_samples);
+void Latency_RecordCount(uint32_t tick);
+uint32_t Latency_Percentile(uint8_t percent);
+void Latency_Reset(void);
+
+#endif
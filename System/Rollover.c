@@ -0,0 +1,113 @@
+#include "Rollover.h"
+#include "Clock.h"
+
+typedef struct
+{
+    uint32_t index;                      // 当前周期序号（本地时间/周期长度）
+    uint32_t start_rain_um;              // 周期开始时的累计雨量
+    uint32_t start_drops;                // 周期开始时的累计滴数
+    uint16_t peak_intensity;
+    uint8_t active;
+    uint8_t complete;                    // 1：从周期边界开始跟踪
+} PeriodTracker;
+
+static PeriodTracker trackers[ROLLOVER_KINDS];
+
+/* 已完成周期（小时与日可能在同一秒完成） */
+static RainPeriod pending[ROLLOVER_KINDS];
+static uint8_t pending_count = 0;
+
+static void Tracker_Start(PeriodTracker *t, uint32_t index, uint32_t rain_um, uint32_t drops, uint8_t complete)
+{
+    t->index = index;
+    t->start_rain_um = rain_um;
+    t->start_drops = drops;
+    t->peak_intensity = 0;
+    t->active = 1;
+    t->complete = complete;
+}
+
+/**
+  * @brief  重新开始跟踪（计数清零、时钟重设后调用）
+  * @note   下一次更新时以当时的累计量为起点，当前周期标记为不完整
+  */
+void Rollover_Restart(void)
+{
+    uint8_t k;
+
+    for (k = 0; k < ROLLOVER_KINDS; k++)
+    {
+        trackers[k].active = 0;
+    }
+}
+
+/**
+  * @brief  每秒更新（仅在时钟已设置时调用）
+  * @param  unix_now  当前UTC Unix秒
+  * @param  rain_um   当前累计雨量（微米）
+  * @param  drops     当前累计滴数
+  * @param  intensity 当前1分钟雨强（0.01mm/h）
+  */
+void Rollover_Update(uint32_t unix_now, uint32_t rain_um, uint32_t drops, uint16_t intensity)
+{
+    int32_t tz_seconds = (int32_t)Clock_TzMinutes() * 60;
+    uint32_t day_start = (uint32_t)Clock_DayStartHour() * 3600u;
+    uint32_t local = unix_now + (uint32_t)tz_seconds;
+    uint32_t index[ROLLOVER_KINDS];
+    uint32_t start[ROLLOVER_KINDS];
+    uint8_t k;
+
+    index[ROLLOVER_HOUR] = local / 3600u;
+    start[ROLLOVER_HOUR] = trackers[ROLLOVER_HOUR].index * 3600u - (uint32_t)tz_seconds;
+    index[ROLLOVER_DAY] = (local - day_start) / 86400u;
+    start[ROLLOVER_DAY] = trackers[ROLLOVER_DAY].index * 86400u + day_start - (uint32_t)tz_seconds;
+
+    for (k = 0; k < ROLLOVER_KINDS; k++)
+    {
+        PeriodTracker *t = &trackers[k];
+
+        if (!t->active || rain_um < t->start_rain_um || drops < t->start_drops)
+        {
+            Tracker_Start(t, index[k], rain_um, drops, 0);
+        }
+        else if (index[k] != t->index)
+        {
+            /* 只结转相邻周期；时钟跳变或日界改动则丢弃当前部分周期 */
+            if (index[k] == t->index + 1u && pending_count < ROLLOVER_KINDS)
+            {
+                RainPeriod *p = &pending[pending_count++];
+                p->start_unix = start[k];
+                p->rain_um = rain_um - t->start_rain_um;
+                p->drops = drops - t->start_drops;
+                p->peak_intensity = t->peak_intensity;
+                p->kind = k;
+                p->complete = t->complete;
+            }
+            Tracker_Start(t, index[k], rain_um, drops, (uint8_t)(index[k] == t->index + 1u));
+        }
+        if (intensity > t->peak_intensity)
+        {
+            t->peak_intensity = intensity;
+        }
+    }
+}
+
+/**
+  * @brief  取出一个已完成周期
+  * @param  period 输出
+  * @retval 1：取到，0：无
+  */
+uint8_t Rollover_Pop(RainPeriod *period)
+{
+    uint8_t i;
+
+    if (pending_count == 0)
+        return 0;
+    *period = pending[0];
+    pending_count--;
+    for (i = 0; i < pending_count; i++)
+    {
+        pending[i] = pending[i + 1];
+    }
+    return 1;
+}
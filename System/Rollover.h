@@ -0,0 +1,30 @@
+#ifndef __ROLLOVER_H
+#define __ROLLOVER_H
+
+#include <stdint.h>
+
+/*
+ * 按墙上时钟对齐的小时/日雨量结转
+ *   小时：本地整点；日：本地日界（Clock_DayStartHour，默认20时，即气象日）
+ *   每秒用当前累计雨量/滴数更新，跨过周期边界时产出上一周期的雨量、滴数与最大1分钟雨强
+ *   上电、命令清零、时钟重设或配置变更后的首个周期只覆盖部分时段，complete=0
+ */
+#define ROLLOVER_HOUR           0
+#define ROLLOVER_DAY            1
+#define ROLLOVER_KINDS          2
+
+typedef struct
+{
+    uint32_t start_unix;                 // 周期起点（UTC Unix秒）
+    uint32_t rain_um;                    // 周期雨量（微米）
+    uint32_t drops;                      // 周期滴数
+    uint16_t peak_intensity;             // 周期内最大1分钟雨强（0.01mm/h）
+    uint8_t kind;                        // ROLLOVER_HOUR / ROLLOVER_DAY
+    uint8_t complete;                    // 1：完整覆盖整个周期
+} RainPeriod;
+
+void Rollover_Restart(void);
+void Rollover_Update(uint32_t unix_now, uint32_t rain_um, uint32_t drops, uint16_t intensity);
+uint8_t Rollover_Pop(RainPeriod *period);
+
+#endif
@@ -0,0 +1,69 @@
+#include "stm32f10x.h"
+#include "StackMon.h"
+
+/* 栈区边界（startup_stm32f10x_md.s导出）：Stack_Mem为栈底，__initial_sp为栈顶 */
+extern uint32_t Stack_Mem[];
+extern uint32_t __initial_sp[];
+
+volatile uint8_t isr_depth = 0;
+volatile uint8_t isr_depth_max = 0;
+volatile uint32_t isr_nested_count = 0;
+
+static uint16_t stack_high_water = 0;    // 已确认的最大用量（字节）
+
+/**
+  * @brief  填充当前栈指针以下的栈区
+  * @note   main开头调用；之后也可在主循环中重新填充（中断帧只会压在当前栈指针之下，
+  *         返回后即释放，填充不会覆盖正在使用的数据）
+  */
+void StackMon_Paint(void)
+{
+    uint32_t *p = Stack_Mem;
+    uint32_t *end = (uint32_t *)__get_MSP() - STACKMON_MARGIN_WORDS;
+
+    while (p < end)
+    {
+        *p++ = STACKMON_PAINT;
+    }
+}
+
+/**
+  * @brief  扫描栈高水位
+  * @retval 填充以来的最大栈用量（字节）
+  * @note   从栈底向上找第一个被改写的字，耗时与未用过的栈成正比（最多Stack_Size/4个字）
+  */
+uint16_t StackMon_Scan(void)
+{
+    uint32_t *p = Stack_Mem;
+    uint16_t used;
+
+    while (p < __initial_sp && *p == STACKMON_PAINT)
+    {
+        p++;
+    }
+    used = (uint16_t)((uint32_t)(__initial_sp - p) * 4u);
+    if (used > stack_high_water)
+        stack_high_water = used;
+    return stack_high_water;
+}
+
+uint16_t StackMon_Size(void)
+{
+    return (uint16_t)((uint32_t)(__initial_sp - Stack_Mem) * 4u);
+}
+
+/**
+  * @brief  清除高水位与嵌套统计并重新填充
+  */
+void StackMon_Reset(void)
+{
+    uint32_t primask;
+
+    stack_high_water = 0;
+    StackMon_Paint();
+    primask = __get_PRIMASK();
+    __disable_irq();
+    isr_depth_max = isr_depth;
+    isr_nested_count = 0;
+    __set_PRIMASK(primask);
+}
@@ -0,0 +1,39 @@
+#ifndef __STACKMON_H
+#define __STACKMON_H
+
+#include <stdint.h>
+
+/*
+ * 栈水位与中断嵌套监测
+ *   主栈（MSP，主循环与所有中断共用）在main开头把当前栈指针以下全部填为STACKMON_PAINT，
+ *   之后从栈底向上找第一个被改写的字，得到上电以来的最大用量（高水位）
+ *   中断嵌套：外设中断入口ISR_ENTER()、出口ISR_EXIT()，记录最大嵌套层数与发生嵌套的次数
+ *   （高优先级中断在返回前已恢复计数，低优先级中断的读改写不会被打乱）
+ *   高水位+嵌套深度随STATUS帧发送；余量长期充足时可据此缩小startup中的Stack_Size
+ */
+#define STACKMON_PAINT          0xCDCDCDCDu
+#define STACKMON_MARGIN_WORDS   8        // 填充时在当前栈指针下方留出的字数
+
+extern volatile uint8_t isr_depth;           // 当前中断嵌套层数
+extern volatile uint8_t isr_depth_max;       // 最大嵌套层数
+extern volatile uint32_t isr_nested_count;   // 进入时已有其他中断在执行的次数
+
+#define ISR_ENTER()                                  \
+    do                                               \
+    {                                                \
+        uint8_t depth_ = (uint8_t)(isr_depth + 1);   \
+        isr_depth = depth_;                          \
+        if (depth_ > isr_depth_max)                  \
+            isr_depth_max = depth_;                  \
+        if (depth_ > 1)                              \
+            isr_nested_count++;                      \
+    } while (0)
+
+#define ISR_EXIT()              (isr_depth--)
+
+void StackMon_Paint(void);
+uint16_t StackMon_Scan(void);
+uint16_t StackMon_Size(void);
+void StackMon_Reset(void);
+
+#endif
@@ -0,0 +1,123 @@
+#include "stm32f10x.h"
+#include "Telemetry.h"
+#include "Serial.h"
+
+volatile uint8_t telemetry_vofa_mode = TELEMETRY_DEFAULT_VOFA;
+volatile uint8_t telemetry_live_codec = TELEMETRY_DEFAULT_LIVE_CODEC;
+volatile uint8_t telemetry_live_enabled = 1;
+volatile uint16_t telemetry_seq = 0;
+
+/* 多项式0x04C11DB7的4位查找表（软件CRC，供中断中组帧使用） */
+static const uint32_t crc_nibble_table[16] =
+{
+    0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9,
+    0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
+    0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61,
+    0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD
+};
+
+/* 组帧缓冲：按字对齐，CRC单元按32位字读取 */
+static uint32_t frame_words[(TELEMETRY_HEADER_SIZE + TELEMETRY_MAX_PAYLOAD + TELEMETRY_CRC_SIZE + 3) / 4];
+
+/**
+  * @brief  遥测初始化（开启CRC单元时钟）
+  */
+void Telemetry_Init(void)
+{
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_CRC, ENABLE);
+}
+
+uint8_t *Telemetry_PutU8(uint8_t *p, uint8_t v)
+{
+    *p++ = v;
+    return p;
+}
+
+uint8_t *Telemetry_PutU16(uint8_t *p, uint16_t v)
+{
+    *p++ = (uint8_t)v;
+    *p++ = (uint8_t)(v >> 8);
+    return p;
+}
+
+uint8_t *Telemetry_PutU32(uint8_t *p, uint32_t v)
+{
+    *p++ = (uint8_t)v;
+    *p++ = (uint8_t)(v >> 8);
+    *p++ = (uint8_t)(v >> 16);
+    *p++ = (uint8_t)(v >> 24);
+    return p;
+}
+
+/**
+  * @brief  组帧并非阻塞发送
+  * @param  prio    发送优先级（SERIAL_PRIO_xxx）
+  * @param  type    消息类型（TLM_TYPE_xxx）
+  * @param  payload 负载
+  * @param  len     负载长度（不超过TELEMETRY_MAX_PAYLOAD）
+  * @retval 1：已入队，0：超长或发送缓冲满被丢弃
+  * @note   仅在主循环调用（CRC单元与组帧缓冲不可重入）；丢弃的帧同样占用序号
+  */
+uint8_t Telemetry_Send(uint8_t prio, uint8_t type, const uint8_t *payload, uint16_t len)
+{
+    uint8_t *frame = (uint8_t *)frame_words;
+    uint16_t body = TELEMETRY_HEADER_SIZE + len;
+    uint16_t words = (body + 3) / 4;
+    uint16_t i;
+    uint32_t crc;
+
+    if (len > TELEMETRY_MAX_PAYLOAD)
+    {
+        return 0;
+    }
+
+    frame[0] = TELEMETRY_SYNC0;
+    frame[1] = TELEMETRY_SYNC1;
+    frame[2] = TELEMETRY_VERSION;
+    frame[3] = type;
+    Telemetry_PutU16(&frame[4], len);
+    Telemetry_PutU16(&frame[6], telemetry_seq);
+    telemetry_seq++;
+    for (i = 0; i < len; i++)
+    {
+        frame[TELEMETRY_HEADER_SIZE + i] = payload[i];
+    }
+    for (i = body; i < words * 4; i++)
+    {
+        frame[i] = 0;                    // 补齐到整字，仅参与CRC
+    }
+
+    CRC_ResetDR();
+    crc = CRC_CalcBlockCRC(frame_words, words);
+    Telemetry_PutU32(&frame[body], crc);  // 覆盖补齐字节，CRC紧跟负载
+
+    return Serial_Write(prio, frame, body + TELEMETRY_CRC_SIZE);
+}
+
+/**
+  * @brief  软件计算与CRC单元相同的CRC32
+  * @param  data 数据（按小端32位字处理，末尾不足4字节补0）
+  * @param  len  字节数
+  * @note   不使用CRC单元，可在中断中调用（CRC单元由主循环的Telemetry_Send独占）
+  */
+uint32_t Telemetry_SoftCrc(const uint8_t *data, uint16_t len)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    uint16_t i;
+    uint8_t k;
+
+    for (i = 0; i < len; i += 4)
+    {
+        uint32_t word = 0;
+        for (k = 0; k < 4 && i + k < len; k++)
+        {
+            word |= (uint32_t)data[i + k] << (8 * k);
+        }
+        crc ^= word;
+        for (k = 0; k < 8; k++)
+        {
+            crc = (crc << 4) ^ crc_nibble_table[crc >> 28];
+        }
+    }
+    return crc;
+}
@@ -0,0 +1,62 @@
+#ifndef __TELEMETRY_H
+#define __TELEMETRY_H
+
+#include <stdint.h>
+
+/*
+ * 遥测帧格式（小端）：
+ *   [0]   0xA5        同步字0
+ *   [1]   0x5A        同步字1
+ *   [2]   版本         TELEMETRY_VERSION
+ *   [3]   类型         TLM_TYPE_xxx
+ *   [4-5] 负载长度     uint16
+ *   [6-7] 序号         uint16，每发出（或因缓冲满丢弃）一帧加1，主机据此检测丢帧
+ *   [8..] 负载
+ *   [末4] CRC32        STM32 CRC单元：多项式0x04C11DB7，初值0xFFFFFFFF，按32位小端字输入，
+ *                      覆盖帧头+负载，末尾不足4字节补0参与计算（补齐字节不发送）
+ */
+#define TELEMETRY_SYNC0         0xA5
+#define TELEMETRY_SYNC1         0x5A
+#define TELEMETRY_VERSION       2        // 2：LIVE负载改为抽取桶（均值/最小/最大）
+#define TELEMETRY_HEADER_SIZE   8
+#define TELEMETRY_CRC_SIZE      4
+#define TELEMETRY_MAX_PAYLOAD   128
+
+/* 消息类型 */
+#define TLM_TYPE_LIVE           0x01     // 抽取后的示波桶
+#define TLM_TYPE_EVENT          0x02     // 有效雨滴事件
+#define TLM_TYPE_STATS          0x03     // 每秒统计
+#define TLM_TYPE_SNAPSHOT       0x04     // 快照处理结果
+#define TLM_TYPE_STATUS         0x05     // 设备状态
+#define TLM_TYPE_LIVE_CODEC     0x06     // 抽取后的示波桶（三列Codec压缩块）
+#define TLM_TYPE_RAW            0x07     // 原始采样捕获块（中断中组帧，序号独立计数）
+#define TLM_TYPE_REPLY          0x08     // 命令应答（ASCII）
+#define TLM_TYPE_DROPSIZE       0x09     // 滴谱（体积对数分箱计数）
+#define TLM_TYPE_PERIOD         0x0A     // 整点/日界结转的小时/日雨量
+#define TLM_TYPE_LOG            0x0B     // 事件日志批量下载（导出优先级）
+
+/* 兼容模式：1=输出VOFA+ JustFloat裸帧（旧格式），0=输出遥测帧 */
+#ifndef TELEMETRY_DEFAULT_VOFA
+#define TELEMETRY_DEFAULT_VOFA  0
+#endif
+
+/* 示波数据压缩：1=LIVE_CODEC帧，0=LIVE原始帧 */
+#ifndef TELEMETRY_DEFAULT_LIVE_CODEC
+#define TELEMETRY_DEFAULT_LIVE_CODEC  1
+#endif
+
+extern volatile uint8_t telemetry_vofa_mode;
+extern volatile uint8_t telemetry_live_codec;
+extern volatile uint8_t telemetry_live_enabled;   // 示波流开关（命令stream live on|off）
+extern volatile uint16_t telemetry_seq;
+
+void Telemetry_Init(void);
+uint8_t Telemetry_Send(uint8_t prio, uint8_t type, const uint8_t *payload, uint16_t len);
+uint32_t Telemetry_SoftCrc(const uint8_t *data, uint16_t len);
+
+/* 负载小端打包辅助 */
+uint8_t *Telemetry_PutU8(uint8_t *p, uint8_t v);
+uint8_t *Telemetry_PutU16(uint8_t *p, uint16_t v);
+uint8_t *Telemetry_PutU32(uint8_t *p, uint32_t v);
+
+#endif
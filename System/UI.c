@@ -0,0 +1,204 @@
+#include "stm32f10x.h"
+#include "UI.h"
+#include "OLED.h"
+#include "Key.h"
+#include "RainStats.h"
+#include "DropSize.h"
+#include "Detector.h"
+#include "Arena.h"
+
+/* 主程序中的运行变量 */
+extern volatile uint16_t dynamic_threshold;
+extern volatile uint16_t noise_mad_estimate;
+extern volatile uint32_t drop_count;
+extern volatile uint32_t total_rain_um;
+extern volatile uint32_t snapshot_valid_count;
+extern volatile uint32_t watchdog_trigger_count;
+
+static uint8_t ui_page = UI_PAGE_LIVE;
+
+/* 定点数显示：Value/100，整数Digits位 + '.' + 2位小数 */
+static void UI_ShowFixed2(uint8_t Line, uint8_t Column, uint32_t Value, uint8_t Digits)
+{
+    OLED_ShowNum(Line, Column, Value / 100, Digits);
+    OLED_ShowChar(Line, (uint8_t)(Column + Digits), '.');
+    OLED_ShowNum(Line, (uint8_t)(Column + Digits + 1), Value % 100, 2);
+}
+
+/* 绘制当前页的静态标签 */
+static void UI_DrawLabels(void)
+{
+    OLED_ClearBuffer();
+    switch (ui_page)
+    {
+    case UI_PAGE_LIVE:
+        OLED_ShowString(1, 1, "Peak:");      // 合并通道峰值
+        OLED_ShowString(1, 11, "G:");        // 当前增益标记
+        OLED_ShowString(2, 1, "Volt:");      // 合并通道峰值电压
+        OLED_ShowString(3, 1, "Rain:");      // 降雨强度
+        OLED_ShowString(3, 14, "mm/h");
+        OLED_ShowString(4, 1, "Sum:");       // 累计电压
+        OLED_ShowString(4, 13, "V");
+        break;
+    case UI_PAGE_TREND:
+        OLED_ShowString(1, 1, "60m");        // 右侧为窗口内最大1分钟雨强（mm/h）
+        break;
+    case UI_PAGE_DSD:
+        OLED_ShowString(1, 1, "DSD n=");     // 本统计周期滴数
+        break;
+    case UI_PAGE_NOISE:
+        OLED_ShowString(1, 1, "Thr:");
+        OLED_ShowString(2, 1, "MAD:");
+        OLED_ShowString(3, 1, "Base:");
+        OLED_ShowString(4, 1, "AWD:");
+        break;
+    default:
+        OLED_ShowString(1, 1, "Drop:");
+        OLED_ShowString(2, 1, "Tot:");
+        OLED_ShowString(2, 14, "mm");
+        OLED_ShowString(3, 1, "Day:");
+        OLED_ShowString(3, 11, "mm");
+        OLED_ShowString(4, 1, "Vld:");
+        break;
+    }
+}
+
+/* 趋势页：最近60个完整分钟的雨强，每分钟2列，右侧最新，按窗口最大值自动缩放 */
+static void UI_RenderTrend(void)
+{
+    uint32_t *cmh = arena_work.trend_cmh;  // 主循环临时区，不占栈
+    uint32_t max = 0;
+    uint8_t i;
+
+    for (i = 0; i < UI_TREND_MINUTES; i++)
+    {
+        const RainBucket *b = RainStats_Bucket(RAIN_LEVEL_MIN, (uint8_t)(UI_TREND_MINUTES - 1 - i));
+
+        /* 1分钟雨量(nm) -> 雨强(0.01mm/h)：nm*60/1e6*100 */
+        cmh[i] = (b != 0) ? b->depth_nm * 6u / 1000u : 0;
+        if (cmh[i] > max)
+            max = cmh[i];
+    }
+    UI_ShowFixed2(1, 8, max > 99999u ? 99999u : max, 3);
+
+    for (i = 0; i < UI_TREND_MINUTES; i++)
+    {
+        uint8_t h = (max == 0) ? 0 : (uint8_t)((cmh[i] * (UI_GRAPH_PAGES * 8u) + max - 1u) / max);
+        uint8_t x = (uint8_t)(4 + i * 2);
+
+        OLED_DrawBar(x, UI_GRAPH_PAGE, UI_GRAPH_PAGES, h);
+        OLED_DrawBar((uint8_t)(x + 1), UI_GRAPH_PAGE, UI_GRAPH_PAGES, h);
+    }
+}
+
+/* 滴谱页：DROP_HIST_BINS个柱，每柱10列宽、间隔2列，按最大箱缩放 */
+static void UI_RenderDsd(void)
+{
+    uint32_t total = 0;
+    uint16_t max = 0;
+    uint8_t i, k;
+
+    for (i = 0; i < DROP_HIST_BINS; i++)
+    {
+        total += drop_histogram[i];
+        if (drop_histogram[i] > max)
+            max = drop_histogram[i];
+    }
+    OLED_ShowNum(1, 7, total, 5);
+
+    for (i = 0; i < DROP_HIST_BINS; i++)
+    {
+        uint8_t h = (max == 0) ? 0 :
+            (uint8_t)(((uint32_t)drop_histogram[i] * (UI_GRAPH_PAGES * 8u) + max - 1u) / max);
+        uint8_t x = (uint8_t)(4 + i * 12);
+
+        for (k = 0; k < 10; k++)
+        {
+            OLED_DrawBar((uint8_t)(x + k), UI_GRAPH_PAGE, UI_GRAPH_PAGES, h);
+        }
+    }
+}
+
+/**
+  * @brief  界面初始化：绘制实时页标签
+  * @note   需在OLED_Init之后调用
+  */
+void UI_Init(void)
+{
+    ui_page = UI_PAGE_LIVE;
+    UI_DrawLabels();
+    OLED_Flush();
+}
+
+/**
+  * @brief  处理按键事件（主循环每次调用）
+  * @retval 1：页面已切换，应立即渲染
+  */
+uint8_t UI_HandleKeys(void)
+{
+    uint8_t changed = 0;
+    uint8_t ev;
+
+    while ((ev = Key_GetEvent()) != KEY_NONE)
+    {
+        if (ev == KEY_1)
+            ui_page = (uint8_t)((ui_page + 1) % UI_PAGE_COUNT);
+        else if (ev == KEY_2)
+            ui_page = (uint8_t)((ui_page + UI_PAGE_COUNT - 1) % UI_PAGE_COUNT);
+        else if (ev == (KEY_1 | KEY_EVENT_LONG))
+            ui_page = UI_PAGE_LIVE;
+        else
+            continue;
+        changed = 1;
+    }
+    if (changed)
+        UI_DrawLabels();
+    return changed;
+}
+
+/**
+  * @brief  渲染当前页并刷新
+  * @param  live 实时页数值
+  */
+void UI_Render(const UiLive *live)
+{
+    switch (ui_page)
+    {
+    case UI_PAGE_LIVE:
+        OLED_ShowNum(1, 6, live->peak, 5);
+        OLED_ShowChar(1, 14, live->gain);
+        UI_ShowFixed2(2, 6, live->volt_cv, 2);
+        UI_ShowFixed2(3, 7, live->intensity_cmh, 3);
+        UI_ShowFixed2(4, 6, live->sum_cv, 3);
+        break;
+    case UI_PAGE_TREND:
+        UI_RenderTrend();
+        break;
+    case UI_PAGE_DSD:
+        UI_RenderDsd();
+        break;
+    case UI_PAGE_NOISE:
+        OLED_ShowNum(1, 6, dynamic_threshold, 4);
+        OLED_ShowNum(2, 6, noise_mad_estimate, 4);
+        OLED_ShowNum(3, 6, Peak_Detector_GetBaseline(), 4);
+        OLED_ShowNum(4, 6, watchdog_trigger_count, 8);
+        break;
+    default:
+        OLED_ShowNum(1, 6, drop_count, 8);
+        {
+            uint32_t um = total_rain_um;
+            OLED_ShowNum(2, 5, um / 1000u, 5);
+            OLED_ShowChar(2, 10, '.');
+            OLED_ShowNum(2, 11, um % 1000u, 3);
+        }
+        UI_ShowFixed2(3, 5, RainStats_CurrentUm(RAIN_LEVEL_DAY) / 10u, 3);
+        OLED_ShowNum(4, 5, snapshot_valid_count, 8);
+        break;
+    }
+    OLED_Flush();
+}
+
+uint8_t UI_Page(void)
+{
+    return ui_page;
+}
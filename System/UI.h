@@ -0,0 +1,38 @@
+#ifndef __UI_H
+#define __UI_H
+
+#include <stdint.h>
+
+/*
+ * OLED多页界面（渲染到帧缓冲，OLED_Flush只发送变化的8列块）
+ *   页面：实时值 / 60分钟雨强趋势 / 滴谱柱状图 / 噪声与阈值 / 计数器
+ *   按键1短按下一页，按键2短按上一页，按键1长按回到实时页
+ *   图形页每列只改写变化的字节，与文字页一样只在数据变化时产生I2C传输
+ */
+#define UI_PAGE_LIVE            0
+#define UI_PAGE_TREND           1
+#define UI_PAGE_DSD             2
+#define UI_PAGE_NOISE           3
+#define UI_PAGE_COUNTERS        4
+#define UI_PAGE_COUNT           5
+
+#define UI_TREND_MINUTES        60       // 趋势页分钟数（每分钟2列）
+#define UI_GRAPH_PAGE           2        // 图形区顶部页（第1行文字占0~1页）
+#define UI_GRAPH_PAGES          6        // 图形区页数（48像素高）
+
+/* 实时页数值（由主程序提供，定点整数） */
+typedef struct
+{
+    uint16_t peak;                       // 峰值ADC值
+    char gain;                           // 增益标记
+    uint16_t volt_cv;                    // 峰值电压（0.01V）
+    uint16_t intensity_cmh;              // 雨强（0.01mm/h）
+    uint16_t sum_cv;                     // 累计电压（0.01V）
+} UiLive;
+
+void UI_Init(void);
+uint8_t UI_HandleKeys(void);
+void UI_Render(const UiLive *live);
+uint8_t UI_Page(void);
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef __TEST_COMMON_H
+#define __TEST_COMMON_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+/*
+ * 单元测试公共工具：失败只计数不中止，main最后用TEST_RESULT()返回进程退出码
+ *   合成信号：固定种子的基线噪声与分段线性雨滴脉冲（线性上升→平顶→线性回落），结果可复现
+ */
+static int test_failures = 0;
+
+#define CHECK(cond)                                                              \
+    do                                                                           \
+    {                                                                            \
+        if (!(cond))                                                             \
+        {                                                                        \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            test_failures++;                                                     \
+        }                                                                        \
+    } while (0)
+
+#define CHECK_EQ(a, b)                                                           \
+    do                                                                           \
+    {                                                                            \
+        long a_ = (long)(a), b_ = (long)(b);                                     \
+        if (a_ != b_)                                                            \
+        {                                                                        \
+            fprintf(stderr, "%s:%d: %s == %s failed (%ld != %ld)\n",             \
+                    __FILE__, __LINE__, #a, #b, a_, b_);                         \
+            test_failures++;                                                     \
+        }                                                                        \
+    } while (0)
+
+#define TEST_RESULT()                                                            \
+    (test_failures ? (fprintf(stderr, "%d check(s) failed\n", test_failures), 1) : 0)
+
+static uint32_t test_rng = 12345u;
+
+/* 基线加±spread均匀噪声（线性同余，固定种子） */
+static inline uint16_t Test_Noise(uint16_t base, uint16_t spread)
+{
+    test_rng = test_rng * 1103515245u + 12345u;
+    if (spread == 0)
+        return base;
+    return (uint16_t)(base - spread + (uint16_t)((test_rng >> 16) % (2u * spread + 1u)));
+}
+
+static inline void Test_FillNoise(uint16_t *buf, uint32_t len, uint16_t base, uint16_t spread)
+{
+    uint32_t i;
+
+    for (i = 0; i < len; i++)
+        buf[i] = Test_Noise(base, spread);
+}
+
+/**
+  * 在buf[at]处叠加一个雨滴脉冲：rise个样本每个上升rise_step，平顶plateau个样本，
+  * 再每个样本回落fall_step直到回到原值；返回峰值所在索引
+  */
+static inline uint32_t Test_AddDrop(uint16_t *buf, uint32_t len, uint32_t at,
+                                    uint16_t rise, uint16_t rise_step, uint16_t plateau, uint16_t fall_step)
+{
+    uint32_t i = at;
+    uint32_t k;
+    uint32_t peak = at + rise;
+    int32_t add = 0;
+
+    for (k = 1; k <= rise && i < len; k++, i++)
+    {
+        add = (int32_t)k * rise_step;
+        buf[i] = (uint16_t)(buf[i] + add);
+    }
+    for (k = 0; k < plateau && i < len; k++, i++)
+        buf[i] = (uint16_t)(buf[i] + add);
+    while (add > 0 && i < len)
+    {
+        add -= fall_step;
+        if (add > 0)
+            buf[i] = (uint16_t)(buf[i] + add);
+        i++;
+    }
+    return peak - 1;
+}
+
+#endif
@@ -0,0 +1,74 @@
+#include "test_common.h"
+#include "Pack12.h"
+
+#define N 101
+
+/* 任意起点/长度打包后逐点与成块解包结果一致，相邻样本不被改写 */
+static void Test_RoundTrip(void)
+{
+    static const uint8_t fill[3] = { 0xA5, 0xA5, 0xA5 };
+    uint8_t packed[PACK12_BYTES(N)];
+    uint16_t src[N], dst[N];
+    uint16_t start, count, i;
+
+    for (start = 0; start < 4; start++)
+    {
+        for (count = 0; count + start <= N; count += 7)
+        {
+            for (i = 0; i < sizeof(packed); i++)
+                packed[i] = 0xA5;
+            for (i = 0; i < N; i++)
+                src[i] = (uint16_t)((i * 2654435761u) >> 20) & 0x0FFFu;
+
+            Pack12_Pack(packed, start, src, count);
+            Pack12_Unpack(dst, packed, start, count);
+            for (i = 0; i < count; i++)
+            {
+                CHECK_EQ(dst[i], src[i]);
+                CHECK_EQ(Pack12_Get(packed, (uint16_t)(start + i)), src[i]);
+            }
+            if (start > 0)
+                CHECK_EQ(Pack12_Get(packed, (uint16_t)(start - 1)), Pack12_Get(fill, (uint16_t)((start - 1) & 1)));
+            if (start + count < N)
+                CHECK_EQ(Pack12_Get(packed, (uint16_t)(start + count)), Pack12_Get(fill, (uint16_t)((start + count) & 1)));
+        }
+    }
+}
+
+/* 环形写入跨越末尾回绕，读出顺序不变 */
+static void Test_Ring(void)
+{
+    enum { RING = 40 };
+    uint8_t ring[PACK12_BYTES(RING)];
+    uint16_t src[30], dst[30];
+    uint16_t i;
+
+    for (i = 0; i < 30; i++)
+        src[i] = (uint16_t)(100 + i * 37);
+    Pack12_PackRing(ring, RING, 26, src, 30);
+    Pack12_UnpackRing(dst, ring, RING, 26, 30);
+    for (i = 0; i < 30; i++)
+        CHECK_EQ(dst[i], src[i]);
+    CHECK_EQ(Pack12_Get(ring, 0), src[14]);
+}
+
+/* 只保留低12位 */
+static void Test_Mask(void)
+{
+    uint8_t buf[PACK12_BYTES(2)] = { 0, 0, 0 };
+
+    Pack12_Put(buf, 0, 0xFFFF);
+    CHECK_EQ(Pack12_Get(buf, 0), 0x0FFF);
+    CHECK_EQ(Pack12_Get(buf, 1), 0);
+    Pack12_Put(buf, 1, 0x1234);
+    CHECK_EQ(Pack12_Get(buf, 0), 0x0FFF);
+    CHECK_EQ(Pack12_Get(buf, 1), 0x0234);
+}
+
+int main(void)
+{
+    Test_RoundTrip();
+    Test_Ring();
+    Test_Mask();
+    return TEST_RESULT();
+}
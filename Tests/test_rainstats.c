@@ -0,0 +1,106 @@
+#include "test_common.h"
+#include "RainStats.h"
+#include "DropSize.h"
+
+/* 1秒对应的采样计数（向上取整） */
+#define TICKS_PER_SECOND ((1000000u + RAINSTATS_TICK_US - 1u) / RAINSTATS_TICK_US)
+
+static void Test_DropSize(void)
+{
+    uint16_t a;
+    uint32_t prev = 0;
+
+    CHECK_EQ(DropSize_VolumeNl(0), 0);
+    CHECK_EQ(DropSize_VolumeNl(100), 524);
+    CHECK_EQ(DropSize_VolumeNl(400), 4189);
+    for (a = 0; a < 4096; a++)
+    {
+        uint32_t v = DropSize_VolumeNl(a);
+        if (v < prev)
+        {
+            CHECK(v >= prev);
+            break;
+        }
+        prev = v;
+    }
+    CHECK_EQ(DropSize_DepthNm(4189), 4189u * 1000u / DROP_COLLECTOR_AREA_MM2);
+
+    DropSize_ClearHistogram();
+    DropSize_Record(0);
+    DropSize_Record(DROP_HIST_MIN_NL);
+    DropSize_Record(DROP_HIST_MIN_NL * 2 - 1);
+    DropSize_Record(0xFFFFFFFFu);
+    CHECK_EQ(drop_histogram[0], 1);
+    CHECK_EQ(drop_histogram[1], 2);
+    CHECK_EQ(drop_histogram[DROP_HIST_BINS - 1], 1);
+    DropSize_ClearHistogram();
+    CHECK_EQ(drop_histogram[1], 0);
+}
+
+static void Test_Cascade(void)
+{
+    uint32_t tick = 1000;
+    uint16_t i;
+
+    RainStats_Reset(tick);
+    for (i = 0; i < 60; i++)
+        RainStats_AddDrop(1000);
+    CHECK_EQ(RainStats_CurrentDrops(RAIN_LEVEL_SEC), 60);
+    CHECK_EQ(RainStats_CurrentUm(RAIN_LEVEL_DAY), 60);
+    CHECK(RainStats_Bucket(RAIN_LEVEL_SEC, 0) == 0);
+
+    /* 1秒后：60000nm落在最近1分钟窗口内 → 60000*3600/60 nm/h = 3.6mm/h */
+    tick += TICKS_PER_SECOND;
+    RainStats_Advance(tick);
+    CHECK_EQ(RainStats_Intensity1Min(), 360);
+    CHECK_EQ(RainStats_CurrentDrops(RAIN_LEVEL_SEC), 0);
+    CHECK_EQ(RainStats_CurrentDrops(RAIN_LEVEL_MIN), 60);
+    CHECK(RainStats_Bucket(RAIN_LEVEL_SEC, 0) != 0);
+    CHECK_EQ(RainStats_Bucket(RAIN_LEVEL_SEC, 0)->drops, 60);
+
+    /* 满1分钟：结转到分钟级，10/60分钟窗口与小时峰值更新 */
+    for (i = 1; i < 60; i++)
+    {
+        tick += TICKS_PER_SECOND;
+        RainStats_Advance(tick);
+    }
+    CHECK(RainStats_Bucket(RAIN_LEVEL_MIN, 0) != 0);
+    CHECK_EQ(RainStats_Bucket(RAIN_LEVEL_MIN, 0)->depth_nm, 60000);
+    CHECK_EQ(RainStats_Bucket(RAIN_LEVEL_MIN, 0)->drops, 60);
+    CHECK_EQ(RainStats_Intensity1Min(), 360);
+    CHECK_EQ(RainStats_Intensity10Min(), 36);
+    CHECK_EQ(RainStats_Intensity60Min(), 6);
+    CHECK_EQ(RainStats_PeakIntensity(RAIN_LEVEL_HOUR), 360);
+    CHECK_EQ(RainStats_PeakIntensity(RAIN_LEVEL_DAY), 360);
+    CHECK_EQ(RainStats_CurrentDrops(RAIN_LEVEL_HOUR), 60);
+    CHECK_EQ(RainStats_CurrentDrops(RAIN_LEVEL_MIN), 0);
+
+    /* 再过1秒：最早的秒桶出窗 */
+    tick += TICKS_PER_SECOND;
+    RainStats_Advance(tick);
+    CHECK_EQ(RainStats_Intensity1Min(), 0);
+    CHECK_EQ(RainStats_Intensity60Min(), 6);
+}
+
+/* 一次推进跨越多秒（主循环停顿）与采样计数回绕 */
+static void Test_Advance(void)
+{
+    uint32_t tick = 0xFFFFFFFFu - TICKS_PER_SECOND / 2;
+
+    RainStats_Reset(tick);
+    RainStats_AddDrop(5000);
+    tick += 3 * TICKS_PER_SECOND;
+    RainStats_Advance(tick);
+    CHECK(RainStats_Bucket(RAIN_LEVEL_SEC, 2) != 0);
+    CHECK_EQ(RainStats_Bucket(RAIN_LEVEL_SEC, 2)->depth_nm, 5000);
+    CHECK_EQ(RainStats_Bucket(RAIN_LEVEL_SEC, 0)->depth_nm, 0);
+    CHECK_EQ(RainStats_CurrentUm(RAIN_LEVEL_MIN), 5);
+}
+
+int main(void)
+{
+    Test_DropSize();
+    Test_Cascade();
+    Test_Advance();
+    return TEST_RESULT();
+}
@@ -0,0 +1,118 @@
+#include <stdlib.h>
+#include "test_common.h"
+#include "Replay.h"
+#include "RainStats.h"
+
+#define SAMPLE_RATE     (1000000u / RAINSTATS_TICK_US)
+#define STREAM_SECONDS  10
+#define STREAM_LEN      (SAMPLE_RATE * STREAM_SECONDS)
+#define MAX_EVENTS      64
+
+static uint16_t stream[STREAM_LEN];
+static ReplayEvent events[MAX_EVENTS];
+static uint32_t event_count;
+
+static void On_Event(void *user, const ReplayEvent *ev)
+{
+    (void)user;
+    if (event_count < MAX_EVENTS)
+        events[event_count++] = *ev;
+}
+
+/**
+  * 每秒一滴（第8滴后100ms再补一滴，落在事件级死区内），按任意长度分段送入
+  * 起点放在DMA块内第10个样本：看门狗触发对齐到越界样本所在块的起点，
+  * 起点靠后的慢上升脉冲峰值会落到2ms前部窗口之外而被拒绝（固件行为，回放如实再现）
+  */
+static void Test_Stream(void)
+{
+    uint32_t labels[STREAM_SECONDS + 1];
+    uint32_t label_count = 0;
+    uint32_t s, pos = 0, chunk = 1;
+    ReplayMatch m;
+    uint8_t outcome[STREAM_SECONDS + 1];
+    const ReplayStats *st;
+
+    Test_FillNoise(stream, STREAM_LEN, 300, 2);
+    for (s = 1; s < STREAM_SECONDS; s++)
+    {
+        uint32_t at = (s * SAMPLE_RATE / DETECTOR_BLOCK_SAMPLES) * DETECTOR_BLOCK_SAMPLES + 10;
+
+        Test_AddDrop(stream, STREAM_LEN, at, 20, 40, 4, 25);
+        labels[label_count++] = at;
+        if (s == 8)
+        {
+            at += SAMPLE_RATE / 10;
+            Test_AddDrop(stream, STREAM_LEN, at, 20, 40, 4, 25);
+            labels[label_count++] = at;
+        }
+    }
+
+    event_count = 0;
+    Replay_Init(0, On_Event, 0);
+    while (pos < STREAM_LEN)
+    {
+        uint32_t n = (STREAM_LEN - pos < chunk) ? STREAM_LEN - pos : chunk;
+
+        Replay_Feed(&stream[pos], n);
+        pos += n;
+        chunk = chunk * 3 + 1;           // 与块边界不对齐的分段
+        if (chunk > 5000)
+            chunk = 7;
+    }
+
+    st = Replay_Stats();
+    CHECK_EQ(st->samples, STREAM_LEN - STREAM_LEN % DETECTOR_BLOCK_SAMPLES);
+    CHECK_EQ(st->loops, st->samples * RAINSTATS_TICK_US / REPLAY_LOOP_US);
+    CHECK_EQ(drop_count, STREAM_SECONDS - 1);
+    CHECK(snapshot_deadtime_drops >= 1);
+    CHECK(total_rain_um > 0);
+
+    Replay_Match(events, event_count, labels, label_count, 120, &m, outcome);
+    CHECK_EQ(m.labels, label_count);
+    CHECK_EQ(m.counted, STREAM_SECONDS - 1);
+    CHECK_EQ(m.deadtime, 1);
+    CHECK_EQ(m.missed, 0);
+    CHECK_EQ(m.false_counts, 0);
+    CHECK_EQ(outcome[8], REPLAY_DEADTIME);
+
+    /* 看门狗触发落在越界样本所在块的起点，主循环在下一个10ms节拍判定 */
+    for (s = 0; s < event_count; s++)
+    {
+        CHECK_EQ(events[s].trigger_tick % DETECTOR_BLOCK_SAMPLES, 0);
+        CHECK(events[s].judged_tick - events[s].trigger_tick >= SNAPSHOT_POST_SAMPLES - 1);
+        CHECK(events[s].judged_tick - events[s].trigger_tick <
+              SNAPSHOT_POST_SAMPLES + DETECTOR_BLOCK_SAMPLES + REPLAY_LOOP_US / RAINSTATS_TICK_US + 1);
+    }
+}
+
+/* 标注比对：漏触发、误计数与容差边界 */
+static void Test_Match(void)
+{
+    ReplayEvent ev[4] = { { 0 } };
+    uint32_t labels[4] = { 1000, 5000, 9000, 20000 };
+    uint8_t outcome[4];
+    ReplayMatch m;
+
+    ev[0].trigger_tick = 950;   ev[0].decision = REPLAY_COUNTED;
+    ev[1].trigger_tick = 5100;  ev[1].decision = REPLAY_REJECTED;
+    ev[2].trigger_tick = 12000; ev[2].decision = REPLAY_COUNTED;
+    ev[3].trigger_tick = 20120; ev[3].decision = REPLAY_COUNTED;
+
+    Replay_Match(ev, 4, labels, 4, 120, &m, outcome);
+    CHECK_EQ(m.counted, 2);
+    CHECK_EQ(m.rejected, 1);
+    CHECK_EQ(m.missed, 1);
+    CHECK_EQ(m.false_counts, 1);
+    CHECK_EQ(outcome[0], REPLAY_COUNTED);
+    CHECK_EQ(outcome[1], REPLAY_REJECTED);
+    CHECK_EQ(outcome[2], REPLAY_MISSED);
+    CHECK_EQ(outcome[3], REPLAY_COUNTED);
+}
+
+int main(void)
+{
+    Test_Stream();
+    Test_Match();
+    return TEST_RESULT();
+}
@@ -0,0 +1,247 @@
+#include <math.h>
+#include <stdlib.h>
+#include "test_common.h"
+#include "Synth.h"
+
+#define N_SAMPLES       (24000u * 60u)
+#define MAX_LABELS      4096
+
+static uint16_t a[N_SAMPLES];
+static uint16_t b[N_SAMPLES];
+static SynthLabel labels[MAX_LABELS];
+static uint32_t label_count;
+
+static void On_Label(void *user, const SynthLabel *l)
+{
+    (void)user;
+    if (label_count < MAX_LABELS)
+        labels[label_count++] = *l;
+}
+
+/* 只保留指定的成分 */
+static void Quiet_Config(SynthConfig *c)
+{
+    Synth_Defaults(c);
+    c->drift_mv = 0.0f;
+    c->hum_mv = 0.0f;
+    c->emi_rate_hz = 0.0f;
+    c->noise_lsb = 0.0f;
+    c->drop_rate_hz = 0.0f;
+    c->ring_ratio = 0.0f;
+    c->shape_jitter = 0.0f;
+}
+
+static double Baseline_Lsb(const SynthConfig *c)
+{
+    return c->baseline_mv * SYNTH_ADC_FULL_SCALE / SYNTH_ADC_REF_MV;
+}
+
+/* 同一种子：一次生成与任意分段生成逐位相同 */
+static void Test_Deterministic(void)
+{
+    SynthConfig c;
+    uint32_t pos = 0, chunk = 1, i, n1;
+
+    Synth_Defaults(&c);
+    c.drop_rate_hz = 20.0f;
+    c.emi_rate_hz = 2.0f;
+    c.seed = 7;
+    label_count = 0;
+    Synth_Init(&c, On_Label, 0);
+    Synth_Generate(a, N_SAMPLES);
+    n1 = label_count;
+
+    label_count = 0;
+    Synth_Init(&c, On_Label, 0);
+    while (pos < N_SAMPLES)
+    {
+        uint32_t n = (N_SAMPLES - pos < chunk) ? N_SAMPLES - pos : chunk;
+
+        Synth_Generate(&b[pos], n);
+        pos += n;
+        chunk = (chunk * 7 + 3) % 5000;
+    }
+    CHECK_EQ(label_count, n1);
+    for (i = 0; i < N_SAMPLES; i++)
+        if (a[i] != b[i] || a[i] > 4095)
+            break;
+    CHECK_EQ(i, N_SAMPLES);
+
+    c.seed = 8;
+    Synth_Init(&c, 0, 0);
+    Synth_Generate(b, N_SAMPLES);
+    for (i = 0; i < N_SAMPLES; i++)
+        if (a[i] != b[i])
+            break;
+    CHECK(i < N_SAMPLES);
+}
+
+/* 只有噪声：均值为基线，标准差约为噪声与量化噪声之和 */
+static void Test_NoiseOnly(void)
+{
+    SynthConfig c;
+    double sum = 0.0, sq = 0.0, mean, sd;
+    uint32_t i;
+
+    Quiet_Config(&c);
+    c.noise_lsb = 2.0f;
+    Synth_Init(&c, 0, 0);
+    Synth_Generate(a, N_SAMPLES);
+    for (i = 0; i < N_SAMPLES; i++)
+        sum += a[i];
+    mean = sum / N_SAMPLES;
+    for (i = 0; i < N_SAMPLES; i++)
+        sq += (a[i] - mean) * (a[i] - mean);
+    sd = sqrt(sq / N_SAMPLES);
+    CHECK(fabs(mean - Baseline_Lsb(&c)) < 0.1);
+    CHECK(fabs(sd - sqrt(4.0 + 1.0 / 12.0)) < 0.05);
+}
+
+/* 工频：峰峰值与周期 */
+static void Test_Hum(void)
+{
+    SynthConfig c;
+    uint16_t lo = 4095, hi = 0;
+    uint32_t period = (uint32_t)(Synth_SampleRate() / 50.0 + 0.5);
+    uint32_t i, diff = 0;
+
+    Quiet_Config(&c);
+    c.hum_mv = 20.0f;
+    Synth_Init(&c, 0, 0);
+    Synth_Generate(a, 10 * period);
+    for (i = 0; i < 10 * period; i++)
+    {
+        if (a[i] < lo) lo = a[i];
+        if (a[i] > hi) hi = a[i];
+    }
+    CHECK(fabs((hi - lo) - 2.0 * 20.0 * SYNTH_ADC_FULL_SCALE / SYNTH_ADC_REF_MV) <= 2.0);
+    /* 采样率不是50Hz的整数倍，一个周期后相位差不到一个样本 */
+    for (i = 0; i < 9 * period; i++)
+        diff += (uint32_t)abs((int)a[i + period] - (int)a[i]);
+    CHECK(diff < 9 * period);
+}
+
+/* 泊松到达：滴数在期望值的4σ之内，标注按时间排序 */
+static void Test_Arrivals(void)
+{
+    SynthConfig c;
+    double expect = 30.0 * N_SAMPLES / Synth_SampleRate();
+    uint32_t i, overlaps = 0;
+    uint8_t sorted = 1;
+
+    Quiet_Config(&c);
+    c.drop_rate_hz = 30.0f;
+    label_count = 0;
+    Synth_Init(&c, On_Label, 0);
+    Synth_Generate(a, N_SAMPLES);
+    CHECK(fabs(label_count - expect) < 4.0 * sqrt(expect));
+    for (i = 1; i < label_count; i++)
+    {
+        if (labels[i].tick < labels[i - 1].tick)
+            sorted = 0;
+        overlaps += labels[i].overlap;
+    }
+    CHECK(sorted);
+    CHECK(overlaps > 0);                 // 30滴/秒下必然有重叠
+}
+
+/* 孤立雨滴：峰值位置与幅度符合标注；小雨滴带的绝对峰值在420-540mV */
+static void Test_Drops(void)
+{
+    SynthConfig c;
+    double lsb = SYNTH_ADC_FULL_SCALE / SYNTH_ADC_REF_MV;
+    uint32_t i, checked = 0;
+
+    Quiet_Config(&c);
+    c.drop_rate_hz = 1.0f;
+    c.amp_dist = SYNTH_AMP_UNIFORM;
+    c.amp_a = 300.0f;
+    c.amp_b = 1500.0f;
+    label_count = 0;
+    Synth_Init(&c, On_Label, 0);
+    Synth_Generate(a, N_SAMPLES);
+    CHECK(label_count > 30);
+    for (i = 0; i < label_count; i++)
+    {
+        uint32_t k, peak_at = labels[i].tick;
+        uint16_t peak = 0;
+        double expect = Baseline_Lsb(&c) + labels[i].amplitude_mv * lsb;
+
+        if (labels[i].overlap || labels[i].tick + 200 >= N_SAMPLES)
+            continue;
+        CHECK(labels[i].amplitude_mv >= 300.0f && labels[i].amplitude_mv <= 1500.0f);
+        for (k = labels[i].tick; k < labels[i].tick + 200; k++)
+        {
+            if (a[k] > peak)
+            {
+                peak = a[k];
+                peak_at = k;
+            }
+        }
+        /* 峰值落在两个采样点之间时离散峰值略低于标注（不超过幅度的0.5%） */
+        CHECK(peak <= expect + 0.5);
+        CHECK(peak >= expect - 1.0 - 0.005 * labels[i].amplitude_mv * lsb);
+        CHECK(peak_at + 1 >= labels[i].peak_tick && peak_at <= labels[i].peak_tick + 1);
+        CHECK(fabs(labels[i].decay_us - c.decay_us) < 0.5f);   // 无抖动时形状参数即配置值
+        checked++;
+    }
+    CHECK(checked > 30);
+
+    c.amp_dist = SYNTH_AMP_SMALL;
+    c.seed = 3;
+    label_count = 0;
+    Synth_Init(&c, On_Label, 0);
+    Synth_Generate(a, N_SAMPLES);
+    for (i = 0; i < label_count; i++)
+    {
+        float peak_mv = labels[i].amplitude_mv + c.baseline_mv;
+        CHECK(peak_mv >= SYNTH_SMALL_MIN_MV - 0.01f && peak_mv <= SYNTH_SMALL_MAX_MV + 0.01f);
+    }
+}
+
+/* 脉冲干扰：1~2个样本宽，幅度绝对值在[emi_mv/2, emi_mv]；输出限幅在12位范围内 */
+static void Test_Emi(void)
+{
+    SynthConfig c;
+    double lsb = SYNTH_ADC_FULL_SCALE / SYNTH_ADC_REF_MV;
+    uint32_t i;
+
+    Quiet_Config(&c);
+    c.emi_rate_hz = 5.0f;
+    c.emi_mv = 400.0f;
+    label_count = 0;
+    Synth_Init(&c, On_Label, 0);
+    Synth_Generate(a, N_SAMPLES);
+    CHECK(label_count > 100);
+    for (i = 0; i + 1 < label_count; i++)
+    {
+        uint32_t t = labels[i].tick + 1;     // 起点之后的第一个样本
+        double expect = Baseline_Lsb(&c) + labels[i].amplitude_mv * lsb;
+
+        if (labels[i + 1].tick <= t + 3 || (i > 0 && labels[i - 1].tick + 3 >= labels[i].tick))
+            continue;
+        CHECK(fabs(a[t] - (expect < 0.0 ? 0.0 : expect)) <= 1.0);   // 负向干扰在0处限幅
+        CHECK(fabs(a[t + 2] - Baseline_Lsb(&c)) <= 1.0);
+    }
+
+    Quiet_Config(&c);
+    c.baseline_mv = 3200.0f;
+    c.drop_rate_hz = 5.0f;
+    Synth_Init(&c, 0, 0);
+    Synth_Generate(a, N_SAMPLES / 10);
+    for (i = 0; i < N_SAMPLES / 10; i++)
+        if (a[i] > 4095)
+            break;
+    CHECK_EQ(i, N_SAMPLES / 10);
+}
+
+int main(void)
+{
+    Test_Deterministic();
+    Test_NoiseOnly();
+    Test_Hum();
+    Test_Arrivals();
+    Test_Drops();
+    Test_Emi();
+    return TEST_RESULT();
+}
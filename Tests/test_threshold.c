@@ -0,0 +1,97 @@
+#include "test_common.h"
+#include "Threshold.h"
+#include "Detector.h"
+#include "CoreHal.h"
+
+static uint16_t window[NOISE_WINDOW];
+static uint32_t set_calls;
+static uint16_t set_value;
+
+static void Hal_SetThreshold(void *user, uint16_t threshold)
+{
+    (void)user;
+    set_calls++;
+    set_value = threshold;
+}
+
+/* 送入count个在center±swing之间交替的样本 */
+static void Feed_Alternating(uint16_t center, uint16_t swing, uint32_t count)
+{
+    uint16_t block[DETECTOR_BLOCK_SAMPLES];
+    uint32_t done = 0;
+
+    while (done < count)
+    {
+        uint16_t n = (count - done > DETECTOR_BLOCK_SAMPLES) ? DETECTOR_BLOCK_SAMPLES : (uint16_t)(count - done);
+        uint16_t i;
+
+        for (i = 0; i < n; i++)
+            block[i] = ((done + i) & 1) ? (uint16_t)(center + swing) : (uint16_t)(center - swing);
+        Detector_ProcessBlock(block, n);
+        done += n;
+    }
+}
+
+static void Reset_All(void)
+{
+    Detector_Reset();
+    Threshold_Reset();
+    set_calls = 0;
+    set_value = 0;
+}
+
+int main(void)
+{
+    static const CoreHal hal = { 0, 0, Hal_SetThreshold, 0, 0 };
+
+    CoreHal_Register(&hal);
+
+    /* 噪声窗口未填满：保留初值 */
+    Reset_All();
+    Feed_Alternating(1000, 10, NOISE_WINDOW - 1);
+    Threshold_Update(window);
+    CHECK_EQ(dynamic_threshold, THRESHOLD_INIT);
+    CHECK_EQ(set_calls, 0);
+
+    /* 均值1000、MAD 10 → 1000 + MAD_GAIN*10 */
+    Feed_Alternating(1000, 10, NOISE_WINDOW);
+    Threshold_Update(window);
+    CHECK_EQ(noise_mad_estimate, 10);
+    CHECK_EQ(dynamic_threshold, 1000 + MAD_GAIN * 10);
+    CHECK_EQ(set_calls, 1);
+    CHECK_EQ(set_value, 1000 + MAD_GAIN * 10);
+
+    /* 目标变化不超过滞回：不更新 */
+    Feed_Alternating(1000, 8, NOISE_WINDOW);
+    Threshold_Update(window);
+    CHECK_EQ(noise_mad_estimate, 8);
+    CHECK_EQ(dynamic_threshold, 1000 + MAD_GAIN * 10);
+    CHECK_EQ(set_calls, 1);
+
+    /* 低噪声低基线：限幅到下限 */
+    Feed_Alternating(300, 1, NOISE_WINDOW);
+    Threshold_Update(window);
+    CHECK_EQ(dynamic_threshold, MIN_THRESHOLD);
+    CHECK_EQ(set_calls, 2);
+
+    /* 窗口内的孤立大峰值不计入均值（MAD仍按全窗口计算） */
+    Reset_All();
+    {
+        uint16_t block[DETECTOR_BLOCK_SAMPLES];
+        uint16_t b, i;
+
+        for (b = 0; b < NOISE_WINDOW / DETECTOR_BLOCK_SAMPLES; b++)
+        {
+            for (i = 0; i < DETECTOR_BLOCK_SAMPLES; i++)
+                block[i] = (i & 1) ? 1010 : 990;
+            if (b == 1)
+                block[10] = 3000;
+            Detector_ProcessBlock(block, DETECTOR_BLOCK_SAMPLES);
+        }
+    }
+    Threshold_Update(window);
+    CHECK_EQ(dynamic_threshold, 1000 + MAD_GAIN * noise_mad_estimate);
+
+    CoreHal_Register(0);
+    return TEST_RESULT();
+}
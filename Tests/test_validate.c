@@ -0,0 +1,84 @@
+#include "test_common.h"
+#include "Validate.h"
+#include "Threshold.h"
+
+static uint16_t snap[SNAPSHOT_SIZE];
+static uint16_t scratch[SNAPSHOT_SIZE];
+
+/* 触发点附近的典型雨滴：上升20点（每点40）、平顶4点、每点回落25 */
+static void Test_Drop(void)
+{
+    SnapshotVerdict v;
+    uint32_t peak;
+
+    Test_FillNoise(snap, SNAPSHOT_SIZE, 300, 2);
+    peak = Test_AddDrop(snap, SNAPSHOT_SIZE, SNAPSHOT_PRE_SAMPLES, 20, 40, 4, 25);
+    CHECK_EQ(Validate_Snapshot(snap, SNAPSHOT_SIZE, THRESHOLD_INIT, scratch, &v), REJECT_NONE);
+    CHECK_EQ(v.reject, REJECT_NONE);
+    CHECK(v.baseline >= 298 && v.baseline <= 302);
+    CHECK(v.start_index >= SNAPSHOT_PRE_SAMPLES && v.start_index < peak);
+    CHECK(v.peak_index >= peak && v.peak_index <= peak + 4);
+    CHECK(v.peak_value >= 1100 - 2 && v.peak_value <= 1100 + 2);
+    CHECK(v.end_index > v.peak_index);
+}
+
+/* 单点毛刺：不得计为雨滴 */
+static void Test_Spike(void)
+{
+    SnapshotVerdict v;
+
+    Test_FillNoise(snap, SNAPSHOT_SIZE, 300, 2);
+    snap[SNAPSHOT_PRE_SAMPLES] = 1500;
+    CHECK(Validate_Snapshot(snap, SNAPSHOT_SIZE, THRESHOLD_INIT, scratch, &v) != REJECT_NONE);
+}
+
+/* 陡峭阶跃（每点200）：平滑度判定拒绝 */
+static void Test_Steep(void)
+{
+    SnapshotVerdict v;
+
+    Test_FillNoise(snap, SNAPSHOT_SIZE, 300, 2);
+    Test_AddDrop(snap, SNAPSHOT_SIZE, SNAPSHOT_PRE_SAMPLES, 5, 200, 10, 200);
+    CHECK(Validate_Snapshot(snap, SNAPSHOT_SIZE, THRESHOLD_INIT, scratch, &v) != REJECT_NONE);
+}
+
+/* 峰值不超过阈值 */
+static void Test_BelowThreshold(void)
+{
+    SnapshotVerdict v;
+
+    Test_FillNoise(snap, SNAPSHOT_SIZE, 300, 0);
+    Test_AddDrop(snap, SNAPSHOT_SIZE, SNAPSHOT_PRE_SAMPLES, 10, 15, 4, 10);
+    CHECK_EQ(Validate_Snapshot(snap, SNAPSHOT_SIZE, THRESHOLD_INIT, scratch, &v), REJECT_THRESHOLD);
+}
+
+/* 判定不修改快照，区间越界直接拒绝 */
+static void Test_Contract(void)
+{
+    static uint16_t copy[SNAPSHOT_SIZE];
+    SnapshotVerdict v;
+    uint16_t k;
+
+    Test_FillNoise(snap, SNAPSHOT_SIZE, 300, 2);
+    Test_AddDrop(snap, SNAPSHOT_SIZE, SNAPSHOT_PRE_SAMPLES, 20, 40, 4, 25);
+    for (k = 0; k < SNAPSHOT_SIZE; k++)
+        copy[k] = snap[k];
+    Validate_Snapshot(snap, SNAPSHOT_SIZE, THRESHOLD_INIT, scratch, &v);
+    for (k = 0; k < SNAPSHOT_SIZE; k++)
+        if (snap[k] != copy[k])
+            break;
+    CHECK_EQ(k, SNAPSHOT_SIZE);
+
+    CHECK_EQ(Validate_And_Count_Event(snap, 0, 0, 0, THRESHOLD_INIT, 0, 0, scratch), REJECT_RANGE);
+    CHECK_EQ(Validate_And_Count_Event(snap, 100, 10, 900, THRESHOLD_INIT, 20, 50, scratch), REJECT_RANGE);
+}
+
+int main(void)
+{
+    Test_Drop();
+    Test_Spike();
+    Test_Steep();
+    Test_BelowThreshold();
+    Test_Contract();
+    return TEST_RESULT();
+}
@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+基准测试样本块生成（QEMU Cortex-M3基准，见 Bench/）
+
+把 .u16 采样文件（rain_synth 合成或 rain_capture 录制）截成整数个50样本DMA块，
+写成 Bench/BenchBlocks.c 的常量数组，基准程序按块循环送入检测链。
+文件内容只随输入变化，改动后须重新记录基线（rain_bench.py --update）。
+
+用法：
+  rain_synth -s 0.5 -r heavy -S 1 bench
+  python bench_blocks.py bench.u16 ../Bench/BenchBlocks.c
+  python bench_blocks.py bench.u16 ../Bench/BenchBlocks.c --blocks 100
+"""
+import argparse
+import os
+import struct
+import sys
+
+BLOCK_SAMPLES = 50               # DETECTOR_BLOCK_SAMPLES
+PER_LINE = 12
+
+
+def main():
+    ap = argparse.ArgumentParser(description='把.u16采样文件转换为基准测试的样本块数组')
+    ap.add_argument('samples', help='.u16采样文件（uint16小端）')
+    ap.add_argument('out', help='输出C文件（Bench/BenchBlocks.c）')
+    ap.add_argument('--blocks', type=int, default=0, help='块数，0为文件内全部整块')
+    ap.add_argument('--source', default='', help='写入文件头注释的生成命令')
+    args = ap.parse_args()
+
+    data = open(args.samples, 'rb').read()
+    count = len(data) // 2
+    samples = struct.unpack('<%dH' % count, data[:count * 2])
+    blocks = count // BLOCK_SAMPLES
+    if args.blocks:
+        blocks = min(blocks, args.blocks)
+    if blocks == 0 or blocks > 65535:
+        print('块数无效：%d' % blocks)
+        return 1
+    samples = samples[:blocks * BLOCK_SAMPLES]
+    if max(samples) > 4095:
+        print('样本超出12位范围')
+        return 1
+
+    with open(args.out, 'w', encoding='utf-8', newline='\n') as f:
+        f.write('/* 由Tools/bench_blocks.py生成，请勿手工修改\n')
+        f.write(' *   输入：%s（%d块，%d个样本）\n' % (args.source or os.path.basename(args.samples),
+                                                 blocks, len(samples)))
+        f.write(' */\n')
+        f.write('#include "BenchBlocks.h"\n\n')
+        f.write('const uint16_t bench_block_count = %d;\n\n' % blocks)
+        f.write('const uint16_t bench_samples[%d] =\n{\n' % len(samples))
+        for i in range(0, len(samples), PER_LINE):
+            f.write('    ' + ', '.join('%4d' % v for v in samples[i:i + PER_LINE]) + ',\n')
+        f.write('};\n')
+    print('%d块 -> %s' % (blocks, args.out))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Cortex-M3周期基准运行与比较（基准程序见 Bench/bench_main.c）
+
+在QEMU lm3s6965evb上以 -icount 确定性计时运行 rain_bench.elf，收集半主机输出的key=value，
+与基线文件比较：
+  周期项（*_mean、*_max）：超过基线 --tolerance 百分比为回归，返回1；低于基线的改进也列出
+  计数项（块数、快照数、计数等）：与基线不同说明输入或检测行为变了，只提示，周期差异须结合看
+基线不存在时输出结果并返回1（比较未进行，按失败处理），用 --update 记录后提交；改动检测链后有意接受新的开销时同样用 --update。
+-icount的shift会改变SysTick节拍与指令的比例，换算后的周期数不变，但改动后应重新记录基线。
+
+用法：
+  python rain_bench.py build-arm/rain_bench.elf
+  python rain_bench.py build-arm/rain_bench.elf --baseline ../Bench/baseline.txt --tolerance 1
+  python rain_bench.py build-arm/rain_bench.elf --update
+"""
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+DEFAULT_BASELINE = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'Bench', 'baseline.txt')
+LINE_RE = re.compile(r'^([a-z_0-9]+)=(\d+)$')
+CYCLE_SUFFIXES = ('_mean', '_max')
+
+
+def run_qemu(qemu, elf, shift, timeout):
+    """运行基准程序，返回(退出码, {key: value})；半主机输出可能在stdout或stderr"""
+    cmd = [qemu, '-M', 'lm3s6965evb', '-display', 'none', '-monitor', 'none', '-serial', 'none',
+           '-icount', 'shift=%d,align=off,sleep=off' % shift,
+           '-semihosting-config', 'enable=on,target=native',
+           '-kernel', elf]
+    proc = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE, timeout=timeout)
+    text = proc.stdout.decode('utf-8', 'replace') + '\n' + proc.stderr.decode('utf-8', 'replace')
+    return proc.returncode, parse(text)
+
+
+def parse(text):
+    values = {}
+    for line in text.splitlines():
+        m = LINE_RE.match(line.strip())
+        if m:
+            values[m.group(1)] = int(m.group(2))
+    return values
+
+
+def load_baseline(path):
+    if not os.path.exists(path):
+        return None
+    with open(path, encoding='utf-8') as f:
+        return parse(f.read())
+
+
+def save_baseline(path, values, shift):
+    with open(path, 'w', encoding='utf-8', newline='\n') as f:
+        f.write('# Cortex-M3周期基准基线（Tools/rain_bench.py --update 生成）\n')
+        f.write('# qemu-system-arm -M lm3s6965evb -icount shift=%d\n' % shift)
+        for key in sorted(values):
+            f.write('%s=%d\n' % (key, values[key]))
+
+
+def compare(values, baseline, tolerance):
+    """打印对比表，返回回归项数"""
+    regressions = 0
+    print('%-26s %10s %10s %8s' % ('项目', '基线', '本次', '变化'))
+    for key in sorted(set(values) | set(baseline)):
+        cur = values.get(key)
+        base = baseline.get(key)
+        if cur is None or base is None:
+            print('%-26s %10s %10s %8s' % (key, base if base is not None else '-',
+                                            cur if cur is not None else '-', '新增/缺失'))
+            continue
+        if not key.endswith(CYCLE_SUFFIXES):
+            mark = '' if cur == base else '  计数变化'
+            print('%-26s %10d %10d %8s%s' % (key, base, cur, '', mark))
+            continue
+        change = 100.0 * (cur - base) / base if base else (0.0 if cur == 0 else 100.0)
+        mark = ''
+        if change > tolerance:
+            mark = '  回归'
+            regressions += 1
+        elif change < -tolerance:
+            mark = '  改进'
+        print('%-26s %10d %10d %+7.2f%%%s' % (key, base, cur, change, mark))
+    return regressions
+
+
+def main():
+    ap = argparse.ArgumentParser(description='运行QEMU Cortex-M3周期基准并与基线比较')
+    ap.add_argument('elf', help='rain_bench.elf')
+    ap.add_argument('--qemu', default='qemu-system-arm', help='qemu-system-arm路径')
+    ap.add_argument('--baseline', default=DEFAULT_BASELINE, help='基线文件（默认Bench/baseline.txt）')
+    ap.add_argument('--shift', type=int, default=7, help='-icount shift（每条指令2^shift纳秒虚拟时间）')
+    ap.add_argument('--tolerance', type=float, default=2.0, help='周期项允许的增幅（百分比）')
+    ap.add_argument('--timeout', type=float, default=300.0, help='QEMU运行超时（秒）')
+    ap.add_argument('--update', action='store_true', help='把本次结果写为基线')
+    args = ap.parse_args()
+
+    code, values = run_qemu(args.qemu, args.elf, args.shift, args.timeout)
+    if code != 0 or 'blocks' not in values:
+        print('基准程序运行失败（退出码%d）' % code)
+        for key in sorted(values):
+            print('%s=%d' % (key, values[key]))
+        return 1
+
+    if args.update:
+        save_baseline(args.baseline, values, args.shift)
+        print('基线已写入 %s（%d项）' % (args.baseline, len(values)))
+        return 0
+
+    baseline = load_baseline(args.baseline)
+    if baseline is None:
+        for key in sorted(values):
+            print('%s=%d' % (key, values[key]))
+        print('无基线文件 %s，未比较：用 --update（bench_baseline目标）记录并提交' % args.baseline)
+        return 1
+
+    regressions = compare(values, baseline, args.tolerance)
+    if regressions:
+        print('%d项周期回归超过%.1f%%' % (regressions, args.tolerance))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+原始采样捕获录制工具（配合固件原始捕获模式，见 System/Capture.h）
+
+把RAW帧中的样本按采样序号顺序写入 <out>.u16（uint16小端，每个采样一个），
+链路跟不上造成的缺口写入 <out>.gaps.csv（起始采样序号,缺失样本数），不做插值。
+
+用法：
+  python rain_capture.py COM5 rain_0601 [1000000]
+  python rain_capture.py capture.bin rain_0601       # 离线转换抓包文件
+"""
+import sys
+
+import rain_telemetry as tlm
+
+
+def main(argv):
+    if len(argv) < 3:
+        print(__doc__)
+        return 1
+    baud = int(argv[3]) if len(argv) > 3 else 1000000
+    read = tlm.open_source(argv[1], baud)
+    parser = tlm.FrameParser()
+    samples_out = open(argv[2] + '.u16', 'wb')
+    gaps_out = open(argv[2] + '.gaps.csv', 'w')
+    gaps_out.write('tick,missing_samples\n')
+    next_tick = None
+    written = 0
+    missing = 0
+    try:
+        while True:
+            data = read()
+            if not data:
+                if not tlm.is_port(argv[1]):
+                    break
+                continue
+            for ftype, seq, payload in parser.feed(data):
+                if ftype != tlm.TYPE_RAW:
+                    continue
+                frame = tlm.decode_payload(ftype, payload)
+                tick = frame['tick']
+                if next_tick is not None and tick != next_tick:
+                    gap = (tick - next_tick) & 0xFFFFFFFF
+                    gaps_out.write('%d,%d\n' % (next_tick, gap))
+                    missing += gap
+                samples_out.write(b''.join(v.to_bytes(2, 'little') for v in frame['samples']))
+                written += len(frame['samples'])
+                next_tick = (tick + len(frame['samples'])) & 0xFFFFFFFF
+    except KeyboardInterrupt:
+        pass
+    samples_out.close()
+    gaps_out.close()
+    print('samples=%d missing=%d crc_errors=%d' % (written, missing, parser.crc_errors))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
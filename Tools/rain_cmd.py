@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+向雨滴传感器发送一条命令并打印应答（命令列表见 System/Command.h）
+list、prof等较长的应答分为多个REPLY帧，逐行打印
+
+用法：
+  python rain_cmd.py COM5 "get decim"
+  python rain_cmd.py COM5 "set export 2"
+  python rain_cmd.py COM5 "time 1767225600"
+"""
+import sys
+import time
+
+import serial  # pyserial
+
+import rain_telemetry as tlm
+
+
+def send_command(port, line, timeout=1.0, gap=0.1):
+    """发送一行命令，返回应答文本（分多帧的应答按行拼接）；超时返回None"""
+    parser = tlm.FrameParser()
+    port.reset_input_buffer()
+    port.write(line.encode('ascii') + b'\n')
+    replies = []
+    deadline = time.time() + timeout
+    while time.time() < deadline:
+        for ftype, seq, payload in parser.feed(port.read(256)):
+            if ftype == tlm.TYPE_REPLY:
+                replies.append(tlm.decode_payload(ftype, payload)['text'])
+                deadline = time.time() + gap     # 每收到一帧再等gap秒收后续帧
+    return '\n'.join(replies) if replies else None
+
+
+def main(argv):
+    if len(argv) < 3:
+        print(__doc__)
+        return 1
+    baud = int(argv[3]) if len(argv) > 3 else 115200
+    port = serial.Serial(argv[1], baud, timeout=0.05)
+    reply = send_command(port, argv[2])
+    print(reply if reply is not None else 'timeout')
+    return 0 if reply is not None and reply.startswith('OK') else 2
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+12位波形无损压缩块解码（与 System/Codec.c 一致）
+
+块位流（高位在前）：
+  mode(2)  0=原始12位  1=差分+Rice  2=二阶线性预测+Rice
+  mode=0：n个12位样本
+  mode=1/2：k(4) + 首样本(12) + n-1个Rice码残差（16个1后跟14位为转义）
+
+压缩快照导出帧（EXPORT_FORMAT_CODEC）：
+  AA 56 | 样本数(u16) | 压缩字节数(u16) | 每50个样本一个字节对齐的块
+
+用法：
+  python rain_codec.py capture.bin    # 从抓包中提取压缩快照并打印
+"""
+import struct
+import sys
+
+MODE_RAW = 0
+MODE_DELTA = 1
+MODE_LPC2 = 2
+RICE_ESCAPE = 16
+ESCAPE_BITS = 14
+SNAPSHOT_BLOCK = 50
+
+EXPORT_SYNC = b'\xAA\x56'
+
+
+class BitReader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+        self.acc = 0
+        self.bits = 0
+        self.overrun = False
+
+    def get(self, count):
+        while self.bits < count:
+            if self.pos < len(self.data):
+                b = self.data[self.pos]
+                self.pos += 1
+            else:
+                b = 0
+                self.overrun = True
+            self.acc = ((self.acc << 8) | b) & 0xFFFFFFFF
+            self.bits += 8
+        self.bits -= count
+        return (self.acc >> self.bits) & ((1 << count) - 1)
+
+
+def unzigzag(z):
+    return -((z + 1) >> 1) if z & 1 else z >> 1
+
+
+def decode_block(data, n):
+    """解码一块n个样本，返回(样本列表, 消耗字节数)；数据损坏抛出ValueError"""
+    r = BitReader(data)
+    mode = r.get(2)
+    if mode == MODE_RAW:
+        samples = [r.get(12) for _ in range(n)]
+    elif mode in (MODE_DELTA, MODE_LPC2):
+        k = r.get(4)
+        samples = [r.get(12)]
+        for i in range(1, n):
+            q = 0
+            while q < RICE_ESCAPE and r.get(1):
+                q += 1
+            if q >= RICE_ESCAPE:
+                z = r.get(ESCAPE_BITS)
+            else:
+                z = (q << k) | (r.get(k) if k else 0)
+            if mode == MODE_LPC2 and i >= 2:
+                pred = 2 * samples[i - 1] - samples[i - 2]
+            else:
+                pred = samples[i - 1]
+            samples.append((pred + unzigzag(z)) & 0xFFFF)
+    else:
+        raise ValueError('bad block mode %d' % mode)
+    if r.overrun:
+        raise ValueError('truncated block')
+    return samples, r.pos
+
+
+def decode_blocks(data, total, block=SNAPSHOT_BLOCK):
+    """按固定块长解码total个样本"""
+    out = []
+    pos = 0
+    while len(out) < total:
+        n = min(block, total - len(out))
+        samples, used = decode_block(data[pos:], n)
+        out.extend(samples)
+        pos += used
+    return out, pos
+
+
+def find_snapshots(buf):
+    """在字节流中查找压缩快照导出帧，返回样本列表的列表"""
+    result = []
+    pos = 0
+    while True:
+        pos = buf.find(EXPORT_SYNC, pos)
+        if pos < 0 or pos + 6 > len(buf):
+            break
+        total, nbytes = struct.unpack_from('<HH', buf, pos + 2)
+        body = buf[pos + 6:pos + 6 + nbytes]
+        if len(body) < nbytes:
+            break
+        try:
+            samples, used = decode_blocks(body, total)
+        except ValueError:
+            pos += 1
+            continue
+        if used != nbytes:
+            pos += 1
+            continue
+        result.append(samples)
+        pos += 6 + nbytes
+    return result
+
+
+def main(argv):
+    if len(argv) < 2:
+        print(__doc__)
+        return 1
+    with open(argv[1], 'rb') as f:
+        buf = f.read()
+    for i, samples in enumerate(find_snapshots(buf)):
+        print('snapshot %d: %d samples, peak %d' % (i, len(samples), max(samples)))
+        print(' '.join(str(v) for v in samples))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+批量下载设备事件日志（记录格式见 System/EventLog.h）
+
+按序号拉取："log <seq> <pages>" 请求一批LOG帧，收齐或超时后从最后序号继续请求，
+直到追上设备最新记录；链路中断后用 --from 指定上次的 next 序号续传。
+被覆盖的记录（设备返回的起始序号大于请求序号）计入缺失。
+
+用法：
+  python rain_log.py COM5                    # 从最早可读记录开始，输出events.csv
+  python rain_log.py COM5 --from 1200 out.csv
+"""
+import csv
+import sys
+import time
+
+import serial  # pyserial
+
+import rain_telemetry as tlm
+
+PAGES_PER_REQUEST = 8
+
+
+def download(port, seq, writer, timeout=2.0):
+    """下载从seq起的全部记录，返回(下一个序号, 缺失条数)"""
+    parser = tlm.FrameParser()
+    missing = 0
+    while True:
+        port.write(('log %d %d\n' % (seq, PAGES_PER_REQUEST)).encode('ascii'))
+        deadline = time.time() + timeout
+        pages = 0
+        latest = None
+        while pages < PAGES_PER_REQUEST and time.time() < deadline:
+            for ftype, _, payload in parser.feed(port.read(512)):
+                if ftype != tlm.TYPE_LOG:
+                    continue
+                info = tlm.decode_payload(ftype, payload)
+                if info['first_seq'] != seq:
+                    missing += info['first_seq'] - seq
+                seq = info['first_seq']
+                for rec in info['records']:
+                    writer.writerow([seq, rec.get('time', ''), rec.get('uptime_s', ''), rec['class'],
+                                     rec['reason'], rec['amplitude'], rec['width'], rec['area']])
+                    seq += 1
+                latest = info['next_seq']
+                pages += 1
+                deadline = time.time() + timeout
+                if seq >= latest:
+                    return seq, missing
+        if latest is None:
+            raise RuntimeError('no LOG frames (seq=%d)' % seq)
+
+
+def main(argv):
+    if len(argv) < 2:
+        print(__doc__)
+        return 1
+    args = argv[2:]
+    seq = 0
+    if len(args) >= 2 and args[0] == '--from':
+        seq = int(args[1])
+        args = args[2:]
+    out_name = args[0] if args else 'events.csv'
+    port = serial.Serial(argv[1], 115200, timeout=0.05)
+    with open(out_name, 'w', newline='') as f:
+        writer = csv.writer(f)
+        writer.writerow(['seq', 'time', 'uptime_s', 'class', 'reason', 'amplitude', 'width', 'area'])
+        next_seq, missing = download(port, seq, writer)
+    print('next=%d missing=%d -> %s' % (next_seq, missing, out_name))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,305 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+雨滴传感器遥测帧接收/解复用工具
+
+帧格式见 System/Telemetry.h：
+  A5 5A | ver | type | len(u16) | seq(u16) | payload | crc32(u32)
+CRC与STM32 CRC单元一致：多项式0x04C11DB7，初值0xFFFFFFFF，按32位小端字输入，
+不反射、无结果异或，帧头+负载末尾补0到整字。
+
+用法：
+  python rain_telemetry.py COM5            # 串口（需要pyserial）
+  python rain_telemetry.py COM5 1000000    # 原始捕获模式（CAPTURE_BAUDRATE）
+  python rain_telemetry.py capture.bin     # 离线解析抓包文件
+"""
+import datetime
+import struct
+import sys
+
+import rain_codec
+
+SYNC = b'\xA5\x5A'
+VERSION = 2
+HEADER_SIZE = 8
+CRC_SIZE = 4
+MAX_PAYLOAD = 1024
+
+TYPE_LIVE = 0x01
+TYPE_EVENT = 0x02
+TYPE_STATS = 0x03
+TYPE_SNAPSHOT = 0x04
+TYPE_STATUS = 0x05
+TYPE_LIVE_CODEC = 0x06
+TYPE_RAW = 0x07
+TYPE_REPLY = 0x08
+TYPE_DROPSIZE = 0x09
+TYPE_PERIOD = 0x0A
+TYPE_LOG = 0x0B
+
+DROP_HIST_BINS = 10                # 与Core/DropSize.h一致
+LOG_TIME_EPOCH = 1577836800        # 事件日志时间起点（2020-01-01Z），见System/EventLog.h
+LOG_TIME_UPTIME = 0x80000000
+LOG_CLASSES = ('rejected', 'drop', 'clipped', 'reserved')
+# 快照拒绝原因（固件REJECT_xxx，STATS帧与LOG记录共用）
+REJECT_REASONS = ('none', 'range', 'threshold', 'margin', 'amplitude', 'samples', 'narrow',
+                  'width', 'rise_time', 'fall_time', 'duration', 'rise_continuity',
+                  'fall_continuity', 'rise_smoothness', 'fall_smoothness', 'stability')
+
+TYPE_NAMES = {
+    TYPE_LIVE: 'LIVE',
+    TYPE_EVENT: 'EVENT',
+    TYPE_STATS: 'STATS',
+    TYPE_SNAPSHOT: 'SNAPSHOT',
+    TYPE_STATUS: 'STATUS',
+    TYPE_LIVE_CODEC: 'LIVE',
+    TYPE_RAW: 'RAW',
+    TYPE_REPLY: 'REPLY',
+    TYPE_DROPSIZE: 'DSD',
+    TYPE_PERIOD: 'PERIOD',
+    TYPE_LOG: 'LOG',
+}
+
+
+def stm32_crc32(data):
+    """按STM32 CRC单元的方式计算CRC32（输入按小端32位字，末尾补0）"""
+    if len(data) % 4:
+        data = data + b'\x00' * (4 - len(data) % 4)
+    crc = 0xFFFFFFFF
+    for (word,) in struct.iter_unpack('<I', data):
+        crc ^= word
+        for _ in range(32):
+            if crc & 0x80000000:
+                crc = ((crc << 1) ^ 0x04C11DB7) & 0xFFFFFFFF
+            else:
+                crc = (crc << 1) & 0xFFFFFFFF
+    return crc
+
+
+def unpack12(data, count):
+    """12位打包样本解包：每2个样本3字节，低位在前"""
+    out = []
+    for i in range(0, count, 2):
+        b0, b1, b2 = data[3 * (i // 2):3 * (i // 2) + 3]
+        out.append(b0 | ((b1 & 0x0F) << 8))
+        out.append((b1 >> 4) | (b2 << 4))
+    return out[:count]
+
+
+def wall_time(unix_s, ms=0):
+    """设备墙上时间（UTC）转ISO字符串，未设置时钟（0）返回None"""
+    if not unix_s:
+        return None
+    stamp = datetime.datetime.fromtimestamp(unix_s, datetime.timezone.utc)
+    return stamp.strftime('%Y-%m-%dT%H:%M:%S') + '.%03dZ' % ms
+
+
+def decode_area(code):
+    """事件日志面积码 -> 面积（ADC单位x样本，压缩前已除以4）"""
+    if code < 16:
+        return code * 4
+    e, m = code >> 4, code & 0x0F
+    return ((16 + m) << (e - 1)) * 4
+
+
+def decode_log_record(time_word, info):
+    rec = {'amplitude': (info & 0x3FF) << 2, 'width': (info >> 10) & 0xFF,
+           'area': decode_area((info >> 18) & 0xFF),
+           'reason': REJECT_REASONS[(info >> 26) & 0x0F],
+           'class': LOG_CLASSES[info >> 30]}
+    if time_word & LOG_TIME_UPTIME:
+        rec['uptime_s'] = time_word & ~LOG_TIME_UPTIME
+    else:
+        rec['time'] = wall_time(time_word + LOG_TIME_EPOCH)
+    return rec
+
+
+def decode_payload(ftype, payload):
+    """把负载解析为字典，未知类型返回原始字节"""
+    if ftype == TYPE_LIVE:
+        tick, shift, count = struct.unpack_from('<IBB', payload, 0)
+        cols = struct.unpack_from('<%dH' % (3 * count), payload, 6)
+        return {'tick': tick, 'ratio': 1 << shift,
+                'mean': list(cols[0::3]), 'min': list(cols[1::3]), 'max': list(cols[2::3])}
+    if ftype == TYPE_LIVE_CODEC:
+        tick, shift, count = struct.unpack_from('<IBB', payload, 0)
+        data = bytes(payload[6:])
+        out = {'tick': tick, 'ratio': 1 << shift}
+        for name in ('mean', 'min', 'max'):
+            out[name], used = rain_codec.decode_block(data, count)
+            data = data[used:]
+        return out
+    if ftype == TYPE_RAW:
+        tick, lost, count = struct.unpack_from('<IHB', payload, 0)
+        return {'tick': tick, 'lost_blocks': lost, 'samples': unpack12(payload[7:], count)}
+    if ftype == TYPE_DROPSIZE:
+        uptime, period = struct.unpack_from('<IH', payload, 0)
+        bins = list(struct.unpack_from('<%dH' % DROP_HIST_BINS, payload, 6))
+        # 第k箱体积上限 256*2^k nL，末箱不设上限
+        info = {'uptime_s': uptime, 'period_s': period, 'bins': bins}
+        if len(payload) >= 10 + 2 * DROP_HIST_BINS:
+            info['time'] = wall_time(struct.unpack_from('<I', payload, 6 + 2 * DROP_HIST_BINS)[0])
+        return info
+    if ftype == TYPE_LOG:
+        first, latest, count = struct.unpack_from('<IIB', payload, 0)
+        records = [decode_log_record(*struct.unpack_from('<II', payload, 9 + 8 * i))
+                   for i in range(count)]
+        return {'first_seq': first, 'next_seq': latest, 'records': records}
+    if ftype == TYPE_PERIOD:
+        kind, complete, start, rain_um, drops, peak = struct.unpack_from('<BBIIIH', payload, 0)
+        return {'period': 'day' if kind else 'hour', 'complete': complete,
+                'start': wall_time(start), 'rain_mm': rain_um / 1000.0, 'drops': drops,
+                'peak_1min_mmh': peak / 100.0}
+    if ftype == TYPE_REPLY:
+        return {'text': bytes(payload).decode('ascii', 'replace')}
+    if ftype == TYPE_EVENT:
+        tick, source, peak, peak_mv, drops, rain_um = struct.unpack_from('<IBHHII', payload, 0)
+        info = {'tick': tick, 'source': source, 'peak': peak, 'peak_mv': peak_mv,
+                'drops': drops, 'rain_mm': rain_um / 1000.0}
+        if len(payload) >= 23:
+            info['time'] = wall_time(*struct.unpack_from('<IH', payload, 17))
+        return info
+    if ftype == TYPE_STATS:
+        (uptime, drops, rain_um, intensity, thr, mad, baseline,
+         awd, valid) = struct.unpack_from('<IIIHHHHII', payload, 0)
+        info = {'uptime_s': uptime, 'drops': drops, 'rain_mm': rain_um / 1000.0,
+                'intensity_mmh': intensity / 100.0, 'threshold': thr, 'noise_mad': mad,
+                'baseline': baseline, 'awd_hits': awd, 'snapshots_valid': valid}
+        if len(payload) >= 44:
+            i10, i60, peak, hour_um, day_um = struct.unpack_from('<HHHII', payload, 30)
+            info.update({'intensity_10min': i10 / 100.0, 'intensity_60min': i60 / 100.0,
+                         'peak_1min_today': peak / 100.0, 'hour_mm': hour_um / 1000.0,
+                         'day_mm': day_um / 1000.0})
+        if len(payload) >= 48:
+            info['time'] = wall_time(struct.unpack_from('<I', payload, 44)[0])
+        if len(payload) >= 90:
+            diff, captured, deadtime = struct.unpack_from('<III', payload, 48)
+            rejects = struct.unpack_from('<15H', payload, 60)
+            info['funnel'] = {'awd': awd, 'diff': diff, 'captured': captured,
+                              'deadtime': deadtime, 'valid': valid}
+            info['rejects'] = dict((REJECT_REASONS[i + 1], n)
+                                   for i, n in enumerate(rejects) if n)
+        return info
+    if ftype == TYPE_SNAPSHOT:
+        tick, valid, length, pidx, pval, start, end = struct.unpack_from('<IBHHHHH', payload, 0)
+        info = {'tick': tick, 'valid': valid, 'len': length, 'peak_index': pidx,
+                'peak': pval, 'front': (start, end)}
+        if len(payload) >= 21:
+            info['time'] = wall_time(*struct.unpack_from('<IH', payload, 15))
+        return info
+    if ftype == TYPE_STATUS:
+        (normal, warm, acq_us, first_ms, ticks,
+         drop_evt, drop_exp, drop_live) = struct.unpack_from('<BBIIIIII', payload, 0)
+        info = {'normal': normal, 'warm_start': warm, 'boot_acq_us': acq_us,
+                'boot_first_detect_ms': first_ms, 'sample_ticks': ticks,
+                'tx_drops': (drop_evt, drop_exp, drop_live)}
+        if len(payload) >= 36:
+            cyc_last, cyc_max, export_bytes = struct.unpack_from('<IIH', payload, 26)
+            info.update({'codec_cycles_block': cyc_last, 'codec_cycles_max': cyc_max,
+                         'export_bytes': export_bytes})
+        if len(payload) >= 40:
+            (info['decim_overruns'],) = struct.unpack_from('<I', payload, 36)
+        if len(payload) >= 48:
+            info['capture_blocks'] = struct.unpack_from('<II', payload, 40)
+        if len(payload) >= 56:
+            writes, erases, forced = struct.unpack_from('<IHH', payload, 48)
+            info.update({'journal_writes': writes, 'journal_erases': erases,
+                         'journal_forced_erases': forced})
+        if len(payload) >= 65:
+            used, size, depth, nested = struct.unpack_from('<HHBI', payload, 56)
+            info.update({'stack_used': used, 'stack_size': size,
+                         'isr_depth_max': depth, 'isr_nested': nested})
+        return info
+    return {'raw': payload.hex()}
+
+
+class FrameParser:
+    """字节流 -> 帧；统计CRC错误与序号缺口（丢帧）
+    RAW捕获帧在中断中组帧，序号独立计数，单独统计缺口"""
+
+    def __init__(self):
+        self.buf = bytearray()
+        self.last_seq = {}
+        self.crc_errors = 0
+        self.lost_frames = 0
+        self.frames = 0
+        self.skipped_bytes = 0
+
+    def feed(self, data):
+        self.buf += data
+        out = []
+        while True:
+            pos = self.buf.find(SYNC)
+            if pos < 0:
+                keep = 1 if self.buf[-1:] == SYNC[:1] else 0
+                self.skipped_bytes += len(self.buf) - keep
+                del self.buf[:len(self.buf) - keep]
+                break
+            if pos:
+                self.skipped_bytes += pos
+                del self.buf[:pos]
+            if len(self.buf) < HEADER_SIZE:
+                break
+            ver, ftype, length, seq = struct.unpack_from('<BBHH', self.buf, 2)
+            if ver != VERSION or length > MAX_PAYLOAD:
+                del self.buf[:1]
+                self.skipped_bytes += 1
+                continue
+            total = HEADER_SIZE + length + CRC_SIZE
+            if len(self.buf) < total:
+                break
+            body = bytes(self.buf[:HEADER_SIZE + length])
+            (crc,) = struct.unpack_from('<I', self.buf, HEADER_SIZE + length)
+            if stm32_crc32(body) != crc:
+                self.crc_errors += 1
+                del self.buf[:1]
+                continue
+            del self.buf[:total]
+            stream = 'raw' if ftype == TYPE_RAW else 'main'
+            if stream in self.last_seq:
+                gap = (seq - self.last_seq[stream] - 1) & 0xFFFF
+                self.lost_frames += gap
+            self.last_seq[stream] = seq
+            self.frames += 1
+            out.append((ftype, seq, body[HEADER_SIZE:]))
+        return out
+
+
+def is_port(name):
+    return name.lower().startswith('com') or name.startswith('/dev/')
+
+
+def open_source(name, baud=115200):
+    if is_port(name):
+        import serial  # pyserial
+        port = serial.Serial(name, baud, timeout=0.1)
+        return lambda: port.read(4096)
+    f = open(name, 'rb')
+    return lambda: f.read(4096)
+
+
+def main(argv):
+    if len(argv) < 2:
+        print(__doc__)
+        return 1
+    read = open_source(argv[1], int(argv[2]) if len(argv) > 2 else 115200)
+    parser = FrameParser()
+    try:
+        while True:
+            data = read()
+            if not data:
+                if not is_port(argv[1]):
+                    break
+                continue
+            for ftype, seq, payload in parser.feed(data):
+                name = TYPE_NAMES.get(ftype, '0x%02X' % ftype)
+                print('%5d %-8s %s' % (seq, name, decode_payload(ftype, payload)))
+    except KeyboardInterrupt:
+        pass
+    print('frames=%d lost=%d crc_errors=%d skipped_bytes=%d' %
+          (parser.frames, parser.lost_frames, parser.crc_errors, parser.skipped_bytes))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+RAM预算报告（读取Keil armlink生成的map文件）
+
+输出RAM执行区的占用、栈/堆大小、按目标文件汇总的静态RAM，以及最大的若干个变量；
+剩余RAM低于--min-free时返回1，工程的"After Build"用户命令会在每次链接后运行本脚本，
+新增缓冲超出预算时在编译输出中直接看到。
+
+用法：
+  python ram_budget.py Listings/Project.map
+  python ram_budget.py Listings/Project.map --top 30 --min-free 1024
+"""
+import argparse
+import re
+import sys
+
+RAM_BASE = 0x20000000
+RAM_END = 0x20005000             # STM32F103C8：20KB
+
+REGION_RE = re.compile(r'Execution Region (\S+) \(Exec base: (0x[0-9a-fA-F]+),.*?Size: (0x[0-9a-fA-F]+), Max: (0x[0-9a-fA-F]+)')
+SYMBOL_RE = re.compile(r'^\s+(\S+)\s+(0x[0-9a-fA-F]{8})\s+(?:Ov\s+)?(Data|Section)\s+(\d+)\s+(\S+?)\((\S+)\)')
+
+
+def parse_map(text):
+    """返回(RAM执行区列表[(名称, 大小, 上限)], RAM符号列表[(名称, 地址, 大小, 目标文件, 段)])"""
+    regions = []
+    symbols = []
+    in_symbols = False
+    for line in text.splitlines():
+        m = REGION_RE.search(line)
+        if m:
+            base = int(m.group(2), 16)
+            if RAM_BASE <= base < RAM_END:
+                regions.append((m.group(1), int(m.group(3), 16), int(m.group(4), 16)))
+            continue
+        if 'Image Symbol Table' in line:
+            in_symbols = True
+            continue
+        if 'Memory Map of the image' in line:
+            in_symbols = False
+            continue
+        if not in_symbols:
+            continue
+        m = SYMBOL_RE.match(line)
+        if not m:
+            continue
+        addr = int(m.group(2), 16)
+        size = int(m.group(4))
+        if size == 0 or not RAM_BASE <= addr < RAM_END:
+            continue
+        symbols.append((m.group(1), addr, size, m.group(5), m.group(6), m.group(3)))
+    return regions, symbols
+
+
+def report(regions, symbols, top):
+    """打印报告，返回剩余字节数"""
+    used = sum(r[1] for r in regions)
+    limit = RAM_END - RAM_BASE
+    for name, size, max_size in regions:
+        print('%-12s %6d / %6d 字节' % (name, size, max_size))
+
+    stack = sum(s[2] for s in symbols if s[5] == 'Section' and s[4] == 'STACK')
+    heap = sum(s[2] for s in symbols if s[5] == 'Section' and s[4] == 'HEAP')
+    print('栈 %d 字节，堆 %d 字节' % (stack, heap))
+
+    data = [s for s in symbols if s[5] == 'Data']
+    per_object = {}
+    for name, _, size, obj, _, _ in data:
+        per_object[obj] = per_object.get(obj, 0) + size
+    print('\n按目标文件（静态变量）：')
+    for obj, size in sorted(per_object.items(), key=lambda kv: -kv[1]):
+        print('  %-24s %6d' % (obj, size))
+
+    print('\n最大的%d个变量：' % top)
+    for name, addr, size, obj, _, _ in sorted(data, key=lambda s: -s[2])[:top]:
+        print('  %-28s %6d  0x%08X  %s' % (name, size, addr, obj))
+
+    free = limit - used
+    print('\n合计 %d / %d 字节（%.1f%%），剩余 %d 字节' % (used, limit, 100.0 * used / limit, free))
+    return free
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Keil map文件RAM预算报告')
+    ap.add_argument('map', help='armlink map文件（Listings/Project.map）')
+    ap.add_argument('--top', type=int, default=20, help='列出的最大变量个数')
+    ap.add_argument('--min-free', type=int, default=512, help='剩余RAM低于该值时返回1')
+    args = ap.parse_args()
+
+    with open(args.map, encoding='latin-1') as f:
+        regions, symbols = parse_map(f.read())
+    if not regions:
+        print('map文件中没有RAM执行区（需在Options for Target -> Listing中勾选Linker Listing）')
+        return 2
+    free = report(regions, symbols, args.top)
+    if free < args.min_free:
+        print('RAM余量不足：剩余%d字节，低于预算下限%d字节' % (free, args.min_free))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
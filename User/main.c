@@ -4,11 +4,35 @@
 #include "OLED.h"                        // OLED显示屏驱动头文件
 #include "AD.h"                          // ADC模数转换器驱动头文件
 #include "stm32f10x_usart.h"             // 串口通信头文件
+#include "Serial.h"                      // USART1 DMA非阻塞发送
+#include "Telemetry.h"                   // 遥测帧协议
+#include "Export.h"                      // 快照波形导出
+#include "Decimator.h"                   // 示波流抽取
+#include "Capture.h"                     // 原始采样捕获
+#include "Command.h"                     // 串口命令接口
+#include "Clock.h"                       // 墙上时钟
+#include "DropSize.h"                    // 雨滴体积标定与滴谱
+#include "RainStats.h"                   // 多分辨率雨量统计
+#include "Journal.h"                     // 累计量掉电保持
+#include "Rollover.h"                    // 小时/日雨量结转
+#include "EventLog.h"                    // 紧凑事件日志
+#include "Latency.h"                     // 触发到计数延迟
+#include "Key.h"                         // 按键（TIM2采样消抖）
+#include "UI.h"                          // OLED多页界面
 #include "stm32f10x_gpio.h"              // GPIO口操作头文件
 #include "stm32f10x_rcc.h"               // 时钟控制头文件
+#include "Backup.h"                      // BKP寄存器热启动状态
+#include "Arena.h"                       // 静态内存规划
+#include "StackMon.h"                    // 栈高水位与中断嵌套
+#include "Cycle.h"                       // DWT周期计数（启动计时）
+#include "CoreHal.h"                     // 检测核心平台接口
+#include "Detector.h"                    // 采样中断侧检测
+#include "Threshold.h"                   // 自适应阈值
+#include "Validate.h"                    // 快照判定
+#include "DropCounter.h"                 // 快照计数与雨量累计
 
 // ========== 系统参数定义 ==========
-#define THRESHOLD 496                     // 初始阈值（ADC单位，400mV = 400/3.3*4095 ≈ 496）
+/* 检测参数（阈值、快照判定、在线峰值）见Core/Threshold.h、Core/Validate.c、Core/Detector.c */
 
 /* 增益配置：CH0=高增益、CH1=低增益（默认≈15倍 vs 1倍，可按需调整） */
 #define HIGH_GAIN_FACTOR         15.0f
@@ -16,76 +40,31 @@
 #define HIGH_GAIN_SAT_THRESHOLD  4000     // 高增益ADC达到该值视为饱和（接近3.3V）
 #define ADC_FULL_SCALE           4095.0f
 #define ADC_REF_VOLTAGE          3.3f
-#define ADC_SAMPLE_INTERVAL_US   42.0f    // 12MHz ADC、239.5周期采样、双通道扫描 ≈ 42us/样本
-
-/* 自适应阈值相关 */
-#define NOISE_WINDOW            200      // 噪声统计窗口长度（从环形缓冲末端向前取）
-#define MIN_THRESHOLD           496       // 阈值下限，防止过低（400mV = 400/3.3*4095 ≈ 496）
-#define MAX_THRESHOLD           3000     // 阈值上限，防止过高
-#define MAD_GAIN                3        // 平均绝对偏差放大倍数
-#define HYSTERESIS_MARGIN       15       // 阈值滞回，降低抖动
-
-/* 事件与抗干扰判定 */
-#define MIN_PEAK_DELTA_OVER_THR 8        // 峰值需高出阈值的最小余量（约6.5mV，适配小信号）
-#define MIN_LOCAL_DELTA         6        // 峰值相对于邻近样本的最小差值（适配小信号）
-#define MIN_RISE_SAMPLES        3        // 峰前上升最少采样点数
-#define MIN_DECAY_SAMPLES       3        // 峰后下降最少采样点数
-#define SHAPE_WINDOW_PRE        12       // 峰前用于形状判定的样本数
-#define SHAPE_WINDOW_POST       24       // 峰后用于形状判定的样本数
-
-/* 时间特征判定参数：区分真实雨滴信号和噪声干扰 */
-#define MIN_RISE_TIME_US        300      // 最小上升时间（微秒），适配小雨滴信号（降低到300us）
-#define MIN_FALL_TIME_US        300      // 最小下降时间（微秒），适配小雨滴信号（降低到300us）
-#define MIN_PULSE_DURATION_US   600      // 最小脉冲持续时间（微秒），适配小雨滴信号（降低到600us，约0.6ms）
-#define MAX_NOISE_PULSE_WIDTH   10       // 最大噪声脉冲宽度（采样点数），超过此宽度才可能是真实信号（约420us）
-
-/* 形状平滑度判定参数：真实信号相对平滑，干扰可能很陡峭 */
-#define MIN_SMOOTH_RISE_RATIO   0.25f    // 最小平滑上升比例：适配小雨滴信号（降低到25%）
-#define MIN_SMOOTH_FALL_RATIO   0.25f    // 最小平滑下降比例：适配小雨滴信号（降低到25%）
-#define MAX_STEEP_SLOPE         50       // 最大陡峭斜率（ADC单位/样本），适配小雨滴信号（提高到50）
-#define PEAK_STABILITY_WINDOW   5        // 峰值稳定性窗口：峰值附近±N个样本应该接近峰值
-#define PEAK_STABILITY_DELTA    30       // 峰值稳定性容差：峰值附近样本与峰值的最大差值
-
-/* 信号平滑滤波参数 */
-#define SMOOTH_FILTER_SIZE      3        // 移动平均滤波窗口大小（3点或5点）
-#define BASELINE_SAMPLE_COUNT   80       // 基线估算样本数
-#define LOCAL_REFINEMENT_RADIUS 6        // 峰值局部搜索半径
-#define MIN_PEAK_AMPLITUDE      500      // 最小峰值幅度（ADC单位，约400mV），适配420-540mV小雨滴信号
+
+/* 热启动：每秒把基线/阈值/噪声写入BKP，复位后立即恢复，免去基线与阈值的收敛过程 */
+#define WARM_STATE_MIN_DELTA    4        // 与上次保存值相差超过该值才重写BKP（ADC单位）
 
 /* 显示门限：小于该幅度的脉冲不刷新OLED（仅在主循环中使用） */
 #define DISPLAY_MIN_AMPLITUDE   400      // 显示下限约 320mV，适配420-540mV小雨滴信号显示
 
-/* 峰值检测状态机定义 */
-#define PEAK_STATE_IDLE         0        // 空闲状态
-#define PEAK_STATE_SEARCHING    1        // 峰值搜索状态
-#define PEAK_STATE_WAIT_FALL    2        // 等待回落状态
-
-/* 峰值检测参数 */
-#define PEAK_WINDOW_SIZE        60       // 峰值锁定窗口大小（50~80推荐）
-#define BASELINE_SIZE           100      // 基线估算窗口大小
-#define RETURN_THRESHOLD        20       // 回落阈值（ADC单位）
-#define DEAD_TIME_INIT          50       // 死区时间初始值（约5ms，对应50个采样点）
-#define PEAK_SEARCH_HALFSPAN    80       // 在触发点附近±半窗口内搜索峰值
-#define PEAK_SEARCH_CENTER      SNAPSHOT_PRE_SAMPLES  // 触发点索引（预触发长度）
-#define TAIL_SETTLE_COUNT       5        // 识别回落到基线所需的连续样本数
+/* 雨量学参数：单滴体积由峰值幅度经DropSize标定表换算（见Core/DropSize.c） */
 
-/* 前/后部分割参数（仅分析前部“上升→峰值→回落到基线”） */
-#define FRONT_START_DELTA       MIN_LOCAL_DELTA   // 认为“离开基线”的门限
-#define FRONT_END_DELTA         MIN_LOCAL_DELTA   // 认为“回到基线”的门限
-#define FRONT_END_SETTLE_COUNT  TAIL_SETTLE_COUNT// 回落连续样本计数
+/* 遥测输出周期 */
+#define STATUS_PERIOD_SECONDS   5        // 状态帧周期（秒）
+#define LIVE_BUCKETS_PER_FRAME  16       // 每个LIVE帧最多桶数（原始负载6+96字节）
+#define LIVE_FRAMES_PER_LOOP    2        // 每次主循环最多发送的LIVE帧数（积压时追赶）
 
-/* 严格前部处理：每个脉冲信号只取前部（约2ms），后部数据完全不分析，避免后部抖动导致跳变 */
-#define FRONT_ANALYSIS_TIME_MS  2.0f              // 前部分析时间窗口（毫秒）
-#define FRONT_ANALYSIS_SAMPLES   ((uint16_t)(FRONT_ANALYSIS_TIME_MS * 1000.0f / ADC_SAMPLE_INTERVAL_US))  // 前部分析采样点数（约48点）
+/* 累计量日志：连续无雨滴计数达到该秒数才视为安静期，允许擦Flash页 */
+#define JOURNAL_QUIET_SECONDS   60
 
-/* 事件级死区：用于在快照层面避免同一滴的重复触发（单位：主循环次数，10ms/次） */
-#define EVENT_DEADTIME_LOOPS    50       // 约 500ms，可按需要标定，避免同一滴的拖尾触发新的快照
+/* 原始捕获：1=上电即进入全速原始捕获（录制数据集用），0=正常遥测 */
+#ifndef CAPTURE_AUTOSTART
+#define CAPTURE_AUTOSTART       0
+#endif
 
-/* 雨量学参数（需根据传感器标定修正） */
-#define MM_PER_DROP             0.02f    // 每个有效雨滴折合降雨量（mm/滴）——占位标定值
-
-/* 强度统计（mm/h）——用近60秒的滴数计算 */
-#define SECONDS_WINDOW          60       // 统计窗口大小（秒）
+/* 事件帧来源 */
+#define EVENT_SOURCE_ISR        0        // 中断层在线峰值（仅显示）
+#define EVENT_SOURCE_SNAPSHOT   1        // 快照验证通过并计数
 
 // ========== 全局变量定义 ==========
 // 通道0（第一路）变量
@@ -112,66 +91,76 @@ static uint32_t last_update_counter = 0;          // 最近一次峰值更新的
 static uint32_t main_loop_counter = 0;            // 主循环计数器（每10ms递增）
 #define RAPID_JUMP_TIME_THRESHOLD  3              // 快速跳变时间阈值（主循环次数，即30ms），30ms内的小峰值直接忽略
 
-/* 中断层在线峰值检测结果（仅PA0）：每次完整脉冲结束时更新 */
-volatile uint16_t last_peak_value_from_isr = 0;   // 最近一次完整脉冲的峰值ADC码
-volatile uint16_t last_peak_index_from_isr = 0;   // 对应环形缓冲索引（调试用）
-volatile uint8_t  last_peak_ready_from_isr = 0;   // 标志位：1表示有新峰值待处理
-
 uint32_t display_counter = 0;            // 显示更新计数器，用于定时更新显示
 uint32_t system_check_counter = 0;       // 系统状态检查计数器，用于定时检查系统状态
 uint8_t system_normal = 1;               // 系统状态标志，1表示正常，0表示异常
 uint32_t last_sampling_tick = 0;         // 上一次采样推进计数
 
-/* 快照事件级死区计数器（单位：主循环次数） */
-static uint16_t event_deadtime_loops = 0;
-
 // ========== 函数声明 ==========
 void Update_Display(void);               // 显示更新函数声明
 void Check_System_Status(void);          // 系统状态检查函数声明
 static void Process_Snapshot_IfReady(void);  // 处理触发快照（100+900）
-static void Update_Adaptive_Threshold(void); // 计算噪声并自适应阈值
-static uint8_t Validate_And_Count_Event(uint16_t *buf, uint16_t len, uint16_t peak_index, uint16_t peak_value, uint16_t threshold, uint16_t start_index, uint16_t end_index); // 验证并计数事件
-static void Push_Second_Count(uint16_t drops_in_second); // 推送秒计数到窗口
-static float Compute_Intensity_MMH(void); // 计算降雨强度（mm/h）
-static int32_t Compute_Baseline(uint16_t *buf, uint16_t len);
-static void Find_Peak_In_Buffer(uint16_t *buf, uint16_t len, int32_t baseline,
-                                uint16_t *peak_index, uint16_t *peak_value,
-                                uint16_t search_start, uint16_t search_end);
 static uint16_t Scale_Value_With_Gain(uint16_t value, float gain);
-static void USART1_Config(void);          // 配置USART1用于VOFA+输出
-static void USART1_SendByte(uint8_t b);   // 发送单字节
-static void USART1_SendFloat_WithTail(float v); // 发送float并附加JustFloat尾标志
-static void Send_Live_Stream(void);       // 连续下采样输出，提供示波数据流
+static void Send_JustFloat(uint8_t prio, const float *v, uint8_t n); // 发送float通道并附加JustFloat尾标志（非阻塞入队）
+static void Send_Live_Stream(void);       // 抽取后的示波数据流（均值+最小/最大包络）
+static void Report_Peak(uint8_t source, uint16_t peak); // 输出峰值事件（遥测帧或JustFloat）
+static void Send_Stats_Frame(void);       // 每秒统计帧
+static void Send_Status_Frame(void);      // 状态帧
+static void Send_DropSize_Frame(void);    // 滴谱帧
+static void Send_Period_Frame(const RainPeriod *period); // 小时/日雨量帧
+static void Send_Snapshot_Frame(uint8_t valid, uint16_t peak_index, uint16_t peak_value,
+                                uint16_t start_index, uint16_t end_index); // 快照结果帧
+static uint32_t uptime_seconds = 0;       // 运行秒数（主循环计数）
 
 /* 触发与统计变量（当前仅使用PA0单通道） */
 volatile extern uint8_t snapshot_ready;  // 快照就绪标志（外部定义）
 volatile extern uint16_t snapshot_buffer_high[SNAPSHOT_SIZE]; // 高增益快照缓冲区
-volatile extern uint16_t snapshot_buffer_low[SNAPSHOT_SIZE];  // 低增益快照缓冲区
 volatile extern uint8_t snapshot_collecting; // 快照采集状态标志（外部定义）
 volatile extern uint16_t snapshot_peak_value; // 快照峰值（外部定义）
 volatile extern uint16_t snapshot_peak_index; // 快照峰值索引（外部定义）
 
-/* 导出缓存与标志（保存最近一次完整快照，用于命令导出） */
-static volatile uint16_t export_buffer[SNAPSHOT_SIZE]; // 导出数据缓冲区（PA0波形）
-volatile uint8_t export_ready = 0;                // 导出就绪标志
-
-/* 自适应阈值运行变量（当前仅针对通道0/PA0） */
-volatile uint16_t dynamic_threshold = THRESHOLD;  // 动态阈值变量（通道0）- 在中断中使用，需volatile
-
-/* 滴数与累计雨量 - 在中断中使用，需volatile或移除static */
-volatile uint32_t drop_count = 0;          // 雨滴计数
-volatile float total_rain_mm = 0.0f;       // 累计降雨量（毫米）
-
-/* 近60秒滴数窗口 - 在中断中使用 */
-volatile uint16_t drops_per_second[SECONDS_WINDOW] = {0}; // 每秒雨滴数数组
-volatile uint8_t sec_index = 0;            // 当前秒索引
-static uint16_t second_loop_counter = 0; // 10ms循环累加到100为1秒
+/* 滴数与累计雨量、检测漏斗计数在Core/DropCounter.c */
+static uint16_t seconds_since_drop = 0;    // 距最近一次计数的秒数（日志擦页的安静期判断）
+static void Journal_Collect(JournalTotals *totals); // 汇总需掉电保持的累计量
+static void Restore_Totals(void);          // 上电从日志恢复累计量
+static uint8_t Flash_Quiet(void);          // 是否允许擦Flash页
+static void Log_Snapshot_Event(uint8_t reason, const uint16_t *buf, int32_t baseline,
+                               uint16_t start_index, uint16_t end_index, uint16_t peak_value); // 写事件日志
 
 /* OLED显示缓存 */
 static float current_intensity_mmh = 0.0f; // 当前降雨强度（毫米/小时）
 static char last_gain_used = 'H';          // 最近一次使用的增益通道
 volatile uint32_t watchdog_trigger_count = 0; // 模拟看门狗触发次数
-volatile uint32_t snapshot_valid_count = 0;   // 验证通过次数
+
+/* 热启动与启动耗时统计 */
+uint8_t warm_start_used = 0;                  // 1：本次上电由BKP热启动
+uint32_t boot_acq_start_us = 0;               // 上电到开始采样的耗时（微秒）
+uint32_t boot_first_detect_ms = 0;            // 上电到第一次有效检测的耗时（毫秒），0表示尚未检测到
+static WarmState saved_warm_state;            // 最近一次写入BKP的状态
+static void Restore_Warm_State(void);         // 上电恢复热启动状态
+static void Save_Warm_State(void);            // 周期保存热启动状态
+
+/* 检测核心的平台接口：时钟为DWT周期计数，阈值写ADC模拟看门狗，触发记入延迟统计；
+   样本由DMA中断直接送入Detector_ProcessBlock，不经过read_samples */
+static uint32_t Hal_Cycles(void *user)
+{
+	(void)user;
+	return Cycle_Now();
+}
+
+static void Hal_SetThreshold(void *user, uint16_t threshold)
+{
+	(void)user;
+	AD_SetThreshold(threshold);
+}
+
+static void Hal_Trigger(void *user, uint32_t tick, uint16_t tail)
+{
+	(void)user;
+	Latency_MarkTrigger(tick, tail);
+}
+
+static const CoreHal firmware_hal = { 0, Hal_Cycles, Hal_SetThreshold, Hal_Trigger, 0 };
 
 /**
   * @brief  主函数
@@ -182,18 +171,29 @@ volatile uint32_t snapshot_valid_count = 0;   // 验证通过次数
 int main(void)
 {
     // ========== 系统初始化 ==========
+    StackMon_Paint();                    // 栈填充：必须最先执行，之后的用量都能被高水位扫描看到
+    Cycle_Init();                        // 启动DWT周期计数，作为启动耗时基准
+    CoreHal_Register(&firmware_hal);     // 检测核心平台接口（必须在AD_Init之前）
     Delay_Init();                        // 初始化延时函数，配置SysTick定时器
-    OLED_Init();                         // 初始化OLED显示屏，配置I2C通信和显示参数
+    Backup_Init();                       // 使能BKP域访问
+    Restore_Warm_State();                // 热启动：恢复基线/阈值/噪声（必须在AD_Init之前）
+    Restore_Totals();                    // 从Flash日志+BKP增量恢复累计滴数/雨量
+    EventLog_Init();                     // 事件日志（从Flash溢写区接续序号）
     AD_Init();                           // 初始化ADC和DMA，配置连续采样模式
-    AD_SetThreshold(THRESHOLD);          // 设置模拟看门狗阈值
-    USART1_Config();                     // 初始化USART1串口（PA10=TX，PA9=RX，115200 8N1）
+    AD_SetThreshold(dynamic_threshold);  // 设置模拟看门狗阈值（冷启动为THRESHOLD_INIT）
+    boot_acq_start_us = Cycle_Now() / CYCLES_PER_US;
+    Serial_Init(SERIAL_BAUDRATE);        // 初始化USART1串口（PA9=TX，PA10=RX，115200 8N1，DMA发送）
+    Telemetry_Init();                    // 遥测帧CRC单元
+    Clock_Init();                        // RTC墙上时钟（LSE起振在主循环中等待，不阻塞）
+#if CAPTURE_AUTOSTART
+    Capture_Start(CAPTURE_BAUDRATE);     // 数据集录制固件：上电即全速原始捕获
+#endif
+    OLED_Init();                         // OLED初始化较慢（上电延时+初始化命令），放在采样启动之后
+    
+    Key_Init();                          // 按键：TIM2周期采样消抖，事件不阻塞
     
     // ========== 显示静态内容 ==========
-	OLED_ShowString(1, 1, "Peak:");      // 合并通道峰值
-	OLED_ShowString(1, 11, "G:");        // 当前增益标记
-	OLED_ShowString(2, 1, "Volt:");      // 合并通道峰值电压
-	OLED_ShowString(3, 1, "Rain:");      // 累计雨量
-	OLED_ShowString(4, 1, "Sum:");       // 累计电压标签
+    UI_Init();                           // 实时页标签
     
     // ========== 主循环 ==========
     while (1)                            // 程序主要逻辑
@@ -283,7 +283,7 @@ int main(void)
 					suspicious_peak = 0;
 					suspicious_peak_counter = 0;
                     /* 输出到VOFA+：单通道即时值 -> float32 + JustFloat尾标志 */
-                    USART1_SendFloat_WithTail(current_voltage);
+                    Report_Peak(EVENT_SOURCE_ISR, current_peak);
 				}
 			}
 			/* 若未达到显示门限，则认为是噪声/微小波动，不刷新显示 */
@@ -314,12 +314,21 @@ int main(void)
 			}
 		}
 
+		/* 雨量统计：按采样计数结转秒/分/时/天桶 */
+		RainStats_Advance(sampling_tick_counter);
+
 		/* 处理快照数据（如果就绪）：用于精确的事件验证和计数 */
 		Process_Snapshot_IfReady();
 
 		/* 自适应阈值（基于最近噪声） */
-		Update_Adaptive_Threshold();
+		Threshold_Update(arena_work.window);
         
+        /* 按键切换页面后立即重绘 */
+        if (UI_HandleKeys())
+        {
+            display_counter = 20;
+        }
+
         // 每200ms更新一次显示(20次 × 10ms = 200ms)
         if (display_counter >= 20)       // 检查显示计数器是否达到20
         {
@@ -332,31 +341,61 @@ int main(void)
         {
             Check_System_Status();       // 调用系统状态检查函数
             system_check_counter = 0;    // 重置系统状态计数器
+            Save_Warm_State();           // 保存热启动状态到BKP
 
 			/* 统计每秒滴数窗口并计算强度 */
-			Push_Second_Count(0);       // 未在此秒新增则推0，真实新增在快照处理中累加
-			current_intensity_mmh = Compute_Intensity_MMH(); // 计算当前降雨强度
+			current_intensity_mmh = (float)RainStats_Intensity1Min() / 100.0f; // 最近1分钟降雨强度
+
+			uptime_seconds++;
+			if (Clock_IsSet())
+			{
+				RainPeriod period;
+				Rollover_Update(Clock_Now(), total_rain_um, drop_count, RainStats_Intensity1Min());
+				while (Rollover_Pop(&period))
+				{
+					Send_Period_Frame(&period);   // 整点/日界：上一小时/日的雨量
+				}
+			}
+			if (seconds_since_drop < 0xFFFFu)
+			{
+				seconds_since_drop++;
+			}
+			{
+				JournalTotals totals;
+				uint8_t quiet = Flash_Quiet();
+				Journal_Collect(&totals);
+				Journal_Task(&totals, quiet);   // 批量写日志；擦页只在安静期
+				EventLog_Spill(quiet);          // 事件日志溢写到Flash
+			}
+			StackMon_Scan();                    // 栈高水位（每秒扫描一次，随STATUS帧发送）
+			Send_Stats_Frame();
+			if (uptime_seconds % DROP_HIST_PERIOD_S == 0)
+			{
+				Send_DropSize_Frame();   // 本周期滴谱，发送后清零
+			}
+			if (uptime_seconds % STATUS_PERIOD_SECONDS == 0)
+			{
+				Send_Status_Frame();
+			}
         }
         
-        /* 连续示波输出：按固定频率发送下采样后的最新ADC值（约1000点/秒） */
+        /* 串口命令：解析接收缓冲中的完整命令行 */
+        Command_Task();
+        Clock_Task();                    // LSE起振等待/LSI校准
+        EventLog_Task();                 // 事件日志批量下载（按缓冲余量逐帧发送）
+
+        /* 快照导出：每次循环限量入队，导出期间暂停示波流 */
+        Export_Task();
+
+        /* 连续示波输出：发送中断中抽取好的桶（默认1/32，约744桶/秒） */
         Send_Live_Stream();
 
         Delay_ms(10);                    // 延时10毫秒，控制循环频率，降低CPU占用率
         display_counter++;               // 显示计数器加1
         system_check_counter++;          // 系统状态计数器加1
-		second_loop_counter++;           // 秒循环计数器加1
 
 		/* 事件级死区递减：在一定时间内丢弃新快照，避免同一滴重复计数 */
-		if (event_deadtime_loops > 0)
-		{
-			event_deadtime_loops--;
-		}
-
-		if (second_loop_counter >= 100)  // 每100次循环（1秒）
-		{
-			second_loop_counter = 0;     // 重置秒循环计数器
-			/* 每秒推进索引在 Push_Second_Count 中处理 */
-		}
+		DropCounter_Loop();
     }
 }
 
@@ -364,43 +403,21 @@ int main(void)
   * @brief  显示更新函数（合并通道）
   * @param  无
   * @retval 无
-  * @note   更新OLED显示屏上的动态数据内容，显示两路信号的峰值和电压
+  * @note   汇总实时页数值交给UI_Render，按当前页渲染到帧缓冲后一次刷新，
+  *         未变化的字符与图形列不占用I2C
   */
 void Update_Display(void)
 {
-	/* 行1：合并峰值ADC值 */
-	OLED_ShowNum(1, 6, current_peak, 5);
-	OLED_ShowChar(1, 14, last_gain_used);
-
-	/* 行2：合并峰值电压（V），保留2位小数 */
-	{
-		uint16_t v100 = (uint16_t)(current_voltage * 100.0f); // 电压值乘以100转换为整数
-		OLED_ShowNum(2, 6, v100 / 100, 2); // 显示整数部分
-		OLED_ShowChar(2, 8, '.');          // 显示小数点
-		OLED_ShowNum(2, 9, (v100 % 100) / 10, 1); // 显示十分位
-		OLED_ShowNum(2, 10, v100 % 10, 1);  // 显示百分位
-	}
-
-	/* 行3：实时雨量（降雨强度 mm/h），保留2位小数 */
-	{
-		uint16_t intensity100 = (uint16_t)(current_intensity_mmh * 100.0f); // 降雨强度乘以100转换为整数
-		OLED_ShowNum(3, 7, intensity100 / 100, 3); // 显示整数部分（最多3位）
-		OLED_ShowChar(3, 10, '.');          // 显示小数点
-		OLED_ShowNum(3, 11, (intensity100 % 100) / 10, 1); // 显示十分位
-		OLED_ShowNum(3, 12, intensity100 % 10, 1);  // 显示百分位
-		OLED_ShowString(3, 14, "mm/h");    // 显示单位
-	}
+	UiLive live;
 
-	/* 行4：累计电压总和（V），保留2位小数 */
-	{
-		uint16_t sum100 = (uint16_t)(voltage_sum * 100.0f); // 累计电压值乘以100转换为整数
-		OLED_ShowNum(4, 6, sum100 / 100, 3); // 显示整数部分（最多3位）
-		OLED_ShowChar(4, 9, '.');          // 显示小数点
-		OLED_ShowNum(4, 10, (sum100 % 100) / 10, 1); // 显示十分位
-		OLED_ShowNum(4, 11, sum100 % 10, 1);  // 显示百分位
-		OLED_ShowString(4, 13, "V");       // 显示单位
-	}
+	live.peak = current_peak;                                   // 合并峰值ADC值
+	live.gain = last_gain_used;
+	live.volt_cv = (uint16_t)(current_voltage * 100.0f);        // 合并峰值电压（V），保留2位小数
+	live.intensity_cmh = (uint16_t)(current_intensity_mmh * 100.0f); // 实时雨量（降雨强度 mm/h）
+	live.sum_cv = (uint16_t)(voltage_sum * 100.0f);             // 累计电压总和（V）
 
+	/* 只写帧缓冲：只有内容变化的8列块被发送到面板 */
+	UI_Render(&live);
 }
 
 /**
@@ -428,168 +445,206 @@ void Check_System_Status(void)
 /* ========== 内部功能实现 ========== */
 
 /**
-  * @brief  处理快照数据（如果就绪）
+  * @brief  上电恢复热启动状态
   * @param  无
   * @retval 无
- * @note   模拟看门狗触发 → 预触发200点 + 后触发800点（双增益） → Validate_And_Count_Event
- *         1) DMA 持续向环形缓冲写入高/低增益两路数据；
- *         2) 模拟看门狗越界后立即复制200点历史样本，并继续采集800点后触发数据；
- *         3) 快照同时保留高增益和低增益波形，若高增益饱和则自动切换到低增益；
- *         4) 只分析“上升→峰值→回落至基线”这一正向半周期，忽略负半周；并记录脉冲长度；
- *         5) Validate_And_Count_Event 只使用有效段进行形状判定，配合 dead time/RETURN_THRESHOLD
- *            抑制单滴拖尾造成的重复计数。
- *         
- *         预触发处理时间计算（基于ADC_SAMPLE_INTERVAL_US = 42us）：
- *         - 预触发200点：200 × 42us = 8.4ms（从环形缓冲复制历史数据）
- *         - 后触发300点：300 × 42us = 12.6ms（继续采集实时数据）
- *         - 总快照窗口：500 × 42us = 21ms（确保整个脉冲包括后部震荡都在快照内）
- *         - 触发点位置：索引200（峰值应位于此位置附近）
- *         
- *         注意：模拟看门狗触发后，DMA中断会在下一个样本处理时响应，延迟约1个采样周期（42us）
+  * @note   BKP记录有效时：预填峰值检测器基线、恢复动态阈值与噪声估计，
+  *         第一个采样即可按稳态参数检测；记录无效时保持冷启动默认值
   */
-static void Process_Snapshot_IfReady(void)
+static void Restore_Warm_State(void)
 {
-	if (!snapshot_ready)                 // 如果快照未就绪，直接返回
+	WarmState state;
+
+	if (!Backup_LoadWarmState(&state))
 	{
+		warm_start_used = 0;
 		return;
 	}
-
-	/* 事件级死区内：直接丢弃本次快照，避免同一滴的拖尾触发 */
-	if (event_deadtime_loops > 0)
+	/* 合理性检查：阈值在限幅范围内且基线低于阈值，否则视为无效记录 */
+	if (state.threshold < MIN_THRESHOLD || state.threshold > MAX_THRESHOLD ||
+		state.baseline == 0 || state.baseline >= state.threshold)
 	{
-		snapshot_ready = 0;
+		Backup_ClearWarmState();
+		warm_start_used = 0;
 		return;
 	}
 
-	uint16_t len = SNAPSHOT_SIZE;
-	uint16_t high_peak_idx = 0, high_peak_val = 0;
+	Peak_Detector_Seed(state.baseline);
+	dynamic_threshold = state.threshold;
+	noise_mad_estimate = state.noise_mad;
+	saved_warm_state = state;
+	warm_start_used = 1;
+}
 
-	int32_t baseline_high = Compute_Baseline((uint16_t *)snapshot_buffer_high, len);
+/**
+  * @brief  周期保存热启动状态（每秒调用）
+  * @param  无
+  * @retval 无
+  * @note   仅在采样正常、基线窗口已填满时保存；变化不大时跳过写入
+  */
+static void Save_Warm_State(void)
+{
+	WarmState state;
+	uint16_t baseline = Peak_Detector_GetBaseline();
 
-	/* 严格前部处理：初始峰值搜索允许在预触发区域和前部窗口内搜索，但不搜索后部数据 */
-	/* 定义前部分析窗口：触发点后的前2ms（约48个采样点），完全忽略后部数据 */
-	uint16_t front_window_start = PEAK_SEARCH_CENTER;  // 触发点索引（200）
-	uint16_t front_window_end = PEAK_SEARCH_CENTER + FRONT_ANALYSIS_SAMPLES;  // 触发点后2ms（248）
-	if (front_window_end > len)
+	if (!system_normal || baseline == 0 || sampling_tick_counter < NOISE_WINDOW)
 	{
-		front_window_end = len - 1;
+		return;
 	}
 
-	/* 峰值搜索窗口：允许在预触发区域（触发点前80点）和前部窗口内搜索，确保能找到峰值 */
-	/* 但分析时只使用前部窗口的数据，不分析后部数据 */
-	uint16_t search_start = (PEAK_SEARCH_CENTER > PEAK_SEARCH_HALFSPAN) ?
-		(PEAK_SEARCH_CENTER - PEAK_SEARCH_HALFSPAN) : 0;  // 允许搜索预触发区域
-	uint16_t search_end = front_window_end - 1;  // 限制在前部窗口结束位置，不搜索后部
+	state.baseline = baseline;
+	state.threshold = dynamic_threshold;
+	state.noise_mad = noise_mad_estimate;
 
-	Find_Peak_In_Buffer((uint16_t *)snapshot_buffer_high, len, baseline_high,
-	                    &high_peak_idx, &high_peak_val, search_start, search_end);
+	if (state.threshold == saved_warm_state.threshold &&
+		state.baseline + WARM_STATE_MIN_DELTA >= saved_warm_state.baseline &&
+		state.baseline <= saved_warm_state.baseline + WARM_STATE_MIN_DELTA &&
+		state.noise_mad + WARM_STATE_MIN_DELTA >= saved_warm_state.noise_mad &&
+		state.noise_mad <= saved_warm_state.noise_mad + WARM_STATE_MIN_DELTA)
+	{
+		return;
+	}
 
-	uint16_t *active_buffer = (uint16_t *)snapshot_buffer_high;
-	int32_t active_baseline = baseline_high;
-	uint16_t active_peak_index = high_peak_idx;
-	uint16_t active_peak_value = high_peak_val;
-	uint16_t threshold = dynamic_threshold;
+	Backup_SaveWarmState(&state);
+	saved_warm_state = state;
+}
 
-	/* 当前仅使用PA0单通道，增益固定为高增益 */
-	last_gain_used = 'H';
+/**
+  * @brief  汇总需掉电保持的累计量
+  * @param  totals 输出
+  */
+static void Journal_Collect(JournalTotals *totals)
+{
+	totals->drops = drop_count;
+	totals->rain_um = total_rain_um;
+	totals->residual_nm = rain_residual_nm;
+	totals->voltage_cv = (uint32_t)(voltage_sum * 100.0f + 0.5f);
+}
 
-	/* 严格前部处理：只分析前部窗口内的数据（触发点后2ms），完全忽略后部数据 */
-	/* 注意：front_window_start和front_window_end已在上面定义 */
-	uint16_t start_index = front_window_start;    // front_start，从触发点开始
-	while (start_index < front_window_end && active_buffer[start_index] <= (active_baseline + FRONT_START_DELTA))
-	{
-		start_index++;
-	}
-	if (start_index > active_peak_index)
-	{
-		start_index = (active_peak_index > SHAPE_WINDOW_PRE) ? (active_peak_index - SHAPE_WINDOW_PRE) : front_window_start;
-	}
-	if (start_index < front_window_start)
-	{
-		start_index = front_window_start;
-	}
+/**
+  * @brief  是否允许擦Flash页（约20ms停顿，期间ADC中断被推迟）
+  * @retval 1：无快照/捕获且连续JOURNAL_QUIET_SECONDS秒无雨滴
+  */
+static uint8_t Flash_Quiet(void)
+{
+	return (!snapshot_collecting && !snapshot_ready && !capture_active &&
+	        seconds_since_drop >= JOURNAL_QUIET_SECONDS);
+}
 
-	uint16_t end_index = active_peak_index;   // front_end 初始从峰值开始向后搜索
-	while (end_index < front_window_end && active_buffer[end_index] > (active_baseline + FRONT_END_DELTA))
-	{
-		end_index++;
-	}
-	/* 限制end_index不超过前部窗口结束位置 */
-	if (end_index >= front_window_end)
-	{
-		end_index = front_window_end - 1;
-	}
+/**
+  * @brief  把快照处理结果写入事件日志
+  * @param  reason      REJECT_NONE：计数，其他：拒绝原因
+  * @param  buf         快照缓冲
+  * @param  baseline    快照基线
+  * @param  start_index 前部起点
+  * @param  end_index   前部终点
+  * @param  peak_value  前部峰值
+  */
+static void Log_Snapshot_Event(uint8_t reason, const uint16_t *buf, int32_t baseline,
+                               uint16_t start_index, uint16_t end_index, uint16_t peak_value)
+{
+	uint32_t area = 0;
+	uint16_t i;
+	uint16_t amplitude = (peak_value > baseline) ? (uint16_t)(peak_value - baseline) : 0;
+	uint8_t cls = EVENTLOG_CLASS_REJECTED;
 
-	/* 进一步确认回落点：需连续 TAIL_SETTLE_COUNT 个样本低于基线+delta */
-	/* 但限制在前部窗口内搜索，不搜索后部数据 */
-	uint16_t settle_idx = active_peak_index + 1;
-	uint8_t settle_count = 0;
-	uint16_t trimmed_end = end_index;
-	while (settle_idx <= end_index && settle_idx < front_window_end)
+	for (i = start_index; i <= end_index; i++)
 	{
-		if (active_buffer[settle_idx] <= (active_baseline + FRONT_END_DELTA))
-		{
-			settle_count++;
-			if (settle_count >= FRONT_END_SETTLE_COUNT)
-			{
-				trimmed_end = settle_idx - (TAIL_SETTLE_COUNT - 1);
-				break;
-			}
-		}
-		else
-		{
-			settle_count = 0;
-		}
-		settle_idx++;
-	}
-	end_index = trimmed_end;
-	if (end_index <= active_peak_index)
-		end_index = (active_peak_index < len - 1) ? (active_peak_index + 1) : active_peak_index;
-	/* 确保end_index不超过前部窗口结束位置 */
-	if (end_index >= front_window_end)
-	{
-		end_index = front_window_end - 1;
+		if (buf[i] > baseline)
+			area += (uint32_t)(buf[i] - baseline);
 	}
+	if (reason == REJECT_NONE)
+		cls = (peak_value >= (uint16_t)ADC_FULL_SCALE) ? EVENTLOG_CLASS_CLIPPED : EVENTLOG_CLASS_DROP;
+
+	EventLog_Append(Clock_TickToUnix(sampling_tick_counter, 0), uptime_seconds, amplitude,
+	                (uint16_t)(end_index - start_index + 1), area, reason, cls);
+}
+
+/**
+  * @brief  上电恢复累计滴数/雨量/电压和
+  * @param  无
+  * @retval 无
+  * @note   最新有效日志记录叠加BKP增量；日志为空时保持0
+  */
+static void Restore_Totals(void)
+{
+	JournalTotals totals;
 
-	/* 在前部区间 [start_index, end_index] 内重新搜索峰值，保证峰值仅来自前部 */
-	/* 如果初始搜索找到的峰值不在前部窗口内，在前部窗口内重新搜索 */
-	uint16_t front_peak_index = active_peak_index;
-	uint16_t front_peak_value = active_peak_value;
-	
-	/* 验证峰值是否在前部窗口内 */
-	if (active_peak_index < front_window_start || active_peak_index >= front_window_end)
+	if (Journal_Init(&totals))
 	{
-		/* 峰值不在前部窗口内（可能在预触发区域），在前部窗口内重新搜索峰值 */
-		front_peak_index = front_window_start;
-		front_peak_value = active_buffer[front_window_start];
-		for (uint16_t i = front_window_start + 1; i < front_window_end; i++)
-		{
-			if (active_buffer[i] > front_peak_value)
-			{
-				front_peak_value = active_buffer[i];
-				front_peak_index = i;
-			}
-		}
+		drop_count = totals.drops;
+		total_rain_um = totals.rain_um;
+		rain_residual_nm = totals.residual_nm;
+		voltage_sum = (float)totals.voltage_cv / 100.0f;
 	}
-	else if (end_index >= start_index)
+}
+
+/**
+  * @brief  清零雨滴/雨量统计（命令"reset"）
+  * @param  无
+  * @retval 无
+  * @note   快照处理与中断都会累加这些变量，关中断成组清零
+  */
+void Rain_ResetCounters(void)
+{
+	__disable_irq();
+	DropCounter_Reset();
+	watchdog_trigger_count = 0;
+	diff_trigger_count = 0;
+	snapshot_capture_count = 0;
+	__enable_irq();
+	voltage_sum = 0.0f;
+	RainStats_Reset(sampling_tick_counter);
+	Rollover_Restart();
+	current_intensity_mmh = 0.0f;
+	DropSize_ClearHistogram();
+}
+
+/**
+  * @brief  处理快照数据（如果就绪）
+  * @param  无
+  * @retval 无
+ * @note   模拟看门狗触发 → 预触发200点 + 后触发800点（双增益） → Validate_Snapshot
+ *         1) DMA 持续向环形缓冲写入高/低增益两路数据；
+ *         2) 模拟看门狗越界后立即复制200点历史样本，并继续采集800点后触发数据；
+ *         3) 快照同时保留高增益和低增益波形，若高增益饱和则自动切换到低增益；
+ *         4) 只分析“上升→峰值→回落至基线”这一正向半周期，忽略负半周；并记录脉冲长度；
+ *         5) Validate_Snapshot 只使用有效段进行形状判定，配合 dead time/RETURN_THRESHOLD
+ *            抑制单滴拖尾造成的重复计数。
+ *         
+ *         预触发处理时间计算（基于ADC_SAMPLE_INTERVAL_US = 42us）：
+ *         - 预触发200点：200 × 42us = 8.4ms（从环形缓冲复制历史数据）
+ *         - 后触发300点：300 × 42us = 12.6ms（继续采集实时数据）
+ *         - 总快照窗口：500 × 42us = 21ms（确保整个脉冲包括后部震荡都在快照内）
+ *         - 触发点位置：索引200（峰值应位于此位置附近）
+ *         
+ *         注意：模拟看门狗触发后，DMA中断会在下一个样本处理时响应，延迟约1个采样周期（42us）
+  */
+static void Process_Snapshot_IfReady(void)
+{
+	SnapshotVerdict verdict;
+	uint16_t len = SNAPSHOT_SIZE;
+
+	/* 未就绪或事件级死区内丢弃时直接返回；基线、前部分割、峰值与形状判定见Core/Validate.c，
+	   平滑结果放在主循环临时区 */
+	if (DropCounter_Judge(arena_work.smoothed, &verdict) != DROPCOUNTER_JUDGED)
 	{
-		/* 峰值在前部窗口内，在前部区间内重新搜索峰值 */
-		front_peak_index = start_index;
-		front_peak_value = active_buffer[start_index];
-		for (uint16_t i = start_index + 1; i <= end_index; i++)
-		{
-			if (active_buffer[i] > front_peak_value)
-			{
-				front_peak_value = active_buffer[i];
-				front_peak_index = i;
-			}
-		}
+		return;
 	}
 
-	snapshot_peak_value = front_peak_value;
-	snapshot_peak_index = front_peak_index;
+	/* 当前仅使用PA0单通道，增益固定为高增益 */
+	last_gain_used = 'H';
+
+	uint8_t reject_reason = verdict.reject;
+	const uint16_t *active_buffer = (const uint16_t *)snapshot_buffer_high;
+	int32_t active_baseline = verdict.baseline;
+	uint16_t start_index = verdict.start_index;
+	uint16_t end_index = verdict.end_index;
+	uint16_t front_peak_index = verdict.peak_index;
+	uint16_t front_peak_value = verdict.peak_value;
 
-	if (Validate_And_Count_Event(active_buffer, end_index + 1, front_peak_index, front_peak_value, threshold, start_index, end_index))
+	uint8_t event_valid = (reject_reason == REJECT_NONE);
+	if (event_valid)
 	{
 		/* 峰值保持机制：在保持时间内，只有更大的峰值才能更新显示 */
 		/* 关键改进：仅在保持时间内忽略明显小于旧峰值的新峰值（小于70%），防止后部震荡误判 */
@@ -666,695 +721,383 @@ static void Process_Snapshot_IfReady(void)
 			suspicious_peak = 0;
 			suspicious_peak_counter = 0;
             /* 输出到VOFA+：单通道即时值 -> float32 + JustFloat尾标志 */
-            USART1_SendFloat_WithTail(current_voltage);
+            Report_Peak(EVENT_SOURCE_SNAPSHOT, current_peak);
 		}
 		
-		snapshot_valid_count++;
+		/* 计数：滴数、雨量、滴谱与多分辨率统计，并开启事件级死区（Core/DropCounter.c） */
+		DropCounter_Count(&verdict);
+		Latency_RecordCount(sampling_tick_counter);
+		seconds_since_drop = 0;
 
-		drop_count++;                    // 雨滴计数加1
-		total_rain_mm += MM_PER_DROP;    // 累计降雨量增加
-		/* 将本秒计数+1 */
-		if (sec_index < SECONDS_WINDOW)  // 如果索引在有效范围内
+		/* 启动耗时：记录上电到第一次有效检测的时间（采样计数换算） */
+		if (boot_first_detect_ms == 0)
 		{
-			drops_per_second[sec_index] += 1; // 当前秒雨滴数加1
+			boot_first_detect_ms = (boot_acq_start_us +
+				(uint32_t)((float)sampling_tick_counter * ADC_SAMPLE_INTERVAL_US)) / 1000u;
+			if (boot_first_detect_ms == 0)
+				boot_first_detect_ms = 1;
 		}
 
-		/* 在快照层面开启事件级死区，避免拖尾引起的重复快照触发 */
-		event_deadtime_loops = EVENT_DEADTIME_LOOPS;
+		{
+			JournalTotals totals;
+			Journal_Collect(&totals);
+			Journal_Shadow(&totals);         // 本滴增量立即写BKP，日志按周期批量落盘
+		}
 	}
 
-	/* 备份快照用于导出 */
-	for (uint16_t i_copy = 0; i_copy < len; i_copy++)
+	Log_Snapshot_Event(reject_reason, active_buffer, active_baseline, start_index, end_index, front_peak_value);
+	Send_Snapshot_Frame(event_valid, front_peak_index, front_peak_value, start_index, end_index);
+
+	/* 提交导出：导出模块复制一份独占副本，发送期间新快照不会撕裂正在发送的数据 */
+	if (Export_Wants(event_valid))
 	{
-		export_buffer[i_copy] = snapshot_buffer_high[i_copy];
+		Export_Submit(snapshot_buffer_high, len);
 	}
-	export_ready = 1;                // 设置导出就绪标志
-	snapshot_ready = 0;              // 清除快照就绪标志
+	snapshot_ready = 0;              // 清除快照就绪标志（复制完成后才允许中断写入新快照）
 }
 
-/**
-  * @brief  更新自适应阈值（双通道模式）
-  * @param  无
-  * @retval 无
-  * @note   基于最近噪声统计分别为两路计算自适应阈值
-  */
-static void Update_Adaptive_Threshold(void)
+static uint16_t Scale_Value_With_Gain(uint16_t value, float gain)
 {
-	extern volatile uint16_t adc_ring_buffer_ch0[RING_BUFFER_SIZE]; // 通道0环形缓冲区
-	extern volatile uint16_t ring_write_index_ch0; // 通道0写索引
-	
-	int32_t sum;                           // 求和变量
-	uint16_t i;                           // 循环计数器
-	int16_t start;                        // 起始索引
-	int32_t mean_times_1;                 // 均值变量
-	int32_t mad_sum;                      // 平均绝对偏差和
-	int32_t mad;                          // 平均绝对偏差
-	int32_t target;                       // 目标阈值
-
-	if (NOISE_WINDOW > RING_BUFFER_SIZE) // 如果噪声窗口大于环形缓冲区大小
-		return;
-
-	/* ========== 通道0阈值计算（单通道PA0） ========== */
-	/* 改进：排除异常峰值，避免干扰影响阈值计算 */
-	/* 先计算均值，然后排除明显异常值（超过均值+3*MAD的样本） */
-	sum = 0;
-	start = (int16_t)ring_write_index_ch0 - NOISE_WINDOW;
-	if (start < 0) start += RING_BUFFER_SIZE;
-	for (i = 0; i < NOISE_WINDOW; i++)
-	{
-		sum += adc_ring_buffer_ch0[(start + i) % RING_BUFFER_SIZE];
-	}
-	mean_times_1 = sum / (int32_t)NOISE_WINDOW;
-	
-	/* 计算MAD用于识别异常值 */
-	mad_sum = 0;
-	for (i = 0; i < NOISE_WINDOW; i++)
-	{
-		int32_t v = (int32_t)adc_ring_buffer_ch0[(start + i) % RING_BUFFER_SIZE];
-		int32_t d = v - mean_times_1;
-		if (d < 0) d = -d;
-		mad_sum += d;
-	}
-	int32_t mad_pre = mad_sum / (int32_t)NOISE_WINDOW;
-	
-	/* 排除异常值后重新计算均值 */
-	sum = 0;
-	uint16_t valid_count = 0;
-	int32_t outlier_threshold = mean_times_1 + (int32_t)(3 * mad_pre);
-	for (i = 0; i < NOISE_WINDOW; i++)
-	{
-		int32_t v = (int32_t)adc_ring_buffer_ch0[(start + i) % RING_BUFFER_SIZE];
-		/* 排除明显异常值（可能是干扰峰值） */
-		if (v <= outlier_threshold)
-		{
-			sum += v;
-			valid_count++;
-		}
-	}
-	if (valid_count > 0)
-	{
-		mean_times_1 = sum / (int32_t)valid_count;
-	}
-
-	mad_sum = 0;
-	for (i = 0; i < NOISE_WINDOW; i++)
+	float scaled = (float)value * gain;
+	if (scaled < 0.0f)
 	{
-		int32_t v = (int32_t)adc_ring_buffer_ch0[(start + i) % RING_BUFFER_SIZE];
-		int32_t d = v - mean_times_1;
-		if (d < 0) d = -d;
-		mad_sum += d;
+		return 0;
 	}
-	mad = mad_sum / (int32_t)NOISE_WINDOW;
-
-	target = mean_times_1 + (int32_t)(MAD_GAIN * mad);
-	if (target < MIN_THRESHOLD) target = MIN_THRESHOLD; // 限制最小值400mV
-	if (target > MAX_THRESHOLD) target = MAX_THRESHOLD;
-
-	if ((int32_t)dynamic_threshold - target > HYSTERESIS_MARGIN ||
-		target - (int32_t)dynamic_threshold > HYSTERESIS_MARGIN)
+	if (scaled > ADC_FULL_SCALE)
 	{
-		dynamic_threshold = (uint16_t)target;
-		AD_SetThreshold(dynamic_threshold); // 设置ADC模拟看门狗阈值（通道0/PA0）
+		return (uint16_t)ADC_FULL_SCALE;
 	}
+	return (uint16_t)(scaled + 0.5f);
 }
 
 /**
-  * @brief  对缓冲区进行移动平均滤波，减少ADC量化噪声
-  * @param  buf: 输入缓冲区
-  * @param  smoothed: 输出平滑后的缓冲区
-  * @param  len: 缓冲区长度
-  * @param  start_idx: 起始索引
-  * @param  end_idx: 结束索引
-  * @retval 无
+  * @brief  发送若干float通道并追加JustFloat尾标志 {00 00 80 7F}
+  * @param  prio 发送优先级（SERIAL_PRIO_xxx）
+  * @param  v    各通道数值
+  * @param  n    通道数（1~3）
+  * @note   VOFA+ JustFloat引擎：仅需要在数据后追加尾标志即可，按小端发送；
+  *         整帧入队，缓冲满时整帧丢弃并计数，不阻塞主循环
   */
-static void Smooth_Filter(uint16_t *buf, uint16_t *smoothed, uint16_t len, uint16_t start_idx, uint16_t end_idx)
+static void Send_JustFloat(uint8_t prio, const float *v, uint8_t n)
 {
-	uint16_t i;
-	uint16_t half_window = SMOOTH_FILTER_SIZE / 2;
-	
-	for (i = start_idx; i <= end_idx && i < len; i++)
-	{
-		uint32_t sum = 0;
-		uint16_t count = 0;
-		
-		/* 计算移动平均：取当前点及其前后各half_window个点 */
-		int16_t win_start = (int16_t)i - (int16_t)half_window;
-		int16_t win_end = (int16_t)i + (int16_t)half_window;
-		
-		/* 限制窗口范围在有效区间内 */
-		if (win_start < (int16_t)start_idx) win_start = (int16_t)start_idx;
-		if (win_end > (int16_t)end_idx) win_end = (int16_t)end_idx;
-		if (win_end >= (int16_t)len) win_end = (int16_t)len - 1;
-		
-		for (int16_t j = win_start; j <= win_end; j++)
-		{
-			if (j >= 0 && j < (int16_t)len)
-			{
-				sum += buf[j];
-				count++;
-			}
-		}
-		
-		if (count > 0)
-		{
-			smoothed[i] = (uint16_t)(sum / count);
-		}
-		else
-		{
-			smoothed[i] = buf[i];
-		}
-	}
+    uint8_t frame[4 * 3 + 4];
+    uint8_t *p = frame;
+    uint8_t i;
+    union
+    {
+        float f;
+        uint8_t b[4];
+    } u;
+
+    if (n > 3)
+        n = 3;
+
+    /* float小端字节 + JustFloat结束标志 */
+    for (i = 0; i < n; i++)
+    {
+        u.f = v[i];
+        *p++ = u.b[0];
+        *p++ = u.b[1];
+        *p++ = u.b[2];
+        *p++ = u.b[3];
+    }
+    *p++ = 0x00;
+    *p++ = 0x00;
+    *p++ = 0x80;
+    *p++ = 0x7F;
+
+    Serial_Write(prio, frame, (uint16_t)(p - frame));
 }
 
 /**
-  * @brief  验证并计数事件
-  * @param  buf: 数据缓冲区指针
-  * @param  len: 缓冲区长度
-  * @param  peak_index: 峰值索引
-  * @param  peak_value: 峰值数值
-  * @param  threshold: 对应通道的动态阈值
-  * @retval 1: 有效事件，0: 无效事件
-  * @note   验证事件的有效性，包括幅值判定和形状判定
+  * @brief  输出抽取后的示波数据流
+  * @note   抽取在DMA中断中逐样本完成（Decimator），这里只取出桶并组帧：
+  *         LIVE帧负载为 首桶采样序号(u32) + 抽取shift(u8) + 桶数(u8) + 每桶(均值,最小,最大)；
+  *         LIVE_CODEC帧把三列分别压缩为三个Codec块；
+  *         FIFO溢出造成的桶缺口处结束当前帧，下一帧的采样序号自然跳变，主机据此显示断点
   */
-static uint8_t Validate_And_Count_Event(uint16_t *buf, uint16_t len, uint16_t peak_index, uint16_t peak_value, uint16_t threshold, uint16_t start_index, uint16_t end_index)
+static void Send_Live_Stream(void)
 {
-	uint16_t pre;                        // 峰前样本数
-	uint16_t post;                       // 峰后样本数
-	uint16_t rise_ok;                    // 上升斜率计数
-	uint16_t decay_ok;                   // 下降斜率计数
-	int i;                               // 循环计数器
+    static uint32_t live_base = 0;       // 抽取器复位时的采样序号
+    static uint8_t live_shift = 0xFF;    // 抽取比（与Decimator不一致时重新同步）
+    static uint32_t live_bucket = 0;     // 下一个期望的桶序号
 
-	if (len == 0 || start_index >= len)
-		return 0;
-	if (end_index >= len)
-		end_index = len - 1;
-	if (peak_index < start_index || peak_index > end_index)
-		return 0;
-	
-	/* 0) 信号平滑滤波：减少ADC量化噪声，让信号特征更明显 */
-	/* 创建平滑后的缓冲区（使用静态数组避免动态分配） */
-	static uint16_t smoothed_buf[SNAPSHOT_SIZE];
-	uint16_t smooth_start = (start_index > 0) ? (start_index - 1) : 0;
-	uint16_t smooth_end = (end_index < len - 1) ? (end_index + 1) : (len - 1);
-	
-	/* 对有效区间进行平滑滤波 */
-	Smooth_Filter(buf, smoothed_buf, len, smooth_start, smooth_end);
-	
-	/* 使用平滑后的数据进行后续判定 */
-	uint16_t *filtered_buf = smoothed_buf;
-	
-	/* 重新计算平滑后的峰值（在峰值附近搜索） */
-	uint16_t filtered_peak_value = filtered_buf[peak_index];
-	uint16_t filtered_peak_index = peak_index;
-	for (i = (peak_index > 2) ? (peak_index - 2) : 0; 
-	     i <= ((peak_index + 2 < len) ? (peak_index + 2) : (len - 1)); 
-	     i++)
-	{
-		if (filtered_buf[i] > filtered_peak_value)
-		{
-			filtered_peak_value = filtered_buf[i];
-			filtered_peak_index = i;
-		}
-	}
-	
-	/* 更新使用平滑后的峰值和缓冲区 */
-	peak_value = filtered_peak_value;
-	peak_index = filtered_peak_index;
-	buf = filtered_buf;
-
-	/* 1) 幅值判定 */
-	if (peak_value <= threshold) return 0; // 如果峰值不超过通道阈值
-	if (peak_value < (uint16_t)(threshold + MIN_PEAK_DELTA_OVER_THR)) return 0; // 如果峰值余量不足
-	if (peak_value < MIN_PEAK_AMPLITUDE) return 0; // 如果峰值幅度太小，可能是噪声
-
-	/* 2) 形状判定：峰前上升&峰后下降（避免随机振动） */
-	uint16_t available_pre = peak_index - start_index;
-	pre = (available_pre > SHAPE_WINDOW_PRE) ? SHAPE_WINDOW_PRE : available_pre; // 计算峰前样本数
-	uint16_t available_post = (end_index > peak_index) ? (end_index - peak_index) : 0;
-	post = (available_post > SHAPE_WINDOW_POST) ? SHAPE_WINDOW_POST : available_post; // 计算峰后样本数
-	if (pre < MIN_RISE_SAMPLES || post < MIN_DECAY_SAMPLES) return 0; // 如果样本数不足
-
-	/* 峰前：计算上升斜率数量 */
-	rise_ok = 0;                         // 初始化上升计数
-	int rise_start = (int)peak_index - (int)pre + 1;
-	if (rise_start < (int)start_index + 1)
-		rise_start = (int)start_index + 1;
-	for (i = rise_start; i <= (int)peak_index; i++) // 遍历峰前样本
-	{
-		if (buf[i] > buf[i - 1]) rise_ok++; // 如果当前值大于前一个值，计数加1
-	}
-	/* 峰后：计算下降斜率数量 */
-	decay_ok = 0;                        // 初始化下降计数
-	int decay_end = (int)peak_index + (int)post;
-	if (decay_end > (int)end_index)
-		decay_end = (int)end_index;
-	for (i = (int)peak_index + 1; i <= decay_end; i++) // 遍历峰后样本
-	{
-		if (buf[i] < buf[i - 1]) decay_ok++; // 如果当前值小于前一个值，计数加1
-	}
-	if (rise_ok < MIN_RISE_SAMPLES || decay_ok < MIN_DECAY_SAMPLES)
-	{
-		/* 对于窄脉冲，要求更严格的差值条件，避免噪声误判 */
-		uint16_t left_now = (peak_index > start_index) ? buf[peak_index - 1] : buf[peak_index];
-		uint16_t right_now = ((peak_index + 1) <= end_index) ? buf[peak_index + 1] : buf[peak_index];
-		/* 要求峰值相对于邻近样本的差值至少是 MIN_LOCAL_DELTA 的2倍 */
-		uint16_t min_diff_required = MIN_LOCAL_DELTA * 2;
-		if ((peak_value > left_now + min_diff_required) && (peak_value > right_now + min_diff_required))
-		{
-			return 1;
-		}
-		/* 如果前后样本差值不足，检查更远的样本 */
-		if ((peak_index > (start_index + 1)) && peak_value > buf[peak_index - 2] + min_diff_required)
-		{
-			if ((peak_index + 2) <= end_index && peak_value > buf[peak_index + 2] + min_diff_required)
-			{
-				return 1;
-			}
-		}
-		return 0;
-	}
+    uint16_t mean[LIVE_BUCKETS_PER_FRAME];
+    uint16_t min[LIVE_BUCKETS_PER_FRAME];
+    uint16_t max[LIVE_BUCKETS_PER_FRAME];
+    uint8_t frames = 0;
 
-	/* 3) 时间特征判定：区分真实雨滴信号和噪声干扰 */
-	/* 真实信号：上升→峰值→下降有一定时间，噪声：快速毛刺 */
-	
-	/* 3.1 快速过滤明显毛刺：脉冲宽度太窄直接判定为噪声 */
-	uint16_t pulse_width_samples = end_index - start_index + 1;
-	if (pulse_width_samples <= MAX_NOISE_PULSE_WIDTH)
-	{
-		/* 脉冲宽度小于等于10个采样点（约420us），判定为噪声毛刺 */
-		return 0;
-	}
-	
-	/* 3.2 计算上升时间：从开始到峰值的时间 */
-	uint16_t rise_samples = (peak_index > start_index) ? (peak_index - start_index) : 1;
-	float rise_time_us = (float)rise_samples * ADC_SAMPLE_INTERVAL_US;
-	
-	/* 3.3 计算下降时间：从峰值到结束的时间 */
-	uint16_t fall_samples = (end_index > peak_index) ? (end_index - peak_index) : 1;
-	float fall_time_us = (float)fall_samples * ADC_SAMPLE_INTERVAL_US;
-	
-	/* 3.4 计算总脉冲持续时间 */
-	float pulse_duration_us = (float)pulse_width_samples * ADC_SAMPLE_INTERVAL_US;
-	
-	/* 3.5 时间特征判定：真实信号必须有足够的上升时间、下降时间和总持续时间 */
-	if (rise_time_us < MIN_RISE_TIME_US)
-	{
-		/* 上升时间太短，可能是快速毛刺噪声 */
-		return 0;
-	}
-	
-	if (fall_time_us < MIN_FALL_TIME_US)
-	{
-		/* 下降时间太短，可能是快速毛刺噪声 */
-		return 0;
-	}
-	
-	if (pulse_duration_us < MIN_PULSE_DURATION_US)
-	{
-		/* 总持续时间太短，可能是快速毛刺噪声 */
-		return 0;
-	}
-	
-	/* 3.6 上升下降平滑度判定：真实信号相对平滑，干扰可能很陡峭 */
-	/* 计算上升过程中的平滑上升比例 */
-	uint16_t smooth_rise_count = 0;
-	uint16_t continuous_rise_count = 0;  // 连续上升计数
-	uint16_t max_continuous_rise = 0;    // 最大连续上升长度
-	uint16_t total_rise_samples = (peak_index > start_index) ? (peak_index - start_index) : 1;
-	if (total_rise_samples > 1)
-	{
-		for (i = start_index + 1; i <= peak_index; i++)
-		{
-			uint16_t diff = (buf[i] > buf[i - 1]) ? (buf[i] - buf[i - 1]) : 0;
-			/* 平滑上升：差值不超过最大陡峭斜率 */
-			if (diff > 0 && diff <= MAX_STEEP_SLOPE)
-			{
-				smooth_rise_count++;
-				continuous_rise_count++;
-				if (continuous_rise_count > max_continuous_rise)
-				{
-					max_continuous_rise = continuous_rise_count;
-				}
-			}
-			else
-			{
-				continuous_rise_count = 0;  // 重置连续计数
-			}
-		}
-	}
-	float smooth_rise_ratio = (total_rise_samples > 0) ? 
-		((float)smooth_rise_count / (float)total_rise_samples) : 0.0f;
-	
-	/* 计算下降过程中的平滑下降比例 */
-	uint16_t smooth_fall_count = 0;
-	uint16_t continuous_fall_count = 0;  // 连续下降计数
-	uint16_t max_continuous_fall = 0;     // 最大连续下降长度
-	uint16_t total_fall_samples = (end_index > peak_index) ? (end_index - peak_index) : 1;
-	if (total_fall_samples > 1)
-	{
-		for (i = peak_index + 1; i <= end_index; i++)
-		{
-			uint16_t diff = (buf[i - 1] > buf[i]) ? (buf[i - 1] - buf[i]) : 0;
-			/* 平滑下降：差值不超过最大陡峭斜率 */
-			if (diff > 0 && diff <= MAX_STEEP_SLOPE)
-			{
-				smooth_fall_count++;
-				continuous_fall_count++;
-				if (continuous_fall_count > max_continuous_fall)
-				{
-					max_continuous_fall = continuous_fall_count;
-				}
-			}
-			else
-			{
-				continuous_fall_count = 0;  // 重置连续计数
-			}
-		}
-	}
-	float smooth_fall_ratio = (total_fall_samples > 0) ? 
-		((float)smooth_fall_count / (float)total_fall_samples) : 0.0f;
-	
-	/* 增强判定：要求有足够的连续上升/下降，确保信号有明确的趋势 */
-	/* 根据信号幅度动态调整要求：小雨滴信号可能连续性稍弱 */
-	uint16_t min_continuous_required;
-	if (peak_value > 650)  // 大于650 ADC单位（约520mV），要求更严格
-	{
-		min_continuous_required = (total_rise_samples > 5) ? 3 : 2;
-	}
-	else  // 小雨滴信号（420-540mV），要求放宽
-	{
-		min_continuous_required = 1;  // 至少连续1个样本即可，降低要求
-	}
-	
-	/* 只在样本数足够多时才检查连续性，避免误判小雨滴 */
-	if (max_continuous_rise < min_continuous_required && total_rise_samples > 5)
-	{
-		/* 上升过程缺乏连续性，可能是噪声（但样本数要足够多才判定） */
-		return 0;
-	}
-	if (max_continuous_fall < min_continuous_required && total_fall_samples > 5)
-	{
-		/* 下降过程缺乏连续性，可能是噪声（但样本数要足够多才判定） */
-		return 0;
-	}
-	
-	/* 平滑度判定：真实信号应该有足够的平滑上升和下降 */
-	if (smooth_rise_ratio < MIN_SMOOTH_RISE_RATIO)
-	{
-		/* 上升过程不够平滑，可能是陡峭干扰 */
-		return 0;
-	}
-	
-	if (smooth_fall_ratio < MIN_SMOOTH_FALL_RATIO)
-	{
-		/* 下降过程不够平滑，可能是陡峭干扰 */
-		return 0;
-	}
-	
-	/* 3.7 峰值稳定性判定：真实信号峰值相对稳定，干扰峰值可能波动大 */
-	uint16_t peak_stable_count = 0;
-	uint16_t peak_check_start = (peak_index > PEAK_STABILITY_WINDOW) ? 
-		(peak_index - PEAK_STABILITY_WINDOW) : start_index;
-	uint16_t peak_check_end = (peak_index + PEAK_STABILITY_WINDOW < end_index) ? 
-		(peak_index + PEAK_STABILITY_WINDOW) : end_index;
-	
-	for (i = peak_check_start; i <= peak_check_end; i++)
-	{
-		uint16_t diff = (peak_value > buf[i]) ? (peak_value - buf[i]) : (buf[i] - peak_value);
-		/* 峰值附近样本应该接近峰值（在容差范围内） */
-		if (diff <= PEAK_STABILITY_DELTA)
-		{
-			peak_stable_count++;
-		}
-	}
-	
-	/* 峰值稳定性判定：峰值附近至少应该有部分样本接近峰值 */
-	uint16_t peak_check_samples = peak_check_end - peak_check_start + 1;
-	float peak_stability_ratio = (peak_check_samples > 0) ? 
-		((float)peak_stable_count / (float)peak_check_samples) : 0.0f;
-	
-	/* 根据信号幅度动态调整峰值稳定性要求：小雨滴信号可能峰值稳定性稍弱 */
-	float min_stability_ratio;
-	if (peak_value > 650)  // 大于650 ADC单位（约520mV），要求更严格
-	{
-		min_stability_ratio = 0.3f;  // 30%
-	}
-	else  // 小雨滴信号，要求放宽
-	{
-		min_stability_ratio = 0.2f;  // 20%，降低要求
-	}
-	
-	if (peak_stability_ratio < min_stability_ratio)
-	{
-		/* 峰值不够稳定，可能是孤立尖峰干扰 */
-		return 0;
-	}
+    if (live_shift != Decimator_GetShift() || live_base != Decimator_BaseTick())
+    {
+        live_shift = Decimator_GetShift();
+        live_base = Decimator_BaseTick();
+        live_bucket = 0;
+    }
 
-	/* 4) 通过所有判定：确认为真实雨滴信号 */
-	return 1;                            // 返回有效事件
+    while (frames < LIVE_FRAMES_PER_LOOP)
+    {
+        const DecimBucket *bucket;
+        uint32_t first_tick = 0;
+        uint8_t count = 0;
+
+        while (count < LIVE_BUCKETS_PER_FRAME && (bucket = Decimator_Peek()) != 0)
+        {
+            uint16_t gap = (uint16_t)(bucket->seq - (uint16_t)live_bucket);
+            if (gap != 0)
+            {
+                if (count > 0)
+                    break;
+                live_bucket += gap;
+            }
+            if (count == 0)
+                first_tick = live_base + (live_bucket << live_shift);
+            mean[count] = bucket->mean;
+            min[count] = bucket->min;
+            max[count] = bucket->max;
+            count++;
+            live_bucket++;
+            Decimator_Advance();
+        }
+        if (count == 0)
+            break;
+
+        /* 快照导出、原始捕获占用链路或示波流被关闭时丢弃数据，恢复后从最新的桶继续 */
+        if (Export_IsBusy() || capture_active || !telemetry_live_enabled)
+            continue;
+        frames++;
+
+        if (telemetry_vofa_mode)
+        {
+            for (uint8_t i = 0; i < count; i++)
+            {
+                float v[3];
+                v[0] = (float)mean[i] / ADC_FULL_SCALE * ADC_REF_VOLTAGE;
+                v[1] = (float)min[i] / ADC_FULL_SCALE * ADC_REF_VOLTAGE;
+                v[2] = (float)max[i] / ADC_FULL_SCALE * ADC_REF_VOLTAGE;
+                Send_JustFloat(SERIAL_PRIO_LIVE, v, 3);
+            }
+        }
+        else
+        {
+            uint8_t payload[6 + 6 * LIVE_BUCKETS_PER_FRAME];
+            uint8_t *p = payload;
+            uint8_t type = TLM_TYPE_LIVE;
+            p = Telemetry_PutU32(p, first_tick);
+            p = Telemetry_PutU8(p, live_shift);
+            p = Telemetry_PutU8(p, count);
+            if (telemetry_live_codec)
+            {
+                /* 三个压缩块最坏情况为原始12位打包，不会超过原始负载 */
+                p += Codec_EncodeBlock(mean, count, p);
+                p += Codec_EncodeBlock(min, count, p);
+                p += Codec_EncodeBlock(max, count, p);
+                type = TLM_TYPE_LIVE_CODEC;
+            }
+            else
+            {
+                for (uint8_t i = 0; i < count; i++)
+                {
+                    p = Telemetry_PutU16(p, mean[i]);
+                    p = Telemetry_PutU16(p, min[i]);
+                    p = Telemetry_PutU16(p, max[i]);
+                }
+            }
+            Telemetry_Send(SERIAL_PRIO_LIVE, type, payload, (uint16_t)(p - payload));
+        }
+    }
 }
 
 /**
-  * @brief  推送秒计数到窗口
-  * @param  drops_in_second: 当前秒的雨滴数
-  * @retval 无
-  * @note   将当前秒的雨滴数推送到统计窗口
+  * @brief  写入采样计数对应的墙上时间（Unix秒u32 + 秒内毫秒u16，时钟未设置时为0）
   */
-static void Push_Second_Count(uint16_t drops_in_second)
+static uint8_t *Put_WallTime(uint8_t *p, uint32_t tick)
 {
-	/* 每1秒推进一次索引，将当前秒的计数写入窗口 */
-	if (second_loop_counter == 0)        // 如果秒循环计数器为0（每秒一次）
-	{
-		sec_index = (sec_index + 1) % SECONDS_WINDOW; // 更新秒索引（环形）
-		drops_per_second[sec_index] = drops_in_second; // 设置当前秒雨滴数
-	}
-	else                                // 如果不是秒切换时刻
-	{
-		/* 在当前秒内增量叠加由Process_Snapshot_IfReady完成 */
-		(void)drops_in_second;           // 避免未使用参数警告
-	}
+    uint16_t ms;
+    uint32_t unix_seconds = Clock_TickToUnix(tick, &ms);
+
+    p = Telemetry_PutU32(p, unix_seconds);
+    return Telemetry_PutU16(p, ms);
 }
 
 /**
-  * @brief  计算降雨强度（mm/h）
-  * @param  无
-  * @retval 降雨强度值（毫米/小时）
-  * @note   基于最近60秒的雨滴数计算当前降雨强度
+  * @brief  输出峰值事件
+  * @param  source EVENT_SOURCE_xxx
+  * @param  peak   峰值ADC码
+  * @note   VOFA+兼容模式下仍输出单个JustFloat电压值
   */
-static float Compute_Intensity_MMH(void)
+static void Report_Peak(uint8_t source, uint16_t peak)
 {
-	uint32_t sum = 0;                    // 求和变量
-	uint8_t i;                          // 循环计数器
-	for (i = 0; i < SECONDS_WINDOW; i++) // 遍历统计窗口
-		sum += drops_per_second[i];      // 累加雨滴数
-	/* 60秒内滴数 -> 每小时：* (3600/60) = *60；每滴折算mm */
-	return (float)sum * MM_PER_DROP * 60.0f / (float)SECONDS_WINDOW; // 计算降雨强度
-}
+    uint8_t payload[23];
+    uint8_t *p = payload;
+    uint32_t tick = sampling_tick_counter;
 
-static int32_t Compute_Baseline(uint16_t *buf, uint16_t len)
-{
-	uint16_t base_count = (BASELINE_SAMPLE_COUNT < len) ? BASELINE_SAMPLE_COUNT : len;
-	if (base_count == 0)
-		return 0;
-	uint32_t base_sum = 0;
-	for (uint16_t i = 0; i < base_count; i++)
-	{
-		base_sum += buf[i];
-	}
-	return (int32_t)(base_sum / (uint32_t)base_count);
+    if (telemetry_vofa_mode)
+    {
+        float v = (float)peak / ADC_FULL_SCALE * ADC_REF_VOLTAGE;
+        Send_JustFloat(SERIAL_PRIO_EVENT, &v, 1);
+        return;
+    }
+
+    p = Telemetry_PutU32(p, tick);
+    p = Telemetry_PutU8(p, source);
+    p = Telemetry_PutU16(p, peak);
+    p = Telemetry_PutU16(p, (uint16_t)((uint32_t)peak * 3300u / 4095u));  // mV
+    p = Telemetry_PutU32(p, drop_count);
+    p = Telemetry_PutU32(p, total_rain_um);                               // um
+    p = Put_WallTime(p, tick);
+    Telemetry_Send(SERIAL_PRIO_EVENT, TLM_TYPE_EVENT, payload, (uint16_t)(p - payload));
 }
 
-static void Find_Peak_In_Buffer(uint16_t *buf, uint16_t len, int32_t baseline,
-                                uint16_t *peak_index, uint16_t *peak_value,
-                                uint16_t search_start, uint16_t search_end)
+/**
+  * @brief  每秒统计帧
+  */
+static void Send_Stats_Frame(void)
 {
-	if (len == 0)
-	{
-		*peak_index = 0;
-		*peak_value = 0;
-		return;
-	}
-
-	if (search_start >= len)
-		search_start = 0;
-	if (search_end >= len)
-		search_end = len - 1;
-	if (search_start > search_end)
-	{
-		uint16_t tmp = search_start;
-		search_start = 0;
-		search_end = tmp;
-		if (search_end >= len)
-			search_end = len - 1;
-	}
+    uint8_t payload[90];
+    uint8_t i;
+    uint8_t *p = payload;
 
-	int32_t max_delta = INT32_MIN;
-	uint16_t rough_idx = 0;
-	for (uint16_t i = search_start; i <= search_end; i++)
-	{
-		int32_t acc = buf[i];
-		uint8_t denom = 1;
-		if (i > 0)
-		{
-			acc += buf[i - 1];
-			denom++;
-		}
-		if (i + 1 < len)
-		{
-			acc += buf[i + 1];
-			denom++;
-		}
-		int32_t smooth = acc / denom;
-		int32_t delta = smooth - baseline;
-		if (delta > max_delta)
-		{
-			max_delta = delta;
-			rough_idx = i;
-		}
-	}
-
-	uint16_t refine_start = (rough_idx > LOCAL_REFINEMENT_RADIUS) ? (rough_idx - LOCAL_REFINEMENT_RADIUS) : search_start;
-	if (refine_start < search_start) refine_start = search_start;
-	uint16_t refine_end = (rough_idx + LOCAL_REFINEMENT_RADIUS < len) ? (rough_idx + LOCAL_REFINEMENT_RADIUS) : (len - 1);
-	if (refine_end > search_end) refine_end = search_end;
-	uint16_t max_v = buf[rough_idx];
-	uint16_t max_i = rough_idx;
-	for (uint16_t i = refine_start; i <= refine_end; i++)
-	{
-		if (buf[i] > max_v)
-		{
-			max_v = buf[i];
-			max_i = i;
-		}
-	}
-
-	*peak_index = max_i;
-	*peak_value = max_v;
-}
+    if (telemetry_vofa_mode)
+    {
+        return;
+    }
 
-static uint16_t Scale_Value_With_Gain(uint16_t value, float gain)
-{
-	float scaled = (float)value * gain;
-	if (scaled < 0.0f)
-	{
-		return 0;
-	}
-	if (scaled > ADC_FULL_SCALE)
-	{
-		return (uint16_t)ADC_FULL_SCALE;
-	}
-	return (uint16_t)(scaled + 0.5f);
+    p = Telemetry_PutU32(p, uptime_seconds);
+    p = Telemetry_PutU32(p, drop_count);
+    p = Telemetry_PutU32(p, total_rain_um);                               // um
+    p = Telemetry_PutU16(p, (uint16_t)(current_intensity_mmh * 100.0f));  // 0.01mm/h
+    p = Telemetry_PutU16(p, dynamic_threshold);
+    p = Telemetry_PutU16(p, noise_mad_estimate);
+    p = Telemetry_PutU16(p, Peak_Detector_GetBaseline());
+    p = Telemetry_PutU32(p, watchdog_trigger_count);
+    p = Telemetry_PutU32(p, snapshot_valid_count);
+    p = Telemetry_PutU16(p, RainStats_Intensity10Min());                 // 0.01mm/h
+    p = Telemetry_PutU16(p, RainStats_Intensity60Min());                 // 0.01mm/h
+    p = Telemetry_PutU16(p, RainStats_PeakIntensity(RAIN_LEVEL_DAY));    // 0.01mm/h，当天最大1分钟雨强
+    p = Telemetry_PutU32(p, RainStats_CurrentUm(RAIN_LEVEL_HOUR));       // um，当前小时
+    p = Telemetry_PutU32(p, RainStats_CurrentUm(RAIN_LEVEL_DAY));        // um，当天
+    p = Telemetry_PutU32(p, Clock_Now());                                // Unix秒，未设置为0
+    /* 检测漏斗：AWD命中(上) → 差分触发 → 完整快照 → 死区丢弃 → 验证通过(上，即计数) */
+    p = Telemetry_PutU32(p, diff_trigger_count);
+    p = Telemetry_PutU32(p, snapshot_capture_count);
+    p = Telemetry_PutU32(p, snapshot_deadtime_drops);
+    for (i = 1; i < REJECT_COUNT; i++)
+    {
+        p = Telemetry_PutU16(p, reject_counts[i]);                        // 各拒绝原因（REJECT_xxx）
+    }
+    Telemetry_Send(SERIAL_PRIO_EVENT, TLM_TYPE_STATS, payload, (uint16_t)(p - payload));
 }
 
 /**
-  * @brief  配置USART1（PA10=TX, PA9=RX, 115200 8N1）
-  * @note   仅用于向VOFA+发送单通道浮点波形数据
+  * @brief  状态帧（每STATUS_PERIOD_SECONDS秒）
   */
-static void USART1_Config(void)
+static void Send_Status_Frame(void)
 {
-    GPIO_InitTypeDef gpio;
-    USART_InitTypeDef usart;
-
-    /* 开启时钟：GPIOA 与 USART1 */
-    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA | RCC_APB2Periph_USART1, ENABLE);
-
-    /* PA9 -> USART1_TX: 复用推挽输出 50MHz（USART1默认映射） */
-    gpio.GPIO_Pin = GPIO_Pin_9;
-    gpio.GPIO_Speed = GPIO_Speed_50MHz;
-    gpio.GPIO_Mode = GPIO_Mode_AF_PP;
-    GPIO_Init(GPIOA, &gpio);
-
-    /* PA10 -> USART1_RX: 上拉输入 */
-    gpio.GPIO_Pin = GPIO_Pin_10;
-    gpio.GPIO_Speed = GPIO_Speed_50MHz;
-    gpio.GPIO_Mode = GPIO_Mode_IPU;
-    GPIO_Init(GPIOA, &gpio);
-
-    USART_StructInit(&usart);
-    usart.USART_BaudRate = 115200;
-    usart.USART_WordLength = USART_WordLength_8b;
-    usart.USART_StopBits = USART_StopBits_1;
-    usart.USART_Parity = USART_Parity_No;
-    usart.USART_Mode = USART_Mode_Tx | USART_Mode_Rx;
-    usart.USART_HardwareFlowControl = USART_HardwareFlowControl_None;
-    USART_Init(USART1, &usart);
-
-    USART_Cmd(USART1, ENABLE);
+    uint8_t payload[65];
+    uint8_t *p = payload;
+
+    if (telemetry_vofa_mode)
+    {
+        return;
+    }
+
+    p = Telemetry_PutU8(p, system_normal);
+    p = Telemetry_PutU8(p, warm_start_used);
+    p = Telemetry_PutU32(p, boot_acq_start_us);
+    p = Telemetry_PutU32(p, boot_first_detect_ms);
+    p = Telemetry_PutU32(p, sampling_tick_counter);
+    p = Telemetry_PutU32(p, serial_drop_frames[SERIAL_PRIO_EVENT]);
+    p = Telemetry_PutU32(p, serial_drop_frames[SERIAL_PRIO_EXPORT]);
+    p = Telemetry_PutU32(p, serial_drop_frames[SERIAL_PRIO_LIVE]);
+    p = Telemetry_PutU32(p, codec_block_cycles_last);
+    p = Telemetry_PutU32(p, codec_block_cycles_max);
+    p = Telemetry_PutU16(p, export_last_bytes);
+    p = Telemetry_PutU32(p, decim_overrun_count);
+    p = Telemetry_PutU32(p, capture_sent_blocks);
+    p = Telemetry_PutU32(p, capture_lost_blocks);
+    p = Telemetry_PutU32(p, journal_writes);
+    p = Telemetry_PutU16(p, (uint16_t)journal_erases);
+    p = Telemetry_PutU16(p, (uint16_t)journal_forced_erases);
+    p = Telemetry_PutU16(p, StackMon_Scan());
+    p = Telemetry_PutU16(p, StackMon_Size());
+    p = Telemetry_PutU8(p, isr_depth_max);
+    p = Telemetry_PutU32(p, isr_nested_count);
+    Telemetry_Send(SERIAL_PRIO_EVENT, TLM_TYPE_STATUS, payload, (uint16_t)(p - payload));
 }
 
 /**
-  * @brief  发送单字节（阻塞方式）
+  * @brief  快照处理结果帧
+  * @param  valid       1：验证通过并计数，0：被拒绝
+  * @param  peak_index  前部峰值索引（快照内）
+  * @param  peak_value  前部峰值
+  * @param  start_index 前部起点
+  * @param  end_index   前部终点
   */
-static void USART1_SendByte(uint8_t b)
+static void Send_Snapshot_Frame(uint8_t valid, uint16_t peak_index, uint16_t peak_value,
+                                uint16_t start_index, uint16_t end_index)
 {
-    while (USART_GetFlagStatus(USART1, USART_FLAG_TXE) == RESET)
+    uint8_t payload[21];
+    uint8_t *p = payload;
+    uint32_t tick = sampling_tick_counter;
+
+    if (telemetry_vofa_mode)
     {
-        /* 等待发送缓冲空 */
+        return;
     }
-    USART_SendData(USART1, b);
+
+    p = Telemetry_PutU32(p, tick);
+    p = Telemetry_PutU8(p, valid);
+    p = Telemetry_PutU16(p, SNAPSHOT_SIZE);
+    p = Telemetry_PutU16(p, peak_index);
+    p = Telemetry_PutU16(p, peak_value);
+    p = Telemetry_PutU16(p, start_index);
+    p = Telemetry_PutU16(p, end_index);
+    p = Put_WallTime(p, tick);
+    Telemetry_Send(SERIAL_PRIO_EVENT, TLM_TYPE_SNAPSHOT, payload, (uint16_t)(p - payload));
 }
 
 /**
-  * @brief  发送float并追加JustFloat尾标志 {00 00 80 7F}
-  * @note   VOFA+ JustFloat引擎：仅需要在数据后追加尾标志即可，按小端发送
+  * @brief  滴谱帧（每DROP_HIST_PERIOD_S秒一次，发送后清零）
   */
-static void USART1_SendFloat_WithTail(float v)
+static void Send_DropSize_Frame(void)
 {
-    const uint8_t jf_tail[4] = {0x00, 0x00, 0x80, 0x7F};
-    union
+    uint8_t payload[10 + 2 * DROP_HIST_BINS];
+    uint8_t *p = payload;
+    uint8_t i;
+
+    if (!telemetry_vofa_mode)
     {
-        float f;
-        uint8_t b[4];
-    } u;
-    u.f = v;
-
-    /* 发送float小端字节 */
-    USART1_SendByte(u.b[0]);
-    USART1_SendByte(u.b[1]);
-    USART1_SendByte(u.b[2]);
-    USART1_SendByte(u.b[3]);
-
-    /* 发送JustFloat结束标志 */
-    USART1_SendByte(jf_tail[0]);
-    USART1_SendByte(jf_tail[1]);
-    USART1_SendByte(jf_tail[2]);
-    USART1_SendByte(jf_tail[3]);
+        p = Telemetry_PutU32(p, uptime_seconds);
+        p = Telemetry_PutU16(p, DROP_HIST_PERIOD_S);
+        for (i = 0; i < DROP_HIST_BINS; i++)
+        {
+            p = Telemetry_PutU16(p, drop_histogram[i]);
+        }
+        p = Telemetry_PutU32(p, Clock_Now());    // 周期结束时刻（Unix秒，未设置为0）
+        Telemetry_Send(SERIAL_PRIO_EVENT, TLM_TYPE_DROPSIZE, payload, (uint16_t)(p - payload));
+    }
+    DropSize_ClearHistogram();
 }
 
 /**
-  * @brief  连续下采样输出ADC值，提供VOFA+示波数据流
-  * @note   目标速率约1000点/秒：每次主循环(10ms)最多发送10点
+  * @brief  小时/日雨量帧（整点与日界各一次）
+  * @param  period 已完成的周期
   */
-static void Send_Live_Stream(void)
+static void Send_Period_Frame(const RainPeriod *period)
 {
-    extern volatile uint16_t adc_ring_buffer_ch0[RING_BUFFER_SIZE];
-    extern volatile uint16_t ring_write_index_ch0;
-
-    /* 每次调用发送的最大点数；主循环10ms调用一次 -> 10点/10ms ≈ 1000点/s */
-    const uint8_t max_points = 10;
-
-    static uint16_t last_index = 0;
-
-    uint16_t write_idx = ring_write_index_ch0;
-    uint16_t available;
-    if (write_idx >= last_index)
-    {
-        available = write_idx - last_index;
-    }
-    else
-    {
-        available = (uint16_t)(RING_BUFFER_SIZE - last_index + write_idx);
-    }
+    uint8_t payload[16];
+    uint8_t *p = payload;
 
-    /* 限制发送数量，避免带宽溢出 */
-    uint16_t to_send = (available > max_points) ? max_points : available;
-    for (uint16_t i = 0; i < to_send; i++)
+    if (telemetry_vofa_mode)
     {
-        uint16_t idx = (last_index + i) % RING_BUFFER_SIZE;
-        uint16_t raw = adc_ring_buffer_ch0[idx];
-        float v = (float)raw / ADC_FULL_SCALE * ADC_REF_VOLTAGE;
-        USART1_SendFloat_WithTail(v);
+        return;
     }
 
-    last_index = (uint16_t)((last_index + to_send) % RING_BUFFER_SIZE);
+    p = Telemetry_PutU8(p, period->kind);
+    p = Telemetry_PutU8(p, period->complete);
+    p = Telemetry_PutU32(p, period->start_unix);
+    p = Telemetry_PutU32(p, period->rain_um);                             // um
+    p = Telemetry_PutU32(p, period->drops);
+    p = Telemetry_PutU16(p, period->peak_intensity);                      // 0.01mm/h
+    Telemetry_Send(SERIAL_PRIO_EVENT, TLM_TYPE_PERIOD, payload, (uint16_t)(p - payload));
 }
@@ -0,0 +1,28 @@
+# arm-none-eabi-gcc交叉编译工具链（固件目标）
+#   cmake -S . -B build-arm -DCMAKE_TOOLCHAIN_FILE=cmake/arm-none-eabi.cmake
+#   工具链不在PATH中时用 -DARM_TOOLCHAIN_DIR=<安装目录>/bin 指定
+set(CMAKE_SYSTEM_NAME Generic)
+set(CMAKE_SYSTEM_PROCESSOR arm)
+
+set(ARM_TOOLCHAIN_DIR "" CACHE PATH "arm-none-eabi工具链bin目录（为空时从PATH查找）")
+if(ARM_TOOLCHAIN_DIR)
+    set(ARM_PREFIX "${ARM_TOOLCHAIN_DIR}/arm-none-eabi-")
+else()
+    set(ARM_PREFIX "arm-none-eabi-")
+endif()
+
+set(CMAKE_C_COMPILER   "${ARM_PREFIX}gcc")
+set(CMAKE_ASM_COMPILER "${ARM_PREFIX}gcc")
+set(CMAKE_OBJCOPY      "${ARM_PREFIX}objcopy" CACHE FILEPATH "")
+set(CMAKE_SIZE         "${ARM_PREFIX}size" CACHE FILEPATH "")
+
+# 编译器探测时不链接（裸机没有crt0/系统调用）
+set(CMAKE_TRY_COMPILE_TARGET_TYPE STATIC_LIBRARY)
+
+set(CMAKE_C_FLAGS_INIT   "-mcpu=cortex-m3 -mthumb -ffunction-sections -fdata-sections")
+set(CMAKE_ASM_FLAGS_INIT "-mcpu=cortex-m3 -mthumb")
+set(CMAKE_EXE_LINKER_FLAGS_INIT "-mcpu=cortex-m3 -mthumb -Wl,--gc-sections --specs=nano.specs --specs=nosys.specs")
+
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)